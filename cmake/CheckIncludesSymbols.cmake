@@ -90,6 +90,18 @@ check_cxx_symbol_exists( M_PI "cmath" HAVE_M_PI )
 include( CheckFunctionExists )
 check_function_exists( expm1 "math.h" HAVE_EXPM1 )
 
+# POSIX shared memory for the shm recording backend; older C libraries
+# provide shm_open() in librt
+check_symbol_exists( shm_open "sys/mman.h" HAVE_SHM_OPEN )
+if ( NOT HAVE_SHM_OPEN )
+  include( CheckLibraryExists )
+  check_library_exists( rt shm_open "" HAVE_SHM_OPEN_IN_RT )
+  if ( HAVE_SHM_OPEN_IN_RT )
+    set( HAVE_SHM_OPEN ON )
+    set( SHM_LIBRARIES rt )
+  endif ()
+endif ()
+
 # given a list, filter all header files
 function( FILTER_HEADERS in_list out_list )
     if( ${CMAKE_VERSION} VERSION_LESS "3.6" )
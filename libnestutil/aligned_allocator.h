@@ -0,0 +1,103 @@
+/*
+ *  aligned_allocator.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ALIGNED_ALLOCATOR_H
+#define ALIGNED_ALLOCATOR_H
+
+// C++ includes:
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace nest
+{
+
+/**
+ * Allocator returning memory aligned to Alignment bytes.
+ *
+ * Elements are default-initialized instead of value-initialized, so
+ * that resizing a container of plain numbers does not zero the memory
+ * before it is overwritten.
+ */
+template < typename T, std::size_t Alignment >
+class AlignedAllocator
+{
+public:
+  typedef T value_type;
+
+  template < typename U >
+  struct rebind
+  {
+    typedef AlignedAllocator< U, Alignment > other;
+  };
+
+  AlignedAllocator() = default;
+
+  template < typename U >
+  AlignedAllocator( const AlignedAllocator< U, Alignment >& )
+  {
+  }
+
+  T*
+  allocate( std::size_t n )
+  {
+    return static_cast< T* >( ::operator new( n * sizeof( T ), std::align_val_t( Alignment ) ) );
+  }
+
+  void
+  deallocate( T* p, std::size_t )
+  {
+    ::operator delete( p, std::align_val_t( Alignment ) );
+  }
+
+  template < typename U >
+  void
+  construct( U* p )
+  {
+    ::new ( static_cast< void* >( p ) ) U;
+  }
+
+  template < typename U, typename... Args >
+  void
+  construct( U* p, Args&&... args )
+  {
+    ::new ( static_cast< void* >( p ) ) U( std::forward< Args >( args )... );
+  }
+};
+
+template < typename T, typename U, std::size_t Alignment >
+bool
+operator==( const AlignedAllocator< T, Alignment >&, const AlignedAllocator< U, Alignment >& )
+{
+  return true;
+}
+
+template < typename T, typename U, std::size_t Alignment >
+bool
+operator!=( const AlignedAllocator< T, Alignment >&, const AlignedAllocator< U, Alignment >& )
+{
+  return false;
+}
+
+} // namespace nest
+
+#endif /* #ifndef ALIGNED_ALLOCATOR_H */
@@ -21,6 +21,102 @@
  */
 #include "cm_compartmentcurrents.h"
 
+// C++ includes:
+#include <iterator>
+#include <map>
+#include <tuple>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "exceptions.h"
+
+
+nest::ChannelRateTable::ChannelRateTable( const TabulatedFunction& function,
+  const size_t n_values,
+  const double tolerance )
+  : n_values_( n_values )
+  , inv_dv_( 0.0 )
+  , table_()
+  , max_error_( 0.0 )
+{
+  std::vector< double > exact( n_values );
+  std::vector< double > interpolated( n_values );
+
+  for ( size_t n_intervals = 256; n_intervals <= MAX_INTERVALS; n_intervals *= 2 )
+  {
+    const double dv = ( V_MAX - V_MIN ) / n_intervals;
+    inv_dv_ = n_intervals / ( V_MAX - V_MIN );
+
+    // one extra grid point, so that interpolation just below V_MAX never reads beyond the table
+    table_.resize( ( n_intervals + 2 ) * n_values_ );
+    for ( size_t i = 0; i < n_intervals + 2; ++i )
+    {
+      function( V_MIN + i * dv, &table_[ i * n_values_ ] );
+    }
+
+    max_error_ = 0.0;
+    for ( size_t i = 0; i < n_intervals; ++i )
+    {
+      const double v_mid = V_MIN + ( i + 0.5 ) * dv;
+      function( v_mid, exact.data() );
+      interpolate( v_mid, interpolated.data() );
+      for ( size_t k = 0; k < n_values_; ++k )
+      {
+        max_error_ = std::max( max_error_, std::abs( interpolated[ k ] - exact[ k ] ) );
+      }
+    }
+
+    if ( max_error_ <= tolerance )
+    {
+      break;
+    }
+  }
+}
+
+std::shared_ptr< const nest::ChannelRateTable >
+nest::ChannelRateTable::get( const std::string& channel,
+  const TabulatedFunction& function,
+  const size_t n_values,
+  const double tolerance )
+{
+  typedef std::tuple< std::string, double, double > Key;
+  // only weak references are kept, so that tables are freed together with the
+  // last channel using them, e.g., on ResetKernel, and tables that do not meet
+  // their tolerance are not kept at all
+  static std::map< Key, std::weak_ptr< const ChannelRateTable > > tables;
+
+  const Key key( channel, Time::get_resolution().get_ms(), tolerance );
+  std::shared_ptr< const ChannelRateTable > table;
+
+#pragma omp critical( cm_channel_rate_tables )
+  {
+    for ( auto it = tables.begin(); it != tables.end(); )
+    {
+      it = it->second.expired() ? tables.erase( it ) : std::next( it );
+    }
+
+    auto table_it = tables.find( key );
+    if ( table_it != tables.end() )
+    {
+      table = table_it->second.lock();
+    }
+    if ( not table )
+    {
+      table = std::make_shared< const ChannelRateTable >( function, n_values, tolerance );
+      tables[ key ] = table;
+    }
+  }
+
+  if ( table->max_error_ > tolerance )
+  {
+    throw BadProperty( String::compose(
+      "The rates of the %1 channel cannot be tabulated with rate_table_tolerance = %2.", channel, tolerance ) );
+  }
+  return table;
+}
+
 
 nest::Na::Na( double v_comp )
   // state variables
@@ -147,6 +243,31 @@ nest::Na::compute_statevar_h( const double v_comp )
   return std::make_pair( h_inf_Na, tau_h_Na );
 }
 
+void
+nest::Na::pre_run_hook( const double rate_table_tolerance )
+{
+  rate_table_.reset();
+
+  if ( rate_table_tolerance > 0 and gbar_Na_ > 1e-9 )
+  {
+    const double dt = Time::get_resolution().get_ms();
+    rate_table_ = ChannelRateTable::get(
+      "Na",
+      [ this, dt ]( const double v_comp, double* values )
+      {
+        std::pair< double, double > sv = compute_statevar_m( v_comp );
+        values[ 0 ] = sv.first;
+        values[ 1 ] = std::exp( -dt / sv.second );
+
+        sv = compute_statevar_h( v_comp );
+        values[ 2 ] = sv.first;
+        values[ 3 ] = std::exp( -dt / sv.second );
+      },
+      4,
+      rate_table_tolerance );
+  }
+}
+
 std::pair< double, double >
 nest::Na::f_numstep( const double v_comp )
 {
@@ -155,23 +276,35 @@ nest::Na::f_numstep( const double v_comp )
 
   if ( gbar_Na_ > 1e-9 )
   {
-    std::pair< double, double > sv( 0., 0. );
-
-    sv = compute_statevar_m( v_comp );
-    double m_inf_Na = sv.first;
-    double tau_m_Na = sv.second;
-
-    sv = compute_statevar_h( v_comp );
-    double h_inf_Na = sv.first;
-    double tau_h_Na = sv.second;
+    double m_inf_Na, p_m_Na, h_inf_Na, p_h_Na;
+
+    if ( rate_table_ and rate_table_->in_range( v_comp ) )
+    {
+      double values[ 4 ];
+      rate_table_->interpolate( v_comp, values );
+      m_inf_Na = values[ 0 ];
+      p_m_Na = values[ 1 ];
+      h_inf_Na = values[ 2 ];
+      p_h_Na = values[ 3 ];
+    }
+    else
+    {
+      std::pair< double, double > sv( 0., 0. );
+
+      sv = compute_statevar_m( v_comp );
+      m_inf_Na = sv.first;
+      p_m_Na = std::exp( -dt / sv.second );
+
+      sv = compute_statevar_h( v_comp );
+      h_inf_Na = sv.first;
+      p_h_Na = std::exp( -dt / sv.second );
+    }
 
     // advance state variable 'm' one timestep
-    double p_m_Na = std::exp( -dt / tau_m_Na );
     m_Na_ *= p_m_Na;
     m_Na_ += ( 1. - p_m_Na ) * m_inf_Na;
 
     // advance state variable 'h' one timestep
-    double p_h_Na = std::exp( -dt / tau_h_Na );
     h_Na_ *= p_h_Na;
     h_Na_ += ( 1. - p_h_Na ) * h_inf_Na;
 
@@ -270,6 +403,27 @@ nest::K::compute_statevar_n( const double v_comp )
   return std::make_pair( n_inf_K, tau_n_K );
 }
 
+void
+nest::K::pre_run_hook( const double rate_table_tolerance )
+{
+  rate_table_.reset();
+
+  if ( rate_table_tolerance > 0 and gbar_K_ > 1e-9 )
+  {
+    const double dt = Time::get_resolution().get_ms();
+    rate_table_ = ChannelRateTable::get(
+      "K",
+      [ this, dt ]( const double v_comp, double* values )
+      {
+        std::pair< double, double > sv = compute_statevar_n( v_comp );
+        values[ 0 ] = sv.first;
+        values[ 1 ] = std::exp( -dt / sv.second );
+      },
+      2,
+      rate_table_tolerance );
+  }
+}
+
 std::pair< double, double >
 nest::K::f_numstep( const double v_comp )
 {
@@ -278,13 +432,24 @@ nest::K::f_numstep( const double v_comp )
 
   if ( gbar_K_ > 1e-9 )
   {
-    std::pair< double, double > sv( 0., 0. );
-    sv = compute_statevar_n( v_comp );
-    double n_inf_K = sv.first;
-    double tau_n_K = sv.second;
-
-    // advance state variable 'm' one timestep
-    double p_n_K = std::exp( -dt / tau_n_K );
+    double n_inf_K, p_n_K;
+
+    if ( rate_table_ and rate_table_->in_range( v_comp ) )
+    {
+      double values[ 2 ];
+      rate_table_->interpolate( v_comp, values );
+      n_inf_K = values[ 0 ];
+      p_n_K = values[ 1 ];
+    }
+    else
+    {
+      std::pair< double, double > sv( 0., 0. );
+      sv = compute_statevar_n( v_comp );
+      n_inf_K = sv.first;
+      p_n_K = std::exp( -dt / sv.second );
+    }
+
+    // advance state variable 'n' one timestep
     n_K_ *= p_n_K;
     n_K_ += ( 1. - p_n_K ) * n_inf_K;
 
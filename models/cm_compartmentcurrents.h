@@ -24,11 +24,82 @@
 
 #include <stdlib.h>
 
+// C++ includes:
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "ring_buffer.h"
 
 namespace nest
 {
 
+/**
+ * Ion channel functions of the compartment voltage, tabulated on an
+ * equidistant voltage grid and evaluated by linear interpolation.
+ *
+ * The grid spacing is halved until the interpolated values deviate from
+ * the tabulated function by at most the given tolerance at the midpoints
+ * between all grid points. Voltages outside of [V_MIN, V_MAX] are not
+ * tabulated and have to be evaluated by the channel itself.
+ *
+ * Tables depend on the resolution only through the tabulated function, and
+ * are shared by all channels of the same type through get(). A table lives
+ * as long as a channel uses it.
+ */
+class ChannelRateTable
+{
+public:
+  //! fills the n_values values of the tabulated function at the given voltage
+  typedef std::function< void( double, double* ) > TabulatedFunction;
+
+  static constexpr double V_MIN = -150.0; //!< mV
+  static constexpr double V_MAX = 100.0;  //!< mV
+
+  ChannelRateTable( const TabulatedFunction& function, const size_t n_values, const double tolerance );
+
+  /**
+   * Return the table of the given channel for the current resolution,
+   * creating it if necessary. Must be called outside of update(). Throws
+   * BadProperty if the tolerance cannot be met.
+   */
+  static std::shared_ptr< const ChannelRateTable > get( const std::string& channel,
+    const TabulatedFunction& function,
+    const size_t n_values,
+    const double tolerance );
+
+  bool
+  in_range( const double v ) const
+  {
+    return V_MIN <= v and v < V_MAX;
+  }
+
+  //! interpolate the tabulated values at voltage v, which must be in range
+  void
+  interpolate( const double v, double* values ) const
+  {
+    const double x = ( v - V_MIN ) * inv_dv_;
+    const size_t i = static_cast< size_t >( x );
+    const double w = x - i;
+    const double* lower = &table_[ i * n_values_ ];
+    const double* upper = lower + n_values_;
+    for ( size_t k = 0; k < n_values_; ++k )
+    {
+      values[ k ] = lower[ k ] + w * ( upper[ k ] - lower[ k ] );
+    }
+  }
+
+private:
+  //! largest number of grid intervals, tables are refined at most up to this size
+  static constexpr size_t MAX_INTERVALS = 262144;
+
+  size_t n_values_;             //!< number of values per grid point
+  double inv_dv_;               //!< inverse grid spacing, 1/mV
+  std::vector< double > table_; //!< values at all grid points, grid point by grid point
+  double max_error_;            //!< largest interpolation error at the midpoints of the grid
+};
+
+
 
 /**
  * Channel taken from the following .mod file:
@@ -58,13 +129,18 @@ private:
   //! temperature factor for reaction rates
   double q10_;
 
+  //! m_inf, p_m, h_inf and p_h as function of the voltage, if tabulated
+  std::shared_ptr< const ChannelRateTable > rate_table_;
+
 public:
   Na( double v_comp );
   explicit Na( double v_comp, const DictionaryDatum& channel_params );
   ~Na() {};
 
   void init_statevars( double v_init );
-  void pre_run_hook() {};
+
+  //! tabulate the rate functions if rate_table_tolerance is positive
+  void pre_run_hook( const double rate_table_tolerance );
 
   //! make the state variables of this channel accessible
   void append_recordables( std::map< Name, double* >* recordables, const long compartment_idx );
@@ -101,13 +177,18 @@ private:
   //! temperature factor for reaction rates
   double q10_;
 
+  //! n_inf and p_n as function of the voltage, if tabulated
+  std::shared_ptr< const ChannelRateTable > rate_table_;
+
 public:
   K( double v_comp );
   explicit K( double v_comp, const DictionaryDatum& channel_params );
   ~K() {};
 
   void init_statevars( double v_init );
-  void pre_run_hook() {};
+
+  //! tabulate the rate functions if rate_table_tolerance is positive
+  void pre_run_hook( const double rate_table_tolerance );
 
   //! make the state variables of this channel accessible
   void append_recordables( std::map< Name, double* >* recordables, const long compartment_idx );
@@ -420,11 +501,11 @@ public:
   ~CompartmentCurrents() {};
 
   void
-  pre_run_hook()
+  pre_run_hook( const double rate_table_tolerance )
   {
     // calibrate ion channels
-    Na_chan_.pre_run_hook();
-    K_chan_.pre_run_hook();
+    Na_chan_.pre_run_hook( rate_table_tolerance );
+    K_chan_.pre_run_hook( rate_table_tolerance );
 
     // calibrate AMPA synapses
     for ( auto syn_it = AMPA_syns_.begin(); syn_it != AMPA_syns_.end(); ++syn_it )
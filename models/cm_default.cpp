@@ -56,6 +56,7 @@ nest::cm_default::cm_default()
   , syn_buffers_( 0 )
   , logger_( *this )
   , V_th_( -55.0 )
+  , rate_table_tolerance_( 0.0 )
 {
   recordablesMap_.create( *this );
   recordables_values.resize( 0 );
@@ -67,6 +68,7 @@ nest::cm_default::cm_default( const cm_default& n )
   , syn_buffers_( n.syn_buffers_ )
   , logger_( *this )
   , V_th_( n.V_th_ )
+  , rate_table_tolerance_( n.rate_table_tolerance_ )
 {
   recordables_values.resize( 0 );
 }
@@ -79,6 +81,7 @@ void
 cm_default::get_status( DictionaryDatum& statusdict ) const
 {
   def< double >( statusdict, names::V_th, V_th_ );
+  def< double >( statusdict, names::rate_table_tolerance, rate_table_tolerance_ );
   ArchivingNode::get_status( statusdict );
 
   // add all recordables to the status dictionary
@@ -110,6 +113,15 @@ void
 nest::cm_default::set_status( const DictionaryDatum& statusdict )
 {
   updateValue< double >( statusdict, names::V_th, V_th_ );
+
+  double rate_table_tolerance = rate_table_tolerance_;
+  updateValue< double >( statusdict, names::rate_table_tolerance, rate_table_tolerance );
+  if ( rate_table_tolerance < 0 )
+  {
+    throw BadProperty( "rate_table_tolerance >= 0 required." );
+  }
+  rate_table_tolerance_ = rate_table_tolerance;
+
   ArchivingNode::set_status( statusdict );
 
   /**
@@ -312,7 +324,7 @@ nest::cm_default::pre_run_hook()
   // initialize the recordables pointers
   init_recordables_pointers_();
 
-  c_tree_.pre_run_hook();
+  c_tree_.pre_run_hook( rate_table_tolerance_ );
 }
 
 /**
@@ -148,9 +148,21 @@ injectors are in nA.
 
 The following parameters can be set in the status dictionary.
 
-=========== ======= ===========================================================
- V_th       mV      Spike threshold (default: -55.0 mV)
-=========== ======= ===========================================================
+==================== ======= ==================================================
+ V_th                 mV      Spike threshold (default: -55.0 mV)
+ rate_table_tolerance (1)     Largest error of tabulated ion channel rates
+                              (default: 0, rates are evaluated analytically)
+==================== ======= ==================================================
+
+If ``rate_table_tolerance`` is positive, the steady-state values and the
+propagators of the gating variables of the Na and K channels are tabulated
+at the beginning of each simulation on a voltage grid between -150 and
+100 mV and linearly interpolated during the update. The grid is refined until
+the interpolation error of these quantities is at most
+``rate_table_tolerance``, which avoids most evaluations of exponential
+functions in the update. Tables are shared by all neurons. If the tolerance
+cannot be reached, the simulation raises an error. Voltages outside of the
+grid are always evaluated analytically.
 
 The following parameters can be used when adding compartments using ``SetStatus()``
 
@@ -303,6 +315,9 @@ private:
   DynamicUniversalDataLogger< cm_default > logger_;
 
   double V_th_;
+
+  //! largest error of tabulated ion channel rates, 0 for analytic evaluation
+  double rate_table_tolerance_;
 };
 
 
@@ -23,9 +23,7 @@
 
 
 nest::Compartment::Compartment( const long compartment_index, const long parent_index )
-  : xx_( 0.0 )
-  , yy_( 0.0 )
-  , comp_index( compartment_index )
+  : comp_index( compartment_index )
   , p_index( parent_index )
   , parent( nullptr )
   , ca( 1.0 )
@@ -38,10 +36,6 @@ nest::Compartment::Compartment( const long compartment_index, const long parent_
   , gl__div__2( 0.0 )
   , gc__div__2( 0.0 )
   , gl__times__el( 0.0 )
-  , ff( 0.0 )
-  , gg( 0.0 )
-  , hh( 0.0 )
-  , n_passed( 0 )
   , compartment_currents( v_comp )
 {
   compartment_currents = CompartmentCurrents( v_comp );
@@ -50,9 +44,7 @@ nest::Compartment::Compartment( const long compartment_index, const long parent_
 nest::Compartment::Compartment( const long compartment_index,
   const long parent_index,
   const DictionaryDatum& compartment_params )
-  : xx_( 0.0 )
-  , yy_( 0.0 )
-  , comp_index( compartment_index )
+  : comp_index( compartment_index )
   , p_index( parent_index )
   , parent( nullptr )
   , ca( 1.0 )
@@ -65,10 +57,6 @@ nest::Compartment::Compartment( const long compartment_index,
   , gl__div__2( 0.0 )
   , gc__div__2( 0.0 )
   , gl__times__el( 0.0 )
-  , ff( 0.0 )
-  , gg( 0.0 )
-  , hh( 0.0 )
-  , n_passed( 0 )
   , compartment_currents( v_comp )
 {
   compartment_params->clear_access_flags();
@@ -85,9 +73,9 @@ nest::Compartment::Compartment( const long compartment_index,
 }
 
 void
-nest::Compartment::pre_run_hook()
+nest::Compartment::pre_run_hook( const double rate_table_tolerance )
 {
-  compartment_currents.pre_run_hook();
+  compartment_currents.pre_run_hook( rate_table_tolerance );
 
   const double dt = Time::get_resolution().get_ms();
   ca__div__dt = ca / dt;
@@ -111,54 +99,12 @@ nest::Compartment::get_recordables()
   return recordables;
 }
 
-// for matrix construction
-void
-nest::Compartment::construct_matrix_element( const long lag )
-{
-  // matrix diagonal element
-  gg = gg0;
-
-  if ( parent )
-  {
-    gg += gc__div__2;
-    // matrix off diagonal element
-    hh = -gc__div__2;
-  }
-
-  for ( auto child_it = children.begin(); child_it != children.end(); ++child_it )
-  {
-    gg += ( *child_it ).gc__div__2;
-  }
-
-  // right hand side
-  ff = ( ca__div__dt - gl__div__2 ) * v_comp + gl__times__el;
-
-  if ( parent )
-  {
-    ff -= gc__div__2 * ( v_comp - parent->v_comp );
-  }
-
-  for ( auto child_it = children.begin(); child_it != children.end(); ++child_it )
-  {
-    ff -= ( *child_it ).gc__div__2 * ( v_comp - ( *child_it ).v_comp );
-  }
-
-  // add all currents to compartment
-  std::pair< double, double > gi = compartment_currents.f_numstep( v_comp, lag );
-  gg += gi.first;
-  ff += gi.second;
-
-  // add input current
-  ff += currents.get_value( lag );
-}
-
 
 nest::CompTree::CompTree()
   : root_( -1, -1 )
   , size_( 0 )
 {
   compartments_.resize( 0 );
-  leafs_.resize( 0 );
 }
 
 /**
@@ -280,7 +226,7 @@ nest::CompTree::init_pointers()
 {
   set_parents();
   set_compartments();
-  set_leafs();
+  set_flat_structure();
 }
 
 /**
@@ -316,19 +262,48 @@ nest::CompTree::set_compartments()
 }
 
 /**
- * Creates a vector of compartment pointers of compartments that are also leafs of the tree.
+ * Stores the tree structure as indices into `compartments_`, so that the matrix
+ * can be constructed and solved by loops over contiguous arrays.
+ *
+ * As a parent has to be added before its children, the position of every
+ * compartment in `compartments_` is larger than the position of its parent.
+ * Traversing `compartments_` backwards hence visits all children before their
+ * parent, as required by the down sweep, and forwards all parents before their
+ * children, as required by the up sweep.
  */
 void
-nest::CompTree::set_leafs()
+nest::CompTree::set_flat_structure()
 {
-  leafs_.clear();
-  for ( auto compartment_it = compartments_.begin(); compartment_it != compartments_.end(); ++compartment_it )
+  const long n_comps = compartments_.size();
+
+  parent_indices_.resize( n_comps );
+  children_begin_.resize( n_comps + 1 );
+  children_.clear();
+  for ( long i = 0; i < n_comps; ++i )
   {
-    if ( int( ( *compartment_it )->children.size() ) == 0 )
+    Compartment* compartment = compartments_[ i ];
+    parent_indices_[ i ] = compartment->parent ? compartment->parent->comp_index : -1;
+    assert( parent_indices_[ i ] < i );
+
+    children_begin_[ i ] = children_.size();
+    for ( auto child_it = compartment->children.begin(); child_it != compartment->children.end(); ++child_it )
     {
-      leafs_.push_back( *compartment_it );
+      children_.push_back( ( *child_it ).comp_index );
     }
   }
+  children_begin_[ n_comps ] = children_.size();
+
+  gg_passive_.assign( n_comps, 0.0 );
+  ff_leak_.assign( n_comps, 0.0 );
+  gl_el_.assign( n_comps, 0.0 );
+  gc_half_.assign( n_comps, 0.0 );
+
+  v_.assign( n_comps, 0.0 );
+  gg_.assign( n_comps, 0.0 );
+  hh_.assign( n_comps, 0.0 );
+  ff_.assign( n_comps, 0.0 );
+  xx_.assign( n_comps, 0.0 );
+  yy_.assign( n_comps, 0.0 );
 }
 
 /**
@@ -367,7 +342,7 @@ nest::CompTree::get_recordables()
  * Initialize state variables
  */
 void
-nest::CompTree::pre_run_hook()
+nest::CompTree::pre_run_hook( const double rate_table_tolerance )
 {
   if ( root_.comp_index < 0 )
   {
@@ -378,7 +353,31 @@ nest::CompTree::pre_run_hook()
   // initialize the compartments
   for ( auto compartment_it = compartments_.begin(); compartment_it != compartments_.end(); ++compartment_it )
   {
-    ( *compartment_it )->pre_run_hook();
+    ( *compartment_it )->pre_run_hook( rate_table_tolerance );
+  }
+
+  // collect the passive matrix coefficients
+  const long n_comps = compartments_.size();
+  for ( long i = 0; i < n_comps; ++i )
+  {
+    const Compartment* compartment = compartments_[ i ];
+    gc_half_[ i ] = parent_indices_[ i ] >= 0 ? compartment->gc__div__2 : 0.0;
+    ff_leak_[ i ] = compartment->ca__div__dt - compartment->gl__div__2;
+    gl_el_[ i ] = compartment->gl__times__el;
+  }
+
+  for ( long i = 0; i < n_comps; ++i )
+  {
+    double gg = compartments_[ i ]->gg0;
+    if ( parent_indices_[ i ] >= 0 )
+    {
+      gg += gc_half_[ i ];
+    }
+    for ( long k = children_begin_[ i ]; k < children_begin_[ i + 1 ]; ++k )
+    {
+      gg += gc_half_[ children_[ k ] ];
+    }
+    gg_passive_[ i ] = gg;
   }
 }
 
@@ -411,9 +410,48 @@ nest::CompTree::get_compartment_voltage( const long compartment_index )
 void
 nest::CompTree::construct_matrix( const long lag )
 {
-  for ( auto compartment_it = compartments_.begin(); compartment_it != compartments_.end(); ++compartment_it )
+  const long n_comps = compartments_.size();
+
+  for ( long i = 0; i < n_comps; ++i )
   {
-    ( *compartment_it )->construct_matrix_element( lag );
+    v_[ i ] = compartments_[ i ]->v_comp;
+  }
+
+  for ( long i = 0; i < n_comps; ++i )
+  {
+    const double v_comp = v_[ i ];
+
+    // matrix diagonal element
+    double gg = gg_passive_[ i ];
+
+    // right hand side
+    double ff = ff_leak_[ i ] * v_comp + gl_el_[ i ];
+
+    const long p_idx = parent_indices_[ i ];
+    if ( p_idx >= 0 )
+    {
+      // matrix off diagonal element
+      hh_[ i ] = -gc_half_[ i ];
+      ff -= gc_half_[ i ] * ( v_comp - v_[ p_idx ] );
+    }
+
+    for ( long k = children_begin_[ i ]; k < children_begin_[ i + 1 ]; ++k )
+    {
+      const long c_idx = children_[ k ];
+      ff -= gc_half_[ c_idx ] * ( v_comp - v_[ c_idx ] );
+    }
+
+    // add all currents to compartment
+    Compartment* compartment = compartments_[ i ];
+    std::pair< double, double > gi = compartment->compartment_currents.f_numstep( v_comp, lag );
+    gg += gi.first;
+    ff += gi.second;
+
+    // add input current
+    ff += compartment->currents.get_value( lag );
+
+    gg_[ i ] = gg;
+    ff_[ i ] = ff;
   }
 }
 
@@ -423,56 +461,34 @@ nest::CompTree::construct_matrix( const long lag )
 void
 nest::CompTree::solve_matrix()
 {
-  std::vector< Compartment* >::iterator leaf_it = leafs_.begin();
+  const long n_comps = compartments_.size();
 
-  // start the down sweep (puts to zero the sub diagonal matrix elements)
-  solve_matrix_downsweep( leafs_[ 0 ], leaf_it );
-
-  // do up sweep to set voltages
-  solve_matrix_upsweep( &root_, 0.0 );
-}
+  // down sweep, puts to zero the sub diagonal matrix elements
+  for ( long i = n_comps - 1; i > 0; --i )
+  {
+    // include inputs from child compartments
+    gg_[ i ] -= xx_[ i ];
+    ff_[ i ] -= yy_[ i ];
 
-void
-nest::CompTree::solve_matrix_downsweep( Compartment* compartment, std::vector< Compartment* >::iterator leaf_it )
-{
-  // compute the input output transformation at compartment
-  std::pair< double, double > output = compartment->io();
+    const long p_idx = parent_indices_[ i ];
+    xx_[ p_idx ] += hh_[ i ] * hh_[ i ] / gg_[ i ];
+    yy_[ p_idx ] += ff_[ i ] * hh_[ i ] / gg_[ i ];
+  }
+  gg_[ 0 ] -= xx_[ 0 ];
+  ff_[ 0 ] -= yy_[ 0 ];
 
-  // move on to the parent layer
-  if ( compartment->parent )
+  // up sweep to set voltages
+  v_[ 0 ] = ff_[ 0 ] / gg_[ 0 ];
+  for ( long i = 1; i < n_comps; ++i )
   {
-    Compartment* parent = compartment->parent;
-    // gather input from child layers
-    parent->gather_input( output );
-    // move on to next compartments
-    ++parent->n_passed;
-    if ( parent->n_passed == int( parent->children.size() ) )
-    {
-      parent->n_passed = 0;
-      // move on to next compartment
-      solve_matrix_downsweep( parent, leaf_it );
-    }
-    else
-    {
-      // start at next leaf
-      ++leaf_it;
-      if ( leaf_it != leafs_.end() )
-      {
-        solve_matrix_downsweep( *leaf_it, leaf_it );
-      }
-    }
+    v_[ i ] = ( ff_[ i ] - v_[ parent_indices_[ i ] ] * hh_[ i ] ) / gg_[ i ];
   }
-}
 
-void
-nest::CompTree::solve_matrix_upsweep( Compartment* compartment, double vv )
-{
-  // compute compartment voltage
-  vv = compartment->calc_v( vv );
-  // move on to child compartments
-  for ( auto child_it = compartment->children.begin(); child_it != compartment->children.end(); ++child_it )
+  for ( long i = 0; i < n_comps; ++i )
   {
-    solve_matrix_upsweep( &( *child_it ), vv );
+    compartments_[ i ]->v_comp = v_[ i ];
+    xx_[ i ] = 0.0;
+    yy_[ i ] = 0.0;
   }
 }
 
@@ -50,11 +50,6 @@ namespace nest
 
 class Compartment
 {
-private:
-  //! aggragators for numerical integration
-  double xx_;
-  double yy_;
-
 public:
   //! compartment index
   long comp_index;
@@ -81,12 +76,6 @@ public:
   double gl__div__2;
   double gc__div__2;
   double gl__times__el;
-  //! for numerical integration
-  double ff;
-  double gg;
-  double hh;
-  //! passage counter for recursion
-  int n_passed;
 
   //! vector for synapses
   CompartmentCurrents compartment_currents;
@@ -95,58 +84,12 @@ public:
   Compartment( const long compartment_index, const long parent_index, const DictionaryDatum& compartment_params );
   ~Compartment() {};
 
-  // initialization
-  void pre_run_hook();
+  // initialization, rate_table_tolerance > 0 enables tabulated ion channel rates
+  void pre_run_hook( const double rate_table_tolerance );
   std::map< Name, double* > get_recordables();
-
-  //! matrix construction
-  void construct_matrix_element( const long lag );
-
-  //! maxtrix inversion
-  inline void gather_input( const std::pair< double, double >& in );
-  inline std::pair< double, double > io();
-  inline double calc_v( const double v_in );
 }; // Compartment
 
 
-/*
-Short helper functions for solving the matrix equation. Can hopefully be inlined
-*/
-inline void
-nest::Compartment::gather_input( const std::pair< double, double >& in )
-{
-  xx_ += in.first;
-  yy_ += in.second;
-}
-
-inline std::pair< double, double >
-nest::Compartment::io()
-{
-  // include inputs from child compartments
-  gg -= xx_;
-  ff -= yy_;
-
-  // output values
-  double g_val( hh * hh / gg );
-  double f_val( ff * hh / gg );
-
-  return std::make_pair( g_val, f_val );
-}
-
-inline double
-nest::Compartment::calc_v( const double v_in )
-{
-  // reset recursion variables
-  xx_ = 0.0;
-  yy_ = 0.0;
-
-  // compute voltage
-  v_comp = ( ff - v_in * hh ) / gg;
-
-  return v_comp;
-}
-
-
 class CompTree
 {
 private:
@@ -156,18 +99,39 @@ private:
   mutable Compartment root_;
   std::vector< long > compartment_indices_;
   std::vector< Compartment* > compartments_;
-  std::vector< Compartment* > leafs_;
 
   long size_ = 0;
 
-  //! recursion functions for matrix inversion
-  void solve_matrix_downsweep( Compartment* compartment_ptr, std::vector< Compartment* >::iterator leaf_it );
-  void solve_matrix_upsweep( Compartment* compartment, double vv );
+  /**
+  flattened tree structure, indexed by the position of the compartments in
+  `compartments_`, in which every parent precedes its children
+  */
+  std::vector< long > parent_indices_; //!< position of the parent, -1 for the root
+  std::vector< long > children_begin_; //!< children of i start at children_[ children_begin_[ i ] ]
+  std::vector< long > children_;       //!< positions of the children of all compartments
+
+  /**
+  passive matrix coefficients, set in pre_run_hook()
+  */
+  std::vector< double > gg_passive_; //!< diagonal element without channel currents
+  std::vector< double > ff_leak_;    //!< factor of the compartment voltage in the right hand side
+  std::vector< double > gl_el_;      //!< leak current in the right hand side
+  std::vector< double > gc_half_;    //!< half of the coupling conductance with the parent, 0 for the root
+
+  /**
+  numerical integration variables
+  */
+  std::vector< double > v_;  //!< compartment voltages
+  std::vector< double > gg_; //!< matrix diagonal
+  std::vector< double > hh_; //!< matrix element coupling compartment and parent
+  std::vector< double > ff_; //!< right hand side
+  std::vector< double > xx_; //!< diagonal contributions of the children in the down sweep
+  std::vector< double > yy_; //!< right hand side contributions of the children in the down sweep
 
   //! functions for pointer initialization
   void set_parents();
   void set_compartments();
-  void set_leafs();
+  void set_flat_structure();
 
 public:
   CompTree();
@@ -179,7 +143,7 @@ public:
   void add_compartment( Compartment* compartment, const long parent_index );
 
   //! initialize the tree for simulation
-  void pre_run_hook();
+  void pre_run_hook( const double rate_table_tolerance );
 
   //! fix all pointers in the tree, the tree structure should not be modified between calling
   //! this function and starting the simulation
@@ -214,7 +178,7 @@ public:
 
   //! construct the numerical integration matrix and vector
   void construct_matrix( const long lag );
-  //! solve the matrix equation for next timestep voltage
+  //! solve the matrix equation for next timestep voltage, as constructed by construct_matrix()
   void solve_matrix();
 
   //! print function
@@ -23,8 +23,8 @@
 #include "correlomatrix_detector.h"
 
 // C++ includes:
-#include <cmath>      // for less
-#include <functional> // for bind2nd
+#include <algorithm> // for lower_bound, upper_bound
+#include <cstdlib>   // for abs
 
 // Includes from libnestutil:
 #include "compose.hpp"
@@ -102,8 +102,10 @@ nest::correlomatrix_detector::Parameters_::operator=( const Parameters_& p )
 nest::correlomatrix_detector::State_::State_()
   : n_events_( 1, 0 )
   , incoming_()
-  , covariance_( 1, std::vector< std::vector< double > >( 1, std::vector< double >() ) )
-  , count_covariance_( 1, std::vector< std::vector< long > >( 1, std::vector< long >() ) )
+  , N_channels_( 1 )
+  , n_bins_( 0 )
+  , covariance_()
+  , count_covariance_()
 {
 }
 
@@ -129,14 +131,17 @@ nest::correlomatrix_detector::State_::get( DictionaryDatum& d ) const
 
   ArrayDatum* C = new ArrayDatum;
   ArrayDatum* CountC = new ArrayDatum;
-  for ( size_t i = 0; i < covariance_.size(); ++i )
+  for ( size_t i = 0; i < N_channels_; ++i )
   {
     ArrayDatum* C_i = new ArrayDatum;
     ArrayDatum* CountC_i = new ArrayDatum;
-    for ( size_t j = 0; j < covariance_[ i ].size(); ++j )
+    for ( size_t j = 0; j < N_channels_; ++j )
     {
-      C_i->push_back( new DoubleVectorDatum( new std::vector< double >( covariance_[ i ][ j ] ) ) );
-      CountC_i->push_back( new IntVectorDatum( new std::vector< long >( count_covariance_[ i ][ j ] ) ) );
+      const size_t begin = index_( i, j );
+      C_i->push_back( new DoubleVectorDatum(
+        new std::vector< double >( covariance_.begin() + begin, covariance_.begin() + begin + n_bins_ ) ) );
+      CountC_i->push_back( new IntVectorDatum( new std::vector< long >(
+        count_covariance_.begin() + begin, count_covariance_.begin() + begin + n_bins_ ) ) );
     }
     C->push_back( *C_i );
     CountC->push_back( *CountC_i );
@@ -222,22 +227,11 @@ nest::correlomatrix_detector::State_::reset( const Parameters_& p )
 
   assert( p.tau_max_.is_multiple_of( p.delta_tau_ ) );
 
-  covariance_.clear();
-  covariance_.resize( p.N_channels_ );
-
-  count_covariance_.clear();
-  count_covariance_.resize( p.N_channels_ );
+  N_channels_ = p.N_channels_;
+  n_bins_ = 1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps();
 
-  for ( long i = 0; i < p.N_channels_; ++i )
-  {
-    covariance_[ i ].resize( p.N_channels_ );
-    count_covariance_[ i ].resize( p.N_channels_ );
-    for ( long j = 0; j < p.N_channels_; ++j )
-    {
-      covariance_[ i ][ j ].resize( 1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps(), 0 );
-      count_covariance_[ i ][ j ].resize( 1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps(), 0 );
-    }
-  }
+  covariance_.assign( N_channels_ * N_channels_ * n_bins_, 0.0 );
+  count_covariance_.assign( N_channels_ * N_channels_ * n_bins_, 0 );
 }
 
 /* ----------------------------------------------------------------
@@ -312,18 +306,15 @@ nest::correlomatrix_detector::handle( SpikeEvent& e )
   {
     const long spike_i = stamp.get_steps();
 
-    // find first appearence of element which is greater than spike_i
+    // insert before the first element which is greater than spike_i, or at
+    // the end of the deque if there is none
     const Spike_ sp_i( spike_i, e.get_multiplicity() * e.get_weight(), sender );
-    SpikelistType::iterator insert_pos = std::find_if(
-      S_.incoming_.begin(), S_.incoming_.end(), std::bind( std::greater< Spike_ >(), std::placeholders::_1, sp_i ) );
-
-    // insert before the position we have found
-    // if no element greater found, insert_pos == end(), so append at the end of
-    // the deque
+    SpikelistType::iterator insert_pos = std::upper_bound( S_.incoming_.begin(), S_.incoming_.end(), sp_i );
     S_.incoming_.insert( insert_pos, sp_i );
 
     SpikelistType& otherSpikes = S_.incoming_;
-    const double tau_edge = P_.tau_max_.get_steps() + 0.5 * P_.delta_tau_.get_steps();
+    const long delta_tau = P_.delta_tau_.get_steps();
+    const double tau_edge = P_.tau_max_.get_steps() + 0.5 * delta_tau;
 
     // throw away all spikes which are too old to
     // enter the correlation window
@@ -346,9 +337,19 @@ nest::correlomatrix_detector::handle( SpikeEvent& e )
 
       S_.n_events_[ sender ]++; // count this spike
 
-      for ( SpikelistType::const_iterator spike_j = otherSpikes.begin(); spike_j != otherSpikes.end(); ++spike_j )
+      // spikes further than tau_edge from spike_i fall beyond the last bin,
+      // so that only spikes in [spike_i - tau_edge, spike_i + tau_edge] need
+      // to be visited
+      const long max_lag = static_cast< long >( tau_edge );
+      const SpikelistType::const_iterator first = std::lower_bound(
+        otherSpikes.cbegin(), otherSpikes.cend(), Spike_( spike_i - max_lag, 0.0, 0 ) );
+      const SpikelistType::const_iterator last =
+        std::upper_bound( first, otherSpikes.cend(), Spike_( spike_i + max_lag, 0.0, 0 ) );
+
+      const double weight_i = e.get_multiplicity() * e.get_weight();
+
+      for ( SpikelistType::const_iterator spike_j = first; spike_j != last; ++spike_j )
       {
-        size_t bin;
         long other = spike_j->receptor_channel_;
         long sender_ind, other_ind;
 
@@ -363,32 +364,28 @@ nest::correlomatrix_detector::handle( SpikeEvent& e )
           other_ind = other;
         }
 
-        if ( sender_ind <= other_ind )
-        {
-          bin = -1.
-            * std::floor( ( 0.5 * P_.delta_tau_.get_steps() - std::abs( spike_i - spike_j->timestep_ ) )
-              / P_.delta_tau_.get_steps() );
-        }
-        else
-        {
-          bin = std::floor( ( 0.5 * P_.delta_tau_.get_steps() + std::abs( spike_i - spike_j->timestep_ ) )
-            / P_.delta_tau_.get_steps() );
-        }
+        // bins are centered around multiples of delta_tau; as delta_tau is an
+        // odd number of steps, no lag lies on a bin border and the bin is
+        // lag / delta_tau rounded to the nearest integer
+        const long lag = std::abs( spike_i - spike_j->timestep_ );
+        const size_t bin = ( 2 * lag + delta_tau ) / ( 2 * delta_tau );
 
-        if ( bin < S_.covariance_[ sender_ind ][ other_ind ].size() )
+        if ( bin < S_.n_bins_ )
         {
+          const size_t pos = S_.index_( sender_ind, other_ind ) + bin;
+          const bool mirror = bin == 0 and ( lag != 0 or other != static_cast< long >( sender ) );
+
           // weighted histogram
-          S_.covariance_[ sender_ind ][ other_ind ][ bin ] += e.get_multiplicity() * e.get_weight() * spike_j->weight_;
-          if ( bin == 0 and ( spike_i - spike_j->timestep_ != 0 or other != sender ) )
+          S_.covariance_[ pos ] += weight_i * spike_j->weight_;
+          if ( mirror )
           {
-            S_.covariance_[ other_ind ][ sender_ind ][ bin ] +=
-              e.get_multiplicity() * e.get_weight() * spike_j->weight_;
+            S_.covariance_[ S_.index_( other_ind, sender_ind ) ] += weight_i * spike_j->weight_;
           }
           // pure (unweighted) count histogram
-          S_.count_covariance_[ sender_ind ][ other_ind ][ bin ] += e.get_multiplicity();
-          if ( bin == 0 and ( spike_i - spike_j->timestep_ != 0 or other != sender ) )
+          S_.count_covariance_[ pos ] += e.get_multiplicity();
+          if ( mirror )
           {
-            S_.count_covariance_[ other_ind ][ sender_ind ][ bin ] += e.get_multiplicity();
+            S_.count_covariance_[ S_.index_( other_ind, sender_ind ) ] += e.get_multiplicity();
           }
         }
       }
@@ -85,6 +85,11 @@ specified receptor will be pooled.
 
 Correlomatrix detectors ignore any connection delays.
 
+The histograms are stored contiguously and take 16 bytes per bin, i.e.,
+:math:`16 \cdot N_{channels}^2 \cdot (\tau_{max}/\delta_\tau + 1)` bytes
+in total. For each incoming spike, only the stored spikes within
+:math:`\tau_{max} + \delta_\tau/2` of it are visited.
+
 Parameters
 ++++++++++
 
@@ -221,12 +226,12 @@ private:
     }
 
     /**
-     * Greater operator needed for insertion sort.
+     * Less operator needed for binary search in the sorted deque.
      */
     inline bool
-    operator>( const Spike_& second ) const
+    operator<( const Spike_& second ) const
     {
-      return timestep_ > second.timestep_;
+      return timestep_ < second.timestep_;
     }
   };
 
@@ -276,17 +281,29 @@ private:
   {
     std::vector< long > n_events_; //!< spike counters
     SpikelistType incoming_;       //!< incoming spikes, sorted
-                                   /** Weighted covariance matrix.
-                                    *  @note Data type is double to accommodate weights.
-                                    */
-    std::vector< std::vector< std::vector< double > > > covariance_;
 
-    /** Unweighted covariance matrix.
+    size_t N_channels_; //!< number of channels the histograms are sized for
+    size_t n_bins_;     //!< number of bins per histogram
+
+    /** Weighted covariance matrix, stored contiguously with the bins of
+     *  entry (i, j) starting at index_( i, j ).
+     *  @note Data type is double to accommodate weights.
+     */
+    std::vector< double > covariance_;
+
+    /** Unweighted covariance matrix, stored like covariance_.
      */
-    std::vector< std::vector< std::vector< long > > > count_covariance_;
+    std::vector< long > count_covariance_;
 
     State_(); //!< initialize default state
 
+    //! position of the first bin of the histogram of channels i and j
+    size_t
+    index_( const size_t i, const size_t j ) const
+    {
+      return ( i * N_channels_ + j ) * n_bins_;
+    }
+
     void get( DictionaryDatum& ) const;
 
     /**
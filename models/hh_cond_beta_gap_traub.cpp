@@ -402,6 +402,7 @@ nest::hh_cond_beta_gap_traub::init_buffers_()
   B_.last_y_values.resize( kernel().connection_manager.get_min_delay(), 0.0 );
 
   B_.sumj_g_ij_ = 0.0;
+  B_.wfr_input_cache_.clear();
 
   ArchivingNode::clear_history();
 
@@ -617,6 +618,13 @@ nest::hh_cond_beta_gap_traub::update_( Time const& origin,
     }
 
     std::vector< double >( kernel().connection_manager.get_min_delay(), 0.0 ).swap( B_.last_y_values );
+
+    // the next interval starts with a new input
+    B_.wfr_input_cache_.clear();
+  }
+  else
+  {
+    B_.wfr_input_cache_.store( B_.interpolation_coefficients, B_.sumj_g_ij_, new_coefficients );
   }
 
   // Send gap-event
@@ -631,6 +639,23 @@ nest::hh_cond_beta_gap_traub::update_( Time const& origin,
   return wfr_tol_exceeded;
 }
 
+bool
+nest::hh_cond_beta_gap_traub::wfr_update( Time const& origin, const long from, const long to )
+{
+  // A node whose input has not changed noticeably since its last update
+  // would compute the same coefficients, so that it only sends them again.
+  if ( B_.wfr_input_cache_.resend_if_unchanged( *this, B_.interpolation_coefficients, B_.sumj_g_ij_ ) )
+  {
+    return true;
+  }
+
+  State_ old_state = S_; // save state before wfr_update
+  const bool wfr_tol_exceeded = update_( origin, from, to, true );
+  S_ = old_state; // restore old state
+
+  return not wfr_tol_exceeded;
+}
+
 void
 nest::hh_cond_beta_gap_traub::handle( SpikeEvent& e )
 {
@@ -43,6 +43,7 @@
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
+#include "wfr_input_cache.h"
 
 namespace nest
 {
@@ -387,6 +388,8 @@ public:
 
     // summarized coefficients of the interpolation polynomial
     std::vector< double > interpolation_coefficients;
+    // gap junction input and output of the last wfr_update
+    WfrInputCache wfr_input_cache_;
 
     /**
      * Input current injected by CurrentEvent.
@@ -423,16 +426,6 @@ hh_cond_beta_gap_traub::update( Time const& origin, const long from, const long
   update_( origin, from, to, false );
 }
 
-inline bool
-hh_cond_beta_gap_traub::wfr_update( Time const& origin, const long from, const long to )
-{
-  State_ old_state = S_; // save state before wfr_update
-  const bool wfr_tol_exceeded = update_( origin, from, to, true );
-  S_ = old_state; // restore old state
-
-  return not wfr_tol_exceeded;
-}
-
 inline size_t
 hh_cond_beta_gap_traub::send_test_event( Node& target, size_t receptor_type, synindex, bool )
 {
@@ -42,6 +42,7 @@
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
+#include "wfr_input_cache.h"
 
 namespace nest
 {
@@ -330,6 +331,8 @@ private:
     double sumj_g_ij_;
     // summarized coefficients of the interpolation polynomial
     std::vector< double > interpolation_coefficients;
+    // gap junction input and output of the last wfr_update
+    WfrInputCache wfr_input_cache_;
 
     /**
      * Input current injected by CurrentEvent.
@@ -384,16 +387,6 @@ hh_psc_alpha_gap::update( Time const& origin, const long from, const long to )
   update_( origin, from, to, false );
 }
 
-inline bool
-hh_psc_alpha_gap::wfr_update( Time const& origin, const long from, const long to )
-{
-  State_ old_state = S_; // save state before wfr_update
-  const bool wfr_tol_exceeded = update_( origin, from, to, true );
-  S_ = old_state; // restore old state
-
-  return not wfr_tol_exceeded;
-}
-
 inline size_t
 hh_psc_alpha_gap::send_test_event( Node& target, size_t receptor_type, synindex, bool )
 {
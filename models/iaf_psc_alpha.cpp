@@ -58,7 +58,7 @@ void
 RecordablesMap< iaf_psc_alpha >::create()
 {
   // use standard names wherever you can for consistency!
-  insert_( names::V_m, &iaf_psc_alpha::get_V_m_ );
+  insert_( names::V_m, &iaf_psc_alpha::get_V_m_, &iaf_psc_alpha::set_V_m_ );
   insert_( names::I_syn_ex, &iaf_psc_alpha::get_I_syn_ex_ );
   insert_( names::I_syn_in, &iaf_psc_alpha::get_I_syn_in_ );
 }
@@ -62,7 +62,7 @@ void
 RecordablesMap< iaf_psc_delta >::create()
 {
   // use standard names wherever you can for consistency!
-  insert_( names::V_m, &iaf_psc_delta::get_V_m_ );
+  insert_( names::V_m, &iaf_psc_delta::get_V_m_, &iaf_psc_delta::set_V_m_ );
 }
 
 /* ----------------------------------------------------------------
@@ -357,6 +357,13 @@ private:
     return S_.y3_ + P_.E_L_;
   }
 
+  //! Set the real membrane potential, used by NodeManager::set_values()
+  void
+  set_V_m_( const double V_m )
+  {
+    S_.y3_ = V_m - P_.E_L_;
+  }
+
   // ----------------------------------------------------------------
 
   /**
@@ -61,7 +61,7 @@ void
 RecordablesMap< iaf_psc_exp >::create()
 {
   // use standard names wherever you can for consistency!
-  insert_( names::V_m, &iaf_psc_exp::get_V_m_ );
+  insert_( names::V_m, &iaf_psc_exp::get_V_m_, &iaf_psc_exp::set_V_m_ );
   insert_( names::I_syn_ex, &iaf_psc_exp::get_I_syn_ex_ );
   insert_( names::I_syn_in, &iaf_psc_exp::get_I_syn_in_ );
 }
@@ -438,6 +438,13 @@ private:
     return S_.V_m_ + P_.E_L_;
   }
 
+  //! Set the real membrane potential, used by NodeManager::set_values()
+  inline void
+  set_V_m_( const double V_m )
+  {
+    S_.V_m_ = V_m - P_.E_L_;
+  }
+
   inline double
   get_I_syn_ex_() const
   {
@@ -22,6 +22,12 @@
 
 #include "multimeter.h"
 
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 // Includes from nestkernel:
 #include "event_delivery_manager_impl.h"
 #include "model_manager_impl.h"
@@ -30,6 +36,26 @@
 // Includes from libnestutil:
 #include "dict_util.h"
 
+namespace
+{
+/**
+ * Map node ID and seed to a number in [0, 1).
+ *
+ * Uses the finalizer of the SplitMix64 generator, so that the choice of
+ * targets depends neither on the number of threads nor on the order of
+ * connections.
+ */
+double
+subset_hash( const size_t node_id, const long seed )
+{
+  uint64_t z = static_cast< uint64_t >( node_id ) + 0x9e3779b97f4a7c15ULL * ( static_cast< uint64_t >( seed ) + 1 );
+  z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+  z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+  z = z ^ ( z >> 31 );
+  return ( z >> 11 ) * ( 1.0 / 9007199254740992.0 );
+}
+}
+
 namespace nest
 {
 void
@@ -62,7 +88,7 @@ multimeter::multimeter( const multimeter& n )
 size_t
 multimeter::send_test_event( Node& target, size_t receptor_type, synindex, bool )
 {
-  DataLoggingRequest e( P_.interval_, P_.offset_, P_.record_from_ );
+  DataLoggingRequest e( P_.interval_, P_.offset_, P_.record_from_, P_.push_samples_ ? &B_.sample_block_ : nullptr );
   e.set_sender( *this );
   size_t p = target.handles_test_event( e, receptor_type );
   if ( p != invalid_port and not is_model_prototype() )
@@ -76,6 +102,12 @@ nest::multimeter::Parameters_::Parameters_()
   : interval_( Time::ms( 1.0 ) )
   , offset_( Time::ms( 0. ) )
   , record_from_()
+  , push_samples_( false )
+  , reductions_()
+  , decimation_( 1 )
+  , filter_tau_( 0.0 )
+  , subset_fraction_( 1.0 )
+  , subset_seed_( 0 )
 {
 }
 
@@ -83,6 +115,12 @@ nest::multimeter::Parameters_::Parameters_( const Parameters_& p )
   : interval_( p.interval_ )
   , offset_( p.offset_ )
   , record_from_( p.record_from_ )
+  , push_samples_( p.push_samples_ )
+  , reductions_( p.reductions_ )
+  , decimation_( p.decimation_ )
+  , filter_tau_( p.filter_tau_ )
+  , subset_fraction_( p.subset_fraction_ )
+  , subset_seed_( p.subset_seed_ )
 {
   interval_.calibrate();
 }
@@ -93,15 +131,73 @@ nest::multimeter::Parameters_::operator=( const Parameters_& p )
   interval_ = p.interval_;
   offset_ = p.offset_;
   record_from_ = p.record_from_;
+  push_samples_ = p.push_samples_;
+  reductions_ = p.reductions_;
+  decimation_ = p.decimation_;
+  filter_tau_ = p.filter_tau_;
+  subset_fraction_ = p.subset_fraction_;
+  subset_seed_ = p.subset_seed_;
   interval_.calibrate();
 
   return *this;
 }
 
 
+bool
+nest::multimeter::Parameters_::processes_samples() const
+{
+  return not reductions_.empty() or decimation_ > 1 or filter_tau_ > 0.0 or subset_fraction_ < 1.0;
+}
+
+
 nest::multimeter::Buffers_::Buffers_()
   : has_targets_( false )
+  , written_until_( -1 )
+  , reductions_( 2 )
+{
+}
+
+void
+nest::multimeter::Buffers_::Reduction_::reset( size_t num_vars )
 {
+  stamp_ = -1;
+  n_ = 0;
+  sum_.assign( num_vars, 0.0 );
+  sum_sq_.assign( num_vars, 0.0 );
+  min_.assign( num_vars, std::numeric_limits< double >::infinity() );
+  max_.assign( num_vars, -std::numeric_limits< double >::infinity() );
+}
+
+void
+nest::multimeter::Buffers_::Reduction_::add( const double* values )
+{
+  for ( size_t j = 0; j < sum_.size(); ++j )
+  {
+    sum_[ j ] += values[ j ];
+    sum_sq_[ j ] += values[ j ] * values[ j ];
+    min_[ j ] = std::min( min_[ j ], values[ j ] );
+    max_[ j ] = std::max( max_[ j ], values[ j ] );
+  }
+  ++n_;
+}
+
+void
+nest::multimeter::Buffers_::Reduction_::add( const Reduction_& other )
+{
+  if ( other.n_ == 0 )
+  {
+    return;
+  }
+
+  stamp_ = other.stamp_;
+  for ( size_t j = 0; j < sum_.size(); ++j )
+  {
+    sum_[ j ] += other.sum_[ j ];
+    sum_sq_[ j ] += other.sum_sq_[ j ];
+    min_[ j ] = std::min( min_[ j ], other.min_[ j ] );
+    max_[ j ] = std::max( max_[ j ], other.max_[ j ] );
+  }
+  n_ += other.n_;
 }
 
 void
@@ -115,18 +211,30 @@ nest::multimeter::Parameters_::get( DictionaryDatum& d ) const
     ad.push_back( LiteralDatum( record_from_[ j ] ) );
   }
   ( *d )[ names::record_from ] = ad;
+  ( *d )[ names::push_samples ] = push_samples_;
+  ArrayDatum reductions;
+  for ( const Name& reduction : reductions_ )
+  {
+    reductions.push_back( LiteralDatum( reduction ) );
+  }
+  ( *d )[ names::reductions ] = reductions;
+  ( *d )[ names::decimation ] = decimation_;
+  ( *d )[ names::filter_tau ] = filter_tau_;
+  ( *d )[ names::subset_fraction ] = subset_fraction_;
+  ( *d )[ names::subset_seed ] = subset_seed_;
 }
 
 void
 nest::multimeter::Parameters_::set( const DictionaryDatum& d, const Buffers_& b, Node* node )
 {
   if ( b.has_targets_
-    and ( d->known( names::interval ) or d->known( names::offset ) or d->known( names::record_from ) ) )
+    and ( d->known( names::interval ) or d->known( names::offset ) or d->known( names::record_from )
+      or d->known( names::push_samples ) or d->known( names::reductions ) ) )
   {
     throw BadProperty(
-      "The recording interval, the interval offset and the list of properties "
-      "to record cannot be changed after the multimeter has been connected "
-      "to nodes." );
+      "The recording interval, the interval offset, the list of properties "
+      "to record, push_samples and reductions cannot be changed after the "
+      "multimeter has been connected to nodes." );
   }
 
   double v;
@@ -181,12 +289,131 @@ nest::multimeter::Parameters_::set( const DictionaryDatum& d, const Buffers_& b,
       record_from_.push_back( Name( getValue< std::string >( *t ) ) );
     }
   }
+
+  updateValueParam< bool >( d, names::push_samples, push_samples_, node );
+
+  if ( d->known( names::reductions ) )
+  {
+    std::vector< Name > reductions;
+    ArrayDatum ad = getValue< ArrayDatum >( d, names::reductions );
+    for ( Token* t = ad.begin(); t != ad.end(); ++t )
+    {
+      const Name reduction( getValue< std::string >( *t ) );
+      if ( reduction != names::mean and reduction != names::variance and reduction != names::min
+        and reduction != names::max )
+      {
+        throw BadProperty( "Reductions must be 'mean', 'variance', 'min' or 'max'." );
+      }
+      reductions.push_back( reduction );
+    }
+    reductions_ = reductions;
+  }
+
+  long decimation = decimation_;
+  if ( updateValueParam< long >( d, names::decimation, decimation, node ) )
+  {
+    if ( decimation < 1 )
+    {
+      throw BadProperty( "The decimation must be at least 1." );
+    }
+    decimation_ = decimation;
+  }
+
+  double filter_tau = filter_tau_;
+  if ( updateValueParam< double >( d, names::filter_tau, filter_tau, node ) )
+  {
+    if ( filter_tau < 0.0 )
+    {
+      throw BadProperty( "The filter time constant must not be negative." );
+    }
+    filter_tau_ = filter_tau;
+  }
+
+  double subset_fraction = subset_fraction_;
+  if ( updateValueParam< double >( d, names::subset_fraction, subset_fraction, node ) )
+  {
+    if ( subset_fraction <= 0.0 or subset_fraction > 1.0 )
+    {
+      throw BadProperty( "The subset fraction must be in (0, 1]." );
+    }
+    subset_fraction_ = subset_fraction;
+  }
+
+  updateValueParam< long >( d, names::subset_seed, subset_seed_, node );
+
+  if ( processes_samples() and not push_samples_ )
+  {
+    throw BadProperty( "Reductions, decimation, filtering and subsets require push_samples to be true." );
+  }
+}
+
+std::vector< Name >
+multimeter::get_value_names_() const
+{
+  if ( P_.reductions_.empty() )
+  {
+    return P_.record_from_;
+  }
+
+  std::vector< Name > value_names;
+  for ( const Name& recordable : P_.record_from_ )
+  {
+    for ( const Name& reduction : P_.reductions_ )
+    {
+      value_names.push_back( Name( recordable.toString() + "_" + reduction.toString() ) );
+    }
+  }
+  return value_names;
 }
 
 void
 multimeter::pre_run_hook()
 {
-  RecordingDevice::pre_run_hook( P_.record_from_, RecordingBackend::NO_LONG_VALUE_NAMES );
+  RecordingDevice::pre_run_hook( get_value_names_(), RecordingBackend::NO_LONG_VALUE_NAMES );
+
+  if ( not P_.push_samples_ )
+  {
+    return;
+  }
+
+  const size_t num_vars = P_.record_from_.size();
+  const size_t rows_per_slice = static_cast< size_t >(
+    std::ceil( kernel().connection_manager.get_min_delay() / static_cast< double >( P_.interval_.get_steps() ) ) );
+  B_.sample_block_.init( num_vars, rows_per_slice );
+
+  const std::vector< size_t >& senders = B_.sample_block_.get_senders();
+  B_.selected_.resize( senders.size() );
+  for ( size_t slot = 0; slot < senders.size(); ++slot )
+  {
+    B_.selected_[ slot ] =
+      P_.subset_fraction_ >= 1.0 or subset_hash( senders[ slot ], P_.subset_seed_ ) < P_.subset_fraction_;
+  }
+
+  // keep the filter state across calls to Run
+  B_.filtered_.resize( senders.size() * num_vars, std::numeric_limits< double >::quiet_NaN() );
+
+  if ( not P_.reductions_.empty() )
+  {
+    for ( auto& reductions : B_.reductions_ )
+    {
+      if ( reductions.size() != rows_per_slice )
+      {
+        reductions.resize( rows_per_slice );
+        for ( auto& reduction : reductions )
+        {
+          reduction.reset( num_vars );
+        }
+      }
+    }
+
+    if ( get_thread() == 0 and B_.siblings_.empty() )
+    {
+      for ( Node* sibling : kernel().node_manager.get_thread_siblings( get_node_id() ) )
+      {
+        B_.siblings_.push_back( static_cast< multimeter* >( sibling ) );
+      }
+    }
+  }
 }
 
 void
@@ -202,6 +429,20 @@ multimeter::update( Time const& origin, const long from, const long )
     return;
   }
 
+  // Our targets have written their data to our sample block.
+  if ( P_.push_samples_ )
+  {
+    write_pushed_samples_(
+      kernel().event_delivery_manager.read_toggle(), kernel().simulation_manager.get_previous_slice_origin() );
+    if ( not P_.reductions_.empty() and get_thread() == 0 )
+    {
+      // All threads have reduced the samples of two slices ago during the
+      // previous slice, which ended with a synchronization of all threads.
+      write_reductions_( kernel().event_delivery_manager.write_toggle() );
+    }
+    return;
+  }
+
   // We send a request to each of our targets.
   // The target then immediately returns a DataLoggingReply event,
   // which is caught by multimeter::handle(), which in turn
@@ -213,6 +454,193 @@ multimeter::update( Time const& origin, const long from, const long )
   kernel().event_delivery_manager.send( *this, req );
 }
 
+void
+multimeter::post_run_cleanup()
+{
+  if ( not P_.push_samples_ )
+  {
+    return;
+  }
+
+  // The samples of the last slice of the run are in the read buffer if the
+  // slice was completed and in the write buffer otherwise.
+  const bool complete = kernel().simulation_manager.get_from_step() == 0;
+  const size_t toggle =
+    complete ? kernel().event_delivery_manager.read_toggle() : kernel().event_delivery_manager.write_toggle();
+  const Time origin = complete ? kernel().simulation_manager.get_previous_slice_origin()
+                               : kernel().simulation_manager.get_slice_origin();
+  const long now = kernel().simulation_manager.get_time().get_steps();
+
+  if ( P_.reductions_.empty() )
+  {
+    write_pushed_samples_( toggle, origin );
+    B_.written_until_ = now;
+    return;
+  }
+
+  // No thread is updating nodes anymore, so thread 0 can reduce the samples
+  // of all threads, after writing the reductions of the previous slice.
+  if ( get_thread() != 0 )
+  {
+    return;
+  }
+
+  write_reductions_( 1 - toggle );
+  for ( multimeter* sibling : B_.siblings_ )
+  {
+    sibling->write_pushed_samples_( toggle, origin );
+    sibling->B_.written_until_ = now;
+  }
+  write_reductions_( toggle );
+}
+
+void
+multimeter::write_pushed_samples_( const size_t rt, const Time& origin )
+{
+  // Samples of the slice may have been written at the end of a run already.
+  const long written_until = std::max( origin.get_steps(), B_.written_until_ );
+  const auto written = [ written_until ]( const long stamp ) { return stamp > written_until; };
+
+  const std::vector< size_t >& senders = B_.sample_block_.get_senders();
+  const size_t num_vars = P_.record_from_.size();
+  const bool reduce = not P_.reductions_.empty();
+  const bool filter = P_.filter_tau_ > 0.0;
+  const double filter_decay = filter ? std::exp( -P_.interval_.get_ms() / P_.filter_tau_ ) : 0.0;
+
+  for ( size_t row = 0; row < B_.sample_block_.get_num_rows(); ++row )
+  {
+    if ( reduce )
+    {
+      B_.reductions_[ rt ][ row ].reset( num_vars );
+    }
+
+    // Only targets that were updated during the past slice have written to
+    // the row, and all of them have written data with the same time stamp.
+    const std::vector< long >& stamps = B_.sample_block_.get_stamps( rt, row );
+    const auto first_valid = std::find_if( stamps.begin(), stamps.end(), written );
+    if ( first_valid == stamps.end() )
+    {
+      continue;
+    }
+
+    const std::vector< double >& values = B_.sample_block_.get_values( rt, row );
+
+    // the filter sees every sample, before samples are dropped
+    if ( filter )
+    {
+      for ( size_t slot = 0; slot < senders.size(); ++slot )
+      {
+        if ( not written( stamps[ slot ] ) )
+        {
+          continue;
+        }
+        for ( size_t j = 0; j < num_vars; ++j )
+        {
+          double& y = B_.filtered_[ slot * num_vars + j ];
+          const double x = values[ slot * num_vars + j ];
+          y = std::isnan( y ) ? x : filter_decay * y + ( 1.0 - filter_decay ) * x;
+        }
+      }
+    }
+
+    const Time stamp = Time::step( *first_valid );
+    const long sample = ( stamp.get_steps() - P_.offset_.get_steps() ) / P_.interval_.get_steps();
+    if ( not is_active( stamp ) or sample % P_.decimation_ != 0 )
+    {
+      continue;
+    }
+
+    if ( not P_.processes_samples() and first_valid == stamps.begin()
+      and std::all_of( stamps.begin(), stamps.end(), written ) )
+    {
+      write_samples( stamp, senders, values );
+      continue;
+    }
+
+    const std::vector< double >& source = filter ? B_.filtered_ : values;
+    Buffers_::Reduction_& reduction = B_.reductions_[ rt ][ row ];
+    B_.senders_.clear();
+    B_.values_.clear();
+    for ( size_t slot = 0; slot < senders.size(); ++slot )
+    {
+      if ( not written( stamps[ slot ] ) or not B_.selected_[ slot ] )
+      {
+        continue;
+      }
+
+      if ( reduce )
+      {
+        reduction.add( source.data() + slot * num_vars );
+      }
+      else
+      {
+        B_.senders_.push_back( senders[ slot ] );
+        B_.values_.insert(
+          B_.values_.end(), source.begin() + slot * num_vars, source.begin() + ( slot + 1 ) * num_vars );
+      }
+    }
+
+    if ( reduce )
+    {
+      reduction.stamp_ = stamp.get_steps();
+    }
+    else
+    {
+      write_samples( stamp, B_.senders_, B_.values_ );
+    }
+  }
+}
+
+void
+multimeter::write_reductions_( const size_t wt )
+{
+  const size_t num_vars = P_.record_from_.size();
+
+  Buffers_::Reduction_ total;
+  for ( size_t row = 0; row < B_.reductions_[ wt ].size(); ++row )
+  {
+    total.reset( num_vars );
+    for ( multimeter* sibling : B_.siblings_ )
+    {
+      // reset the statistics so that they are written only once
+      total.add( sibling->B_.reductions_[ wt ][ row ] );
+      sibling->B_.reductions_[ wt ][ row ].reset( num_vars );
+    }
+
+    if ( total.n_ == 0 )
+    {
+      continue;
+    }
+
+    B_.values_.clear();
+    for ( size_t j = 0; j < num_vars; ++j )
+    {
+      const double mean = total.sum_[ j ] / total.n_;
+      for ( const Name& reduction : P_.reductions_ )
+      {
+        if ( reduction == names::mean )
+        {
+          B_.values_.push_back( mean );
+        }
+        else if ( reduction == names::variance )
+        {
+          B_.values_.push_back( std::max( 0.0, total.sum_sq_[ j ] / total.n_ - mean * mean ) );
+        }
+        else if ( reduction == names::min )
+        {
+          B_.values_.push_back( total.min_[ j ] );
+        }
+        else
+        {
+          B_.values_.push_back( total.max_[ j ] );
+        }
+      }
+    }
+
+    write_samples( Time::step( total.stamp_ ), { get_node_id() }, B_.values_ );
+  }
+}
+
 void
 multimeter::handle( DataLoggingReply& reply )
 {
@@ -33,6 +33,7 @@
 #include "kernel_manager.h"
 #include "nest_timeconverter.h"
 #include "recording_device.h"
+#include "sample_block.h"
 
 // Includes from sli:
 #include "dictutils.h"
@@ -122,6 +123,53 @@ interval
     A float (default: 1.0) specifying the interval in ms, at which
     data is collected from the nodes, the multimeter is connected to.
 
+push_samples
+    A Boolean (default: *false*) specifying whether the nodes write
+    their samples directly into a buffer of the multimeter. The
+    samples are still taken by each node while it is updated, as only
+    the node knows its state at the intermediate steps of a time
+    slice, but they are no longer requested from each node and copied
+    back to the multimeter individually. The multimeter then hands the
+    samples of all nodes on a thread for one point in time to the
+    recording backend at once. The events are ordered by time first
+    and node second in this case. Like ``record_from``, this property
+    must be set before the multimeter is connected.
+
+The following options reduce the amount of recorded data already
+during the simulation. They require ``push_samples`` to be *true*.
+
+reductions
+    A list (default: `[]`) of statistics across all targets to record
+    instead of the samples of the individual targets. Possible entries
+    are ``"mean"``, ``"variance"``, ``"min"`` and ``"max"``. For each
+    entry in ``record_from``, one value per statistic is recorded under
+    the name of the recordable followed by an underscore and the name of
+    the statistic, e.g., ``V_m_mean``. The ID of the multimeter is
+    recorded as sender. The statistics are computed from the targets on
+    the local MPI process and are recorded one time slice later than the
+    samples would be. The samples of the last time slice of a call to
+    ``Simulate`` or ``Run`` are recorded when the call returns. This
+    property must be set before the multimeter is connected.
+
+decimation
+    An integer (default: 1) specifying that only every n-th sample is
+    recorded.
+
+filter_tau
+    A float (default: 0.0) specifying the time constant in ms of an
+    exponential low-pass filter that is applied to the samples of each
+    target before decimation and reduction. A value of 0 disables the
+    filter.
+
+subset_fraction
+    A float (default: 1.0) specifying the fraction of the targets to
+    record from. Targets are chosen at random, but deterministically
+    from their node ID and ``subset_seed``, independent of the number
+    of threads and MPI processes.
+
+subset_seed
+    An integer (default: 0) used to choose the targets to record from.
+
 See also
 ++++++++
 
@@ -194,7 +242,19 @@ protected:
    */
   void update( Time const&, const long, const long ) override;
 
+  //! Write the pushed samples of the last slice of a run
+  void post_run_cleanup() override;
+
 private:
+  //! Hand the samples pushed after origin and not yet written to the recording backend
+  void write_pushed_samples_( const size_t rt, const Time& origin );
+
+  //! Combine the statistics of all threads in the given buffer and reset them
+  void write_reductions_( const size_t wt );
+
+  //! Recorded value names, which depend on the reductions
+  std::vector< Name > get_value_names_() const;
+
   struct Buffers_;
 
   struct Parameters_
@@ -202,6 +262,15 @@ private:
     Time interval_;                   //!< recording interval, in ms
     Time offset_;                     //!< offset relative to 0, in ms
     std::vector< Name > record_from_; //!< which data to record
+    bool push_samples_;               //!< nodes write samples to sample_block_
+    std::vector< Name > reductions_;  //!< statistics across targets to record instead of samples
+    long decimation_;                 //!< record only every n-th sample
+    double filter_tau_;               //!< time constant of low-pass filter in ms, 0 for none
+    double subset_fraction_;          //!< fraction of targets to record from
+    long subset_seed_;                //!< seed for choosing the targets to record from
+
+    //! Are samples processed before they are recorded?
+    bool processes_samples() const;
 
     Parameters_();
     Parameters_( const Parameters_& );
@@ -222,6 +291,32 @@ private:
     Buffers_();
 
     bool has_targets_;
+    long written_until_; //!< Step of the last sample written at the end of a run
+
+    SampleBlock sample_block_;      //!< Samples pushed by the targets on this thread
+    std::vector< size_t > senders_; //!< Senders of valid samples if some targets did not push
+    std::vector< double > values_;  //!< Values of valid samples if some targets did not push
+
+    std::vector< bool > selected_;   //!< Is the target in a slot of sample_block_ recorded from?
+    std::vector< double > filtered_; //!< Low-pass filtered values of each slot, NaN before first sample
+
+    //! Statistics of the samples of one thread for one sampling step
+    struct Reduction_
+    {
+      long stamp_; //!< Time stamp of the samples
+      size_t n_;   //!< Number of samples
+      std::vector< double > sum_;
+      std::vector< double > sum_sq_;
+      std::vector< double > min_;
+      std::vector< double > max_;
+
+      void reset( size_t num_vars );
+      void add( const double* values );
+      void add( const Reduction_& other );
+    };
+
+    std::vector< std::vector< Reduction_ > > reductions_; //!< Statistics per read/write toggle and row
+    std::vector< multimeter* > siblings_;                 //!< Instances on all threads, thread 0 only
   };
 
   // ------------------------------------------------------------
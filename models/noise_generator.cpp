@@ -319,12 +319,12 @@ nest::noise_generator::update( Time const& origin, const long from, const long t
     // >= in case we woke from inactivity
     if ( now >= B_.next_step_ )
     {
-      // compute new currents
+      // compute new currents, drawing the random numbers for all targets at once
+      V_.normal_dist_.fill( get_vp_specific_rng( get_thread() ), B_.amps_.data(), B_.amps_.size() );
+      const double sigma = std::sqrt( P_.std_ * P_.std_ + S_.y_1_ * P_.std_mod_ * P_.std_mod_ );
       for ( double& amp : B_.amps_ )
       {
-        amp = P_.mean_
-          + std::sqrt( P_.std_ * P_.std_ + S_.y_1_ * P_.std_mod_ * P_.std_mod_ )
-            * V_.normal_dist_( get_vp_specific_rng( get_thread() ) );
+        amp = P_.mean_ + sigma * amp;
       }
       // use now as reference, in case we woke up from inactive period
       B_.next_step_ = now + V_.dt_steps_;
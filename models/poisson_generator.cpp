@@ -49,6 +49,14 @@ nest::register_poisson_generator( const std::string& name )
 
 nest::poisson_generator::Parameters_::Parameters_()
   : rate_( 0.0 ) // spks/s
+  , bulk_draws_( false )
+{
+}
+
+nest::poisson_generator::Buffers_::Buffers_()
+  : num_targets_( 0 )
+  , next_count_( 0 )
+  , end_count_( 0 )
 {
 }
 
@@ -61,6 +69,7 @@ void
 nest::poisson_generator::Parameters_::get( DictionaryDatum& d ) const
 {
   def< double >( d, names::rate, rate_ );
+  def< bool >( d, names::bulk_draws, bulk_draws_ );
 }
 
 void
@@ -71,6 +80,7 @@ nest::poisson_generator::Parameters_::set( const DictionaryDatum& d, Node* node
   {
     throw BadProperty( "The rate cannot be negative." );
   }
+  updateValue< bool >( d, names::bulk_draws, bulk_draws_ );
 }
 
 
@@ -87,6 +97,7 @@ nest::poisson_generator::poisson_generator()
 nest::poisson_generator::poisson_generator( const poisson_generator& n )
   : StimulationDevice( n )
   , P_( n.P_ )
+  , B_() // we do not copy connections
 {
 }
 
@@ -105,6 +116,9 @@ void
 nest::poisson_generator::init_buffers_()
 {
   StimulationDevice::init_buffers();
+  B_.n_spikes_.clear();
+  B_.next_count_ = 0;
+  B_.end_count_ = 0;
 }
 
 void
@@ -113,7 +127,8 @@ nest::poisson_generator::pre_run_hook()
   StimulationDevice::pre_run_hook();
 
   // rate_ is in spks/s, dt in ms, so we have to convert from s to ms
-  poisson_distribution::param_type param( Time::get_resolution().get_ms() * P_.rate_ * 1e-3 );
+  V_.mu_ = Time::get_resolution().get_ms() * P_.rate_ * 1e-3;
+  poisson_distribution::param_type param( V_.mu_ );
   V_.poisson_dist_.param( param );
 }
 
@@ -130,6 +145,11 @@ nest::poisson_generator::update( Time const& T, const long from, const long to )
     return;
   }
 
+  if ( P_.bulk_draws_ )
+  {
+    draw_spike_counts_( from, to );
+  }
+
   for ( long lag = from; lag < to; ++lag )
   {
     if ( not StimulationDevice::is_active( T + Time::step( lag ) ) )
@@ -137,15 +157,60 @@ nest::poisson_generator::update( Time const& T, const long from, const long to )
       continue; // no spike at this lag
     }
 
+    // counts for this lag, consumed by event_hook()
+    B_.next_count_ = ( lag - from ) * B_.num_targets_;
+    B_.end_count_ = B_.next_count_ + B_.num_targets_;
+
     DSSpikeEvent se;
     kernel().event_delivery_manager.send( *this, se, lag );
   }
 }
 
+void
+nest::poisson_generator::draw_spike_counts_( const long from, const long to )
+{
+  const size_t num_counts = ( to - from ) * B_.num_targets_;
+  if ( num_counts == 0 )
+  {
+    B_.n_spikes_.clear();
+    return;
+  }
+
+  RngPtr rng = get_vp_specific_rng( get_thread() );
+
+  if ( V_.mu_ < 1.0 )
+  {
+    // Poisson splitting: distributing a Poisson number of spikes with mean num_counts * mu_
+    // uniformly over all targets and lags gives independent Poisson counts with mean mu_,
+    // but requires only about mu_ random numbers per target and lag.
+    B_.n_spikes_.assign( num_counts, 0 );
+    poisson_distribution::param_type param( num_counts * V_.mu_ );
+    const unsigned long n_total = V_.poisson_dist_( rng, param );
+    for ( unsigned long n = 0; n < n_total; ++n )
+    {
+      ++B_.n_spikes_[ rng->ulrand( num_counts ) ];
+    }
+  }
+  else
+  {
+    B_.n_spikes_.resize( num_counts );
+    V_.poisson_dist_.fill( rng, B_.n_spikes_.data(), num_counts );
+  }
+}
+
 void
 nest::poisson_generator::event_hook( DSSpikeEvent& e )
 {
-  long n_spikes = V_.poisson_dist_( get_vp_specific_rng( get_thread() ) );
+  long n_spikes;
+  if ( P_.bulk_draws_ and B_.next_count_ < B_.end_count_ )
+  {
+    n_spikes = B_.n_spikes_[ B_.next_count_++ ];
+  }
+  else
+  {
+    // default mode, or more targets than counted in bulk mode
+    n_spikes = V_.poisson_dist_( get_vp_specific_rng( get_thread() ) );
+  }
 
   if ( n_spikes > 0 ) // we must not send events with multiplicity 0
   {
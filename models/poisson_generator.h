@@ -23,6 +23,9 @@
 #ifndef POISSON_GENERATOR_H
 #define POISSON_GENERATOR_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
 #include "connection.h"
 #include "device_node.h"
@@ -55,6 +58,15 @@ this behavior and need the same spike train for all targets, you have to use a
 rate
   Mean firing rate (spikes/s)
 
+bulk_draws
+  If true, the spike counts for all targets are drawn once per
+  ``min_delay`` slice instead of one draw per target and time step
+  (default: false). Each target still receives an independent Poisson
+  spike train, but the random numbers drawn differ from the default
+  mode. For low rates, the total number of spikes in the slice is drawn
+  first and then distributed over targets and time steps, so that the
+  cost per target is much smaller than one random draw per step.
+
 Set parameters from a stimulation backend
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
@@ -125,7 +137,8 @@ private:
    */
   struct Parameters_
   {
-    double rate_; //!< process rate in Hz
+    double rate_;     //!< process rate in Hz
+    bool bulk_draws_; //!< draw spike counts for all targets once per slice
 
     Parameters_(); //!< Sets default parameter values
 
@@ -135,14 +148,33 @@ private:
 
   // ------------------------------------------------------------
 
+  struct Buffers_
+  {
+    size_t num_targets_;                   //!< number of targets on this thread
+    std::vector< unsigned long > n_spikes_; //!< spike counts drawn in bulk, for each lag and target
+    size_t next_count_;                    //!< position of the count for the next target in n_spikes_
+    size_t end_count_;                     //!< end of the counts for the current lag in n_spikes_
+
+    Buffers_();
+  };
+
+  // ------------------------------------------------------------
+
   struct Variables_
   {
     poisson_distribution poisson_dist_; //!< poisson distribution
+    double mu_;                         //!< expected number of spikes per target and time step
   };
 
   // ------------------------------------------------------------
 
+  /**
+   * Draw spike counts for all targets and all lags in [from, to) into B_.n_spikes_.
+   */
+  void draw_spike_counts_( const long from, const long to );
+
   Parameters_ P_;
+  Buffers_ B_;
   Variables_ V_;
 };
 
@@ -161,7 +193,12 @@ poisson_generator::send_test_event( Node& target, size_t receptor_type, synindex
   {
     SpikeEvent e;
     e.set_sender( *this );
-    return target.handles_test_event( e, receptor_type );
+    const size_t p = target.handles_test_event( e, receptor_type );
+    if ( p != invalid_port and not is_model_prototype() )
+    {
+      ++B_.num_targets_;
+    }
+    return p;
   }
 }
 
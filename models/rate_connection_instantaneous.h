@@ -46,6 +46,14 @@ The value of the parameter delay is ignored for connections of
 this type. To create rate connections with delay please use
 the synapse type ``rate_connection_delayed``.
 
+If the kernel attribute ``use_rate_matrix`` is set to ``True``, the
+connections of this type on each thread are assembled into a sparse
+matrix before each call to :py:func:`.Simulate`, and the input of all
+targets is computed as a matrix-vector product with the rates of the
+sources instead of delivering one event per connection. The results
+are identical. Targets with ``linear_summation`` set to ``False``
+always receive events.
+
 See also [1]_.
 
 Transmits
@@ -88,7 +96,8 @@ public:
   typedef CommonSynapseProperties CommonPropertiesType;
   typedef Connection< targetidentifierT > ConnectionBase;
 
-  static constexpr ConnectionModelProperties properties = ConnectionModelProperties::SUPPORTS_WFR;
+  static constexpr ConnectionModelProperties properties =
+    ConnectionModelProperties::SUPPORTS_WFR | ConnectionModelProperties::SUPPORTS_RATE_MATRIX;
 
   /**
    * Default Constructor.
@@ -142,6 +151,12 @@ public:
 
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
   void
   set_weight( double w )
   {
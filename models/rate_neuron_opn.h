@@ -131,6 +131,7 @@ public:
   using Node::sends_secondary_event;
 
   void handle( InstantaneousRateConnectionEvent& ) override;
+  bool get_instantaneous_rate_buffers( std::vector< double >*&, std::vector< double >*& ) override;
   void handle( DelayedRateConnectionEvent& ) override;
   void handle( DataLoggingRequest& ) override;
 
@@ -316,6 +317,20 @@ rate_neuron_opn< TNonlinearities >::wfr_update( Time const& origin, const long f
   return not wfr_tol_exceeded;
 }
 
+template < class TNonlinearities >
+inline bool
+rate_neuron_opn< TNonlinearities >::get_instantaneous_rate_buffers( std::vector< double >*& ex,
+  std::vector< double >*& in )
+{
+  if ( not P_.linear_summation_ )
+  {
+    return false;
+  }
+  ex = &B_.instant_rates_ex_;
+  in = &B_.instant_rates_in_;
+  return true;
+}
+
 template < class TNonlinearities >
 inline size_t
 rate_neuron_opn< TNonlinearities >::handles_test_event( InstantaneousRateConnectionEvent&, size_t receptor_type )
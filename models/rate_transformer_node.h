@@ -123,6 +123,7 @@ public:
   using Node::sends_secondary_event;
 
   void handle( InstantaneousRateConnectionEvent& ) override;
+  bool get_instantaneous_rate_buffers( std::vector< double >*&, std::vector< double >*& ) override;
   void handle( DelayedRateConnectionEvent& ) override;
   void handle( DataLoggingRequest& ) override;
 
@@ -260,6 +261,20 @@ rate_transformer_node< TNonlinearities >::wfr_update( Time const& origin, const
   return not wfr_tol_exceeded;
 }
 
+template < class TNonlinearities >
+inline bool
+rate_transformer_node< TNonlinearities >::get_instantaneous_rate_buffers( std::vector< double >*& ex,
+  std::vector< double >*& in )
+{
+  if ( not P_.linear_summation_ )
+  {
+    return false;
+  }
+  ex = &B_.instant_rates_;
+  in = &B_.instant_rates_;
+  return true;
+}
+
 template < class TNonlinearities >
 inline size_t
 rate_transformer_node< TNonlinearities >::handles_test_event( InstantaneousRateConnectionEvent&, size_t receptor_type )
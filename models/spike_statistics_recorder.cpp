@@ -0,0 +1,478 @@
+/*
+ *  spike_statistics_recorder.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "spike_statistics_recorder.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Includes from nestkernel:
+#include "dict_util.h"
+#include "kernel_manager.h"
+#include "model_manager_impl.h"
+#include "nest_impl.h"
+
+// Includes from sli:
+#include "dict.h"
+#include "dictutils.h"
+
+void
+nest::register_spike_statistics_recorder( const std::string& name )
+{
+  register_node_model< spike_statistics_recorder >( name );
+}
+
+
+/* ----------------------------------------------------------------
+ * Default constructors defining default parameters and state
+ * ---------------------------------------------------------------- */
+
+nest::spike_statistics_recorder::Parameters_::Parameters_()
+  : interval_( Time::ms( 100.0 ) )
+  , window_( Time::ms( 1000.0 ) )
+  , per_source_( false )
+{
+}
+
+nest::spike_statistics_recorder::Parameters_::Parameters_( const Parameters_& p )
+  : interval_( p.interval_ )
+  , window_( p.window_ )
+  , per_source_( p.per_source_ )
+{
+  interval_.calibrate();
+  window_.calibrate();
+}
+
+nest::spike_statistics_recorder::Parameters_&
+nest::spike_statistics_recorder::Parameters_::operator=( const Parameters_& p )
+{
+  interval_ = p.interval_;
+  window_ = p.window_;
+  per_source_ = p.per_source_;
+  interval_.calibrate();
+  window_.calibrate();
+
+  return *this;
+}
+
+nest::spike_statistics_recorder::SourceStatistics_::SourceStatistics_( const size_t ring_size )
+  : last_spike_( -1 )
+  , counts_( ring_size, 0 )
+  , isi_counts_( ring_size, 0 )
+  , isi_sums_( ring_size, 0.0 )
+  , isi_sq_sums_( ring_size, 0.0 )
+{
+}
+
+void
+nest::spike_statistics_recorder::SourceStatistics_::clear( const size_t slot )
+{
+  counts_[ slot ] = 0;
+  isi_counts_[ slot ] = 0;
+  isi_sums_[ slot ] = 0.0;
+  isi_sq_sums_[ slot ] = 0.0;
+}
+
+nest::spike_statistics_recorder::Buffers_::Buffers_()
+  : interval_steps_( 0 )
+  , window_size_( 0 )
+  , ring_size_( 0 )
+  , first_interval_( 0 )
+  , next_interval_( 0 )
+  , next_population_interval_( 0 )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Parameter extraction and manipulation functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics_recorder::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::interval ] = interval_.get_ms();
+  ( *d )[ names::window ] = window_.get_ms();
+  ( *d )[ names::per_source ] = per_source_;
+}
+
+void
+nest::spike_statistics_recorder::Parameters_::set( const DictionaryDatum& d, const Buffers_& b, Node* node )
+{
+  if ( b.ring_size_ > 0 and ( d->known( names::interval ) or d->known( names::window ) ) )
+  {
+    throw BadProperty(
+      "The interval and the window of the spike_statistics_recorder cannot "
+      "be changed after the simulation has started." );
+  }
+
+  double v;
+  if ( updateValueParam< double >( d, names::interval, v, node ) )
+  {
+    if ( Time( Time::ms( v ) ) < Time::get_resolution() )
+    {
+      throw BadProperty(
+        "The interval must be at least as long "
+        "as the simulation resolution." );
+    }
+
+    // see if we can represent interval as multiple of step
+    interval_ = Time::step( Time( Time::ms( v ) ).get_steps() );
+    if ( not interval_.is_multiple_of( Time::get_resolution() ) )
+    {
+      throw BadProperty(
+        "The interval must be a multiple of "
+        "the simulation resolution." );
+    }
+  }
+
+  if ( updateValueParam< double >( d, names::window, v, node ) )
+  {
+    window_ = Time::step( Time( Time::ms( v ) ).get_steps() );
+  }
+
+  if ( window_ < interval_ or not window_.is_multiple_of( interval_ ) )
+  {
+    throw BadProperty( "The window must be a multiple of the interval." );
+  }
+
+  updateValueParam< bool >( d, names::per_source, per_source_, node );
+}
+
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for device
+ * ---------------------------------------------------------------- */
+
+nest::spike_statistics_recorder::spike_statistics_recorder()
+  : RecordingDevice()
+  , P_()
+  , B_()
+{
+}
+
+nest::spike_statistics_recorder::spike_statistics_recorder( const spike_statistics_recorder& n )
+  : RecordingDevice( n )
+  , P_( n.P_ )
+  , B_()
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Device functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics_recorder::calibrate_time( const TimeConverter& tc )
+{
+  P_.interval_ = tc.from_old_tics( P_.interval_.get_tics() );
+  P_.window_ = tc.from_old_tics( P_.window_.get_tics() );
+}
+
+void
+nest::spike_statistics_recorder::pre_run_hook()
+{
+  RecordingDevice::pre_run_hook( { names::rate, names::cv_isi, names::fano_factor }, { names::n_spikes } );
+
+  if ( B_.ring_size_ == 0 )
+  {
+    B_.interval_steps_ = P_.interval_.get_steps();
+    B_.window_size_ = P_.window_.get_steps() / B_.interval_steps_;
+
+    // Spikes of up to two min_delay ahead of the last interval
+    // summarized on thread 0 can arrive before it is summarized.
+    const long lookahead = kernel().connection_manager.get_min_delay() / B_.interval_steps_ + 1;
+    B_.ring_size_ = B_.window_size_ + 4 * lookahead;
+
+    B_.first_interval_ = kernel().simulation_manager.get_time().get_steps() / B_.interval_steps_;
+    B_.next_interval_ = B_.first_interval_;
+    B_.next_population_interval_ = B_.first_interval_;
+
+    B_.population_counts_.assign( B_.ring_size_, 0 );
+    B_.cv_sums_.assign( B_.ring_size_, 0.0 );
+    B_.cv_counts_.assign( B_.ring_size_, 0 );
+    B_.population_history_.assign( B_.window_size_, 0 );
+  }
+
+  if ( get_thread() == 0 and B_.siblings_.empty() )
+  {
+    for ( Node* sibling : kernel().node_manager.get_thread_siblings( get_node_id() ) )
+    {
+      B_.siblings_.push_back( static_cast< spike_statistics_recorder* >( sibling ) );
+    }
+  }
+}
+
+void
+nest::spike_statistics_recorder::update( Time const& origin, const long, const long )
+{
+  // All spikes emitted before the beginning of this slice have been
+  // delivered to this thread when update() is called.
+  finalize_intervals_( origin.get_steps() );
+
+  // Thread 0 summarizes an interval only after all threads have finalized
+  // it during an earlier slice.
+  if ( get_thread() == 0 )
+  {
+    finalize_population_intervals_( origin.get_steps() - kernel().connection_manager.get_min_delay() );
+  }
+}
+
+void
+nest::spike_statistics_recorder::post_run_cleanup()
+{
+  // Spikes are delivered to devices when they are emitted, so all spikes
+  // of the run have arrived. No thread is updating nodes anymore, so
+  // thread 0 can finalize the remaining intervals of all threads.
+  if ( get_thread() != 0 )
+  {
+    return;
+  }
+
+  const long now = kernel().simulation_manager.get_time().get_steps();
+  for ( spike_statistics_recorder* sibling : B_.siblings_ )
+  {
+    sibling->finalize_intervals_( now );
+  }
+  finalize_population_intervals_( now );
+}
+
+void
+nest::spike_statistics_recorder::finalize_intervals_( const long until )
+{
+  while ( ( B_.next_interval_ + 1 ) * B_.interval_steps_ <= until )
+  {
+    finalize_interval_( B_.next_interval_ );
+    ++B_.next_interval_;
+  }
+}
+
+void
+nest::spike_statistics_recorder::finalize_population_intervals_( const long until )
+{
+  while ( ( B_.next_population_interval_ + 1 ) * B_.interval_steps_ <= until )
+  {
+    finalize_population_interval_( B_.next_population_interval_ );
+    ++B_.next_population_interval_;
+  }
+}
+
+void
+nest::spike_statistics_recorder::finalize_interval_( const long interval )
+{
+  const long first = std::max( B_.first_interval_, interval - B_.window_size_ + 1 );
+  const double window_ms = ( interval - first + 1 ) * P_.interval_.get_ms();
+  const size_t slot = interval % B_.ring_size_;
+
+  for ( auto& source : B_.sources_ )
+  {
+    SourceStatistics_& s = source.second;
+
+    double count_sum = 0.0;
+    double count_sq_sum = 0.0;
+    long isi_count = 0;
+    double isi_sum = 0.0;
+    double isi_sq_sum = 0.0;
+    for ( long i = first; i <= interval; ++i )
+    {
+      const size_t j = i % B_.ring_size_;
+      count_sum += s.counts_[ j ];
+      count_sq_sum += static_cast< double >( s.counts_[ j ] ) * s.counts_[ j ];
+      isi_count += s.isi_counts_[ j ];
+      isi_sum += s.isi_sums_[ j ];
+      isi_sq_sum += s.isi_sq_sums_[ j ];
+    }
+
+    const long n_intervals = interval - first + 1;
+    const double count_mean = count_sum / n_intervals;
+    const double fano_factor = count_mean > 0.0
+      ? ( count_sq_sum / n_intervals - count_mean * count_mean ) / count_mean
+      : std::numeric_limits< double >::quiet_NaN();
+
+    double cv_isi = std::numeric_limits< double >::quiet_NaN();
+    if ( isi_count >= 2 and isi_sum > 0.0 )
+    {
+      const double isi_mean = isi_sum / isi_count;
+      const double isi_var = std::max( 0.0, isi_sq_sum / isi_count - isi_mean * isi_mean );
+      cv_isi = std::sqrt( isi_var ) / isi_mean;
+
+      B_.cv_sums_[ slot ] += cv_isi;
+      ++B_.cv_counts_[ slot ];
+    }
+
+    if ( P_.per_source_ and count_sum > 0 )
+    {
+      write_summary_(
+        interval, source.first, s.counts_[ slot ], 1000.0 * count_sum / window_ms, cv_isi, fano_factor );
+    }
+
+    // the oldest interval leaves the window with the next interval
+    if ( n_intervals == B_.window_size_ )
+    {
+      s.clear( first % B_.ring_size_ );
+    }
+  }
+}
+
+void
+nest::spike_statistics_recorder::finalize_population_interval_( const long interval )
+{
+  const size_t slot = interval % B_.ring_size_;
+
+  long n_spikes = 0;
+  double cv_sum = 0.0;
+  long cv_count = 0;
+  for ( spike_statistics_recorder* sibling : B_.siblings_ )
+  {
+    n_spikes += sibling->B_.population_counts_[ slot ];
+    cv_sum += sibling->B_.cv_sums_[ slot ];
+    cv_count += sibling->B_.cv_counts_[ slot ];
+
+    sibling->B_.population_counts_[ slot ] = 0;
+    sibling->B_.cv_sums_[ slot ] = 0.0;
+    sibling->B_.cv_counts_[ slot ] = 0;
+  }
+
+  B_.population_history_[ interval % B_.window_size_ ] = n_spikes;
+
+  const long first = std::max( B_.first_interval_, interval - B_.window_size_ + 1 );
+  const long n_intervals = interval - first + 1;
+
+  double count_sum = 0.0;
+  double count_sq_sum = 0.0;
+  for ( long i = first; i <= interval; ++i )
+  {
+    const double count = B_.population_history_[ i % B_.window_size_ ];
+    count_sum += count;
+    count_sq_sum += count * count;
+  }
+
+  const double count_mean = count_sum / n_intervals;
+  const double fano_factor = count_mean > 0.0
+    ? ( count_sq_sum / n_intervals - count_mean * count_mean ) / count_mean
+    : std::numeric_limits< double >::quiet_NaN();
+  const double cv_isi = cv_count > 0 ? cv_sum / cv_count : std::numeric_limits< double >::quiet_NaN();
+  const double rate = 1000.0 * count_sum / ( n_intervals * P_.interval_.get_ms() );
+
+  write_summary_( interval, get_node_id(), n_spikes, rate, cv_isi, fano_factor );
+}
+
+void
+nest::spike_statistics_recorder::write_summary_( const long interval,
+  const size_t sender,
+  const long n_spikes,
+  const double rate,
+  const double cv_isi,
+  const double fano_factor )
+{
+  const Time end = Time::step( ( interval + 1 ) * B_.interval_steps_ );
+  if ( not is_active( end ) )
+  {
+    return;
+  }
+
+  SpikeEvent e;
+  e.set_stamp( end );
+  e.set_sender_node_id( sender );
+  write( e, { rate, cv_isi, fano_factor }, { n_spikes } );
+}
+
+nest::RecordingDevice::Type
+nest::spike_statistics_recorder::get_type() const
+{
+  return RecordingDevice::SPIKE_STATISTICS_RECORDER;
+}
+
+void
+nest::spike_statistics_recorder::get_status( DictionaryDatum& d ) const
+{
+  RecordingDevice::get_status( d );
+  P_.get( d );
+
+  if ( is_model_prototype() )
+  {
+    return; // no data to collect
+  }
+
+  // if we are the device on thread 0, also get the data from the siblings on other threads
+  if ( get_thread() == 0 )
+  {
+    const std::vector< Node* > siblings = kernel().node_manager.get_thread_siblings( get_node_id() );
+    std::vector< Node* >::const_iterator s;
+    for ( s = siblings.begin() + 1; s != siblings.end(); ++s )
+    {
+      ( *s )->get_status( d );
+    }
+  }
+}
+
+void
+nest::spike_statistics_recorder::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( d, B_, this );
+
+  RecordingDevice::set_status( d );
+  P_ = ptmp;
+}
+
+void
+nest::spike_statistics_recorder::handle( SpikeEvent& e )
+{
+  // accept spikes only if recorder was active when spike was emitted
+  if ( not is_active( e.get_stamp() ) )
+  {
+    return;
+  }
+
+  assert( e.get_multiplicity() > 0 );
+
+  const long stamp = e.get_stamp().get_steps();
+  const long interval = ( stamp - 1 ) / B_.interval_steps_;
+  assert( interval >= B_.next_interval_ );
+  const size_t slot = interval % B_.ring_size_;
+
+  auto source = B_.sources_.find( e.get_sender_node_id() );
+  if ( source == B_.sources_.end() )
+  {
+    source = B_.sources_.emplace( e.get_sender_node_id(), SourceStatistics_( B_.ring_size_ ) ).first;
+  }
+  SourceStatistics_& s = source->second;
+
+  const long multiplicity = e.get_multiplicity();
+  if ( s.last_spike_ >= 0 )
+  {
+    const double isi = Time( Time::step( stamp - s.last_spike_ ) ).get_ms();
+    s.isi_sums_[ slot ] += isi;
+    s.isi_sq_sums_[ slot ] += isi * isi;
+    ++s.isi_counts_[ slot ];
+  }
+  // multiple spikes in the same step have an inter-spike interval of zero
+  s.isi_counts_[ slot ] += multiplicity - 1;
+  s.last_spike_ = stamp;
+
+  s.counts_[ slot ] += multiplicity;
+  B_.population_counts_[ slot ] += multiplicity;
+}
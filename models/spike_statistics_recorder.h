@@ -0,0 +1,299 @@
+/*
+ *  spike_statistics_recorder.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_STATISTICS_RECORDER_H
+#define SPIKE_STATISTICS_RECORDER_H
+
+// C++ includes:
+#include <map>
+#include <vector>
+
+// Includes from nestkernel:
+#include "device_node.h"
+#include "event.h"
+#include "exceptions.h"
+#include "nest_timeconverter.h"
+#include "nest_types.h"
+#include "recording_device.h"
+
+/* BeginUserDocs: device, recorder, spike
+
+Short description
++++++++++++++++++
+
+Computing spike train statistics during the simulation
+
+Description
++++++++++++
+
+The ``spike_statistics_recorder`` collects the spikes of all neurons
+connected to it like the ``spike_recorder``, but instead of handing
+every spike to the recording backend, it only keeps running statistics
+of the spike trains. At the end of every recording ``interval``, a
+compact summary of the statistics in the sliding time ``window`` that
+ends with this interval is written to the recording backend. The
+amount of data that is written thus does not depend on the number of
+spikes.
+
+The summaries consist of the following values:
+
+n_spikes
+    The number of spikes in the last interval.
+
+rate
+    The firing rate in spikes/s in the window.
+
+cv_isi
+    The coefficient of variation of the inter-spike intervals that end
+    in the window. It is *NaN* if less than two intervals end in the
+    window.
+
+fano_factor
+    The Fano factor of the spike counts of the intervals in the window,
+    i.e., the variance of the counts divided by their mean. It is *NaN*
+    if there were no spikes in the window.
+
+A summary of the whole population of connected neurons is written with
+the ID of the recorder itself as sender at the end of every interval. For the population,
+``n_spikes`` and ``rate`` refer to the spikes of all neurons together,
+``n_spikes`` thus being the population spike time histogram (PSTH),
+and ``cv_isi`` is the mean of the coefficients of variation of all
+neurons for which it is defined. If ``per_source`` is *true*, an
+additional summary is written for every neuron that has spiked at
+least once, with the ID of the neuron as sender.
+
+The time of a summary is the end of the corresponding interval.
+Statistics are computed from the spikes of the neurons on the local MPI
+process. During a simulation, summaries are written up to two times
+the minimal delay after the end of the interval. Summaries of all
+intervals that end before or with the end of a call to ``Simulate``
+or ``Run`` are written when the call returns.
+
+::
+
+   >>> neurons = nest.Create("iaf_psc_alpha", 1000)
+   >>> ssr = nest.Create("spike_statistics_recorder", params={"interval": 100.0, "window": 1000.0})
+   >>> nest.Connect(neurons, ssr)
+
+.. include:: ../models/recording_device.rst
+
+interval
+    A float (default: 100.0) specifying the interval in ms, at which
+    summaries are written. It must be a multiple of the resolution.
+
+window
+    A float (default: 1000.0) specifying the length of the sliding
+    window in ms, in which the statistics are computed. It must be a
+    multiple of ``interval``.
+
+per_source
+    A Boolean (default: *false*) specifying whether summaries are
+    written for each neuron in addition to the population summary.
+
+The parameters ``interval`` and ``window`` cannot be changed after
+the simulation of the recorder has started.
+
+See also
+++++++++
+
+spike_recorder
+
+EndUserDocs */
+
+namespace nest
+{
+
+void register_spike_statistics_recorder( const std::string& name );
+
+/**
+ * Recorder that computes running spike train statistics.
+ *
+ * Spikes are counted per source and interval in ring buffers that
+ * hold all intervals of the sliding window. Each thread owns the
+ * statistics of the sources on that thread and finalizes an interval
+ * as soon as all spikes of the interval have been delivered to it.
+ * The instance on thread 0 then combines the population counts of all
+ * threads. It does this one slice later than the threads finalize an
+ * interval, so that all threads have finished writing the interval
+ * before the end of the previous slice, which is a synchronization
+ * point of all threads. At the end of a run, the instance on thread 0
+ * finalizes the remaining intervals of all threads.
+ */
+class spike_statistics_recorder : public RecordingDevice
+{
+
+public:
+  spike_statistics_recorder();
+  spike_statistics_recorder( const spike_statistics_recorder& );
+
+  bool
+  has_proxies() const override
+  {
+    return false;
+  }
+
+  bool
+  local_receiver() const override
+  {
+    return true;
+  }
+
+  Name
+  get_element_type() const override
+  {
+    return names::recorder;
+  }
+
+  /**
+   * Import sets of overloaded virtual functions.
+   * @see Technical Issues / Virtual Functions: Overriding, Overloading, and
+   * Hiding
+   */
+  using Node::handle;
+  using Node::handles_test_event;
+  using Node::receives_signal;
+
+  void handle( SpikeEvent& ) override;
+
+  size_t handles_test_event( SpikeEvent&, size_t ) override;
+
+  Type get_type() const override;
+  SignalType receives_signal() const override;
+
+  void get_status( DictionaryDatum& ) const override;
+  void set_status( const DictionaryDatum& ) override;
+
+  void calibrate_time( const TimeConverter& tc ) override;
+
+private:
+  void pre_run_hook() override;
+  void update( Time const&, const long, const long ) override;
+  void post_run_cleanup() override;
+
+  //! Finalize all intervals of this thread that end at or before the given step
+  void finalize_intervals_( const long until );
+
+  //! Summarize the population in all intervals that end at or before the given step
+  void finalize_population_intervals_( const long until );
+
+  //! Compute statistics of all sources for a finished interval
+  void finalize_interval_( const long interval );
+
+  //! Combine the population counts of all threads for a finished interval
+  void finalize_population_interval_( const long interval );
+
+  //! Write one summary to the recording backend
+  void write_summary_( const long interval,
+    const size_t sender,
+    const long n_spikes,
+    const double rate,
+    const double cv_isi,
+    const double fano_factor );
+
+  // ------------------------------------------------------------
+
+  struct Buffers_;
+
+  struct Parameters_
+  {
+    Time interval_;   //!< Interval between summaries
+    Time window_;     //!< Length of the sliding window
+    bool per_source_; //!< Write summaries for each source
+
+    Parameters_();
+    Parameters_( const Parameters_& );
+    Parameters_& operator=( const Parameters_& );
+
+    void get( DictionaryDatum& ) const;
+    void set( const DictionaryDatum&, const Buffers_&, Node* node );
+  };
+
+  // ------------------------------------------------------------
+
+  //! Statistics of a single source in the intervals of the sliding window
+  struct SourceStatistics_
+  {
+    long last_spike_;                   //!< Time step of the last spike of the source, -1 if none
+    std::vector< long > counts_;        //!< Number of spikes per interval
+    std::vector< long > isi_counts_;    //!< Number of inter-spike intervals ending in each interval
+    std::vector< double > isi_sums_;    //!< Sum of inter-spike intervals in ms ending in each interval
+    std::vector< double > isi_sq_sums_; //!< Sum of squared inter-spike intervals ending in each interval
+
+    explicit SourceStatistics_( const size_t ring_size );
+    void clear( const size_t slot );
+  };
+
+  // ------------------------------------------------------------
+
+  /**
+   * Ring buffers indexed by interval number modulo ring_size_.
+   *
+   * The ring buffers hold all intervals of the window plus the
+   * intervals that receive spikes before the window has been
+   * finalized.
+   */
+  struct Buffers_
+  {
+    long interval_steps_;           //!< Length of an interval in steps
+    long window_size_;              //!< Number of intervals in the window
+    size_t ring_size_;              //!< Size of the ring buffers, 0 before the first simulation
+    long first_interval_;           //!< First interval recorded
+    long next_interval_;            //!< First interval not yet finalized by this thread
+    long next_population_interval_; //!< First interval without population summary, thread 0 only
+
+    std::map< size_t, SourceStatistics_ > sources_; //!< Statistics of all sources on this thread
+
+    std::vector< long > population_counts_; //!< Number of spikes of all sources on this thread
+    std::vector< double > cv_sums_;         //!< Sum of the CVs of the sources on this thread
+    std::vector< long > cv_counts_;         //!< Number of sources on this thread with defined CV
+
+    std::vector< long > population_history_;             //!< Population counts in the window, thread 0 only
+    std::vector< spike_statistics_recorder* > siblings_; //!< Instances on all threads, thread 0 only
+
+    Buffers_();
+  };
+
+  // ------------------------------------------------------------
+
+  Parameters_ P_;
+  Buffers_ B_;
+};
+
+inline size_t
+spike_statistics_recorder::handles_test_event( SpikeEvent&, size_t receptor_type )
+{
+  if ( receptor_type != 0 )
+  {
+    throw UnknownReceptorType( receptor_type, get_name() );
+  }
+  return 0;
+}
+
+inline SignalType
+spike_statistics_recorder::receives_signal() const
+{
+  return ALL;
+}
+
+} // namespace
+
+#endif /* #ifndef SPIKE_STATISTICS_RECORDER_H */
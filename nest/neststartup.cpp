@@ -42,6 +42,7 @@
 #include "sliarray.h"
 #include "sligraphics.h"
 #include "sliregexp.h"
+#include "sliexceptions.h"
 #include "slistartup.h"
 #include "specialfunctionsmodule.h"
 
@@ -173,4 +174,29 @@ set_communicator( PyObject* )
 }
 
 #endif
+
+void
+get_current_exception( std::string& errorname, std::string& message )
+{
+  try
+  {
+    throw;
+  }
+  catch ( SLIException& e )
+  {
+    errorname = e.what();
+    message = e.message();
+  }
+  catch ( std::exception& e )
+  {
+    errorname = "CppException";
+    message = e.what();
+  }
+  catch ( ... )
+  {
+    errorname = "CppException";
+    message = "";
+  }
+}
+
 #endif //_IS_PYNEST
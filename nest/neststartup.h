@@ -56,6 +56,16 @@ SLIInterpreter& get_engine();
 // Call only with GIL
 void set_communicator( PyObject* );
 
+/**
+ * Obtain SLI error name and message of the exception currently handled.
+ *
+ * Must only be called from within a catch block, e.g., from a Cython
+ * exception handler. Exceptions not derived from SLIException are
+ * reported as CppException with their what() as message, in the same
+ * way as SLIInterpreter::raiseerror() reports them.
+ */
+void get_current_exception( std::string& errorname, std::string& message );
+
 inline bool
 nest_has_mpi4py()
 {
@@ -305,6 +305,7 @@ nest::BipartiteConnBuilder::connect()
   }
   else
   {
+    kernel().random_manager.advance_connection_stream();
     connect_();
     if ( make_symmetric_ and not creates_symmetric_connections_ )
     {
@@ -321,6 +322,7 @@ nest::BipartiteConnBuilder::connect()
       }
 
       std::swap( sources_, targets_ );
+      kernel().random_manager.advance_connection_stream();
       connect_();
       std::swap( sources_, targets_ ); // re-establish original state
     }
@@ -970,8 +972,6 @@ nest::OneToOneBuilder::connect_()
 
     try
     {
-      RngPtr rng = get_vp_specific_rng( tid );
-
       if ( loop_over_targets_() )
       {
         // A more efficient way of doing this might be to use NodeCollection's local_begin(). For this to work we
@@ -999,7 +999,7 @@ nest::OneToOneBuilder::connect_()
             continue;
           }
 
-          single_connect_( snode_id, *target, tid, rng );
+          single_connect_( snode_id, *target, tid, get_connection_rng( tid, tnode_id ) );
         }
       }
       else
@@ -1025,7 +1025,7 @@ nest::OneToOneBuilder::connect_()
             // as we iterate only over local nodes
             continue;
           }
-          single_connect_( snode_id, *target, tid, rng );
+          single_connect_( snode_id, *target, tid, get_connection_rng( tid, tnode_id ) );
         }
       }
     }
@@ -1184,8 +1184,6 @@ nest::AllToAllBuilder::connect_()
 
     try
     {
-      RngPtr rng = get_vp_specific_rng( tid );
-
       if ( loop_over_targets_() )
       {
         NodeCollection::const_iterator target_it = targets_->begin();
@@ -1199,7 +1197,7 @@ nest::AllToAllBuilder::connect_()
             continue;
           }
 
-          inner_connect_( tid, rng, target, tnode_id, true );
+          inner_connect_( tid, get_connection_rng( tid, tnode_id ), target, tnode_id, true );
         }
       }
       else
@@ -1216,7 +1214,7 @@ nest::AllToAllBuilder::connect_()
             continue;
           }
 
-          inner_connect_( tid, rng, n->get_node(), tnode_id, false );
+          inner_connect_( tid, get_connection_rng( tid, tnode_id ), n->get_node(), tnode_id, false );
         }
       }
     }
@@ -1465,8 +1463,6 @@ nest::FixedInDegreeBuilder::connect_()
 
     try
     {
-      RngPtr rng = get_vp_specific_rng( tid );
-
       if ( loop_over_targets_() )
       {
         NodeCollection::const_iterator target_it = targets_->begin();
@@ -1474,6 +1470,7 @@ nest::FixedInDegreeBuilder::connect_()
         {
           const size_t tnode_id = ( *target_it ).node_id;
           Node* const target = kernel().node_manager.get_node_or_proxy( tnode_id, tid );
+          RngPtr rng = get_connection_rng( tid, tnode_id );
 
           const long indegree_value = std::round( indegree_->value( rng, target ) );
           if ( target->is_proxy() )
@@ -1500,6 +1497,7 @@ nest::FixedInDegreeBuilder::connect_()
             continue;
           }
           auto source = n->get_node();
+          RngPtr rng = get_connection_rng( tid, tnode_id );
           const long indegree_value = std::round( indegree_->value( rng, source ) );
 
           inner_connect_( tid, rng, source, tnode_id, false, indegree_value );
@@ -1888,6 +1886,10 @@ nest::BernoulliBuilder::BernoulliBuilder( NodeCollectionPTR sources,
     }
     p_ = std::shared_ptr< Parameter >( new ConstantParameter( value ) );
   }
+
+  // third-factor connections draw from the VP-specific generator while primary connections are created
+  draw_in_bulk_ = dynamic_cast< ConstantParameter* >( p_.get() ) and all_parameters_scalar_() and not third_out_;
+  bulk_draws_.resize( kernel().vp_manager.get_num_threads() );
 }
 
 
@@ -1901,8 +1903,6 @@ nest::BernoulliBuilder::connect_()
 
     try
     {
-      RngPtr rng = get_vp_specific_rng( tid );
-
       if ( loop_over_targets_() )
       {
         NodeCollection::const_iterator target_it = targets_->begin();
@@ -1917,7 +1917,7 @@ nest::BernoulliBuilder::connect_()
             continue;
           }
 
-          inner_connect_( tid, rng, target, tnode_id );
+          inner_connect_( tid, get_connection_rng( tid, tnode_id ), target, tnode_id );
         }
       }
 
@@ -1935,7 +1935,7 @@ nest::BernoulliBuilder::connect_()
             continue;
           }
 
-          inner_connect_( tid, rng, n->get_node(), tnode_id );
+          inner_connect_( tid, get_connection_rng( tid, tnode_id ), n->get_node(), tnode_id );
         }
       }
     }
@@ -1962,6 +1962,37 @@ nest::BernoulliBuilder::inner_connect_( const int tid, RngPtr rng, Node* target,
   // It is not possible to create multapses with this type of BernoulliBuilder,
   // hence leave out corresponding checks.
 
+  if ( draw_in_bulk_ )
+  {
+    // Draw the random numbers for all sources at once; this gives the same
+    // random numbers as drawing one number per source in the loop below.
+    const double p = p_->value( rng, target );
+    const bool skip_autapse = not allow_autapses_ and sources_->get_nc_index( tnode_id ) >= 0;
+
+    std::vector< double >& draws = bulk_draws_[ tid ];
+    draws.resize( sources_->size() - ( skip_autapse ? 1 : 0 ) );
+    rng->fill_drand( draws.data(), draws.size() );
+
+    auto draw_it = draws.begin();
+    NodeCollection::const_iterator source_it = sources_->begin();
+    for ( ; source_it < sources_->end(); ++source_it )
+    {
+      const size_t snode_id = ( *source_it ).node_id;
+
+      if ( skip_autapse and snode_id == tnode_id )
+      {
+        continue;
+      }
+      if ( *draw_it++ >= p )
+      {
+        continue;
+      }
+
+      single_connect_( snode_id, *target, target_thread, rng );
+    }
+    return;
+  }
+
   NodeCollection::const_iterator source_it = sources_->begin();
   for ( ; source_it < sources_->end(); ++source_it )
   {
@@ -2019,8 +2050,6 @@ nest::PoissonBuilder::connect_()
 
     try
     {
-      RngPtr rng = get_vp_specific_rng( tid );
-
       if ( loop_over_targets_() )
       {
         NodeCollection::const_iterator target_it = targets_->begin();
@@ -2035,7 +2064,7 @@ nest::PoissonBuilder::connect_()
             continue;
           }
 
-          inner_connect_( tid, rng, target, tnode_id );
+          inner_connect_( tid, get_connection_rng( tid, tnode_id ), target, tnode_id );
         }
       }
       else
@@ -2051,7 +2080,7 @@ nest::PoissonBuilder::connect_()
           {
             continue;
           }
-          inner_connect_( tid, rng, n->get_node(), tnode_id );
+          inner_connect_( tid, get_connection_rng( tid, tnode_id ), n->get_node(), tnode_id );
         }
       }
     }
@@ -2253,18 +2282,11 @@ nest::SPBuilder::update_delay( long& d ) const
 }
 
 void
-nest::SPBuilder::sp_connect( const std::vector< size_t >& sources, const std::vector< size_t >& targets )
+nest::SPBuilder::sp_connect( const size_t tid,
+  const std::vector< size_t >& sources,
+  const std::vector< size_t >& targets )
 {
-  connect_( sources, targets );
-
-  // check if any exceptions have been raised
-  for ( size_t tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
-  {
-    if ( exceptions_raised_.at( tid ).get() )
-    {
-      throw WrappedThreadException( *( exceptions_raised_.at( tid ) ) );
-    }
-  }
+  connect_( tid, sources, targets );
 }
 
 void
@@ -2283,7 +2305,7 @@ nest::SPBuilder::connect_( NodeCollectionPTR, NodeCollectionPTR )
 }
 
 void
-nest::SPBuilder::connect_( const std::vector< size_t >& sources, const std::vector< size_t >& targets )
+nest::SPBuilder::connect_( const size_t tid, const std::vector< size_t >& sources, const std::vector< size_t >& targets )
 {
   // Code copied and adapted from OneToOneBuilder::connect_()
   // make sure that target and source population have the same size
@@ -2292,41 +2314,26 @@ nest::SPBuilder::connect_( const std::vector< size_t >& sources, const std::vect
     throw DimensionMismatch( "Source and target population must be of the same size." );
   }
 
-#pragma omp parallel
+  RngPtr rng = get_vp_specific_rng( tid );
+
+  std::vector< size_t >::const_iterator tnode_id_it = targets.begin();
+  std::vector< size_t >::const_iterator snode_id_it = sources.begin();
+  for ( ; tnode_id_it != targets.end(); ++tnode_id_it, ++snode_id_it )
   {
-    // get thread id
-    const size_t tid = kernel().vp_manager.get_thread_id();
+    assert( snode_id_it != sources.end() );
 
-    try
+    if ( *snode_id_it == *tnode_id_it and not allow_autapses_ )
     {
-      RngPtr rng = get_vp_specific_rng( tid );
-
-      std::vector< size_t >::const_iterator tnode_id_it = targets.begin();
-      std::vector< size_t >::const_iterator snode_id_it = sources.begin();
-      for ( ; tnode_id_it != targets.end(); ++tnode_id_it, ++snode_id_it )
-      {
-        assert( snode_id_it != sources.end() );
-
-        if ( *snode_id_it == *tnode_id_it and not allow_autapses_ )
-        {
-          continue;
-        }
-
-        if ( not change_connected_synaptic_elements( *snode_id_it, *tnode_id_it, tid, 1 ) )
-        {
-          skip_conn_parameter_( tid );
-          continue;
-        }
-        Node* const target = kernel().node_manager.get_node_or_proxy( *tnode_id_it, tid );
-
-        single_connect_( *snode_id_it, *target, tid, rng );
-      }
+      continue;
     }
-    catch ( std::exception& err )
+
+    if ( not change_connected_synaptic_elements( *snode_id_it, *tnode_id_it, tid, 1 ) )
     {
-      // We must create a new exception here, err's lifetime ends at
-      // the end of the catch block.
-      exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+      skip_conn_parameter_( tid );
+      continue;
     }
+    Node* const target = kernel().node_manager.get_node_or_proxy( *tnode_id_it, tid );
+
+    single_connect_( *snode_id_it, *target, tid, rng );
   }
 }
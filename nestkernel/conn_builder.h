@@ -728,6 +728,12 @@ protected:
 private:
   void inner_connect_( const int, RngPtr, Node*, size_t );
   ParameterDatum p_; //!< connection probability
+
+  //! True if exactly one random number is drawn per source, i.e., p_ is constant and all synapse parameters are scalar
+  bool draw_in_bulk_;
+
+  //! Buffers for random numbers drawn in bulk, one per thread
+  std::vector< std::vector< double > > bulk_draws_;
 };
 
 class PoissonBuilder : public BipartiteConnBuilder
@@ -819,9 +825,11 @@ public:
   void update_delay( long& d ) const;
 
   /**
-   *  @note Only for internal use by SPManager.
+   * Create the synapses between sources and targets whose targets are on thread tid.
+   *
+   *  @note Only for internal use by SPManager, which calls it on all threads.
    */
-  void sp_connect( const std::vector< size_t >& sources, const std::vector< size_t >& targets );
+  void sp_connect( const size_t tid, const std::vector< size_t >& sources, const std::vector< size_t >& targets );
 
 protected:
   //! The name of the SPBuilder; used to identify its properties in the structural_plasticity_synapses kernel attributes
@@ -832,12 +840,13 @@ protected:
   void connect_( NodeCollectionPTR sources, NodeCollectionPTR targets );
 
   /**
-   * In charge of dynamically creating the new synapses
+   * In charge of dynamically creating the new synapses on thread tid
    *
+   * @param tid thread creating the synapses of its targets
    * @param sources nodes from which synapses can be created
    * @param targets target nodes for the newly created synapses
    */
-  void connect_( const std::vector< size_t >& sources, const std::vector< size_t >& targets );
+  void connect_( const size_t tid, const std::vector< size_t >& sources, const std::vector< size_t >& targets );
 };
 
 inline void
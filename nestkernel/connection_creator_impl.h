@@ -41,6 +41,8 @@ ConnectionCreator::connect( Layer< D >& source,
   Layer< D >& target,
   NodeCollectionPTR target_nc )
 {
+  kernel().random_manager.advance_connection_stream();
+
   switch ( type_ )
   {
   case Pairwise_bernoulli_on_source:
@@ -82,7 +84,7 @@ ConnectionCreator::connect_to_target_( Iterator from,
   size_t tgt_thread,
   const Layer< D >& source )
 {
-  RngPtr rng = get_vp_specific_rng( tgt_thread );
+  RngPtr rng = get_connection_rng( tgt_thread, tgt_ptr->get_node_id() );
 
   // We create a source pos vector here that can be updated with the
   // source position. This is done to avoid creating and destroying
@@ -123,7 +125,7 @@ ConnectionCreator::connect_to_target_poisson_( Iterator from,
   size_t tgt_thread,
   const Layer< D >& source )
 {
-  RngPtr rng = get_vp_specific_rng( tgt_thread );
+  RngPtr rng = get_connection_rng( tgt_thread, tgt_ptr->get_node_id() );
 
   // We create a source pos vector here that can be updated with the
   // source position. This is done to avoid creating and destroying
@@ -503,7 +505,7 @@ ConnectionCreator::fixed_indegree_( Layer< D >& source,
       Node* const tgt = kernel().node_manager.get_node_or_proxy( target_id );
 
       size_t target_thread = tgt->get_thread();
-      RngPtr rng = get_vp_specific_rng( target_thread );
+      RngPtr rng = get_connection_rng( target_thread, target_id );
       Position< D > target_pos = target.get_position( ( *tgt_it ).nc_index );
 
       // We create a source pos vector here that can be updated with the
@@ -636,7 +638,7 @@ ConnectionCreator::fixed_indegree_( Layer< D >& source,
       size_t target_id = ( *tgt_it ).node_id;
       Node* const tgt = kernel().node_manager.get_node_or_proxy( target_id );
       size_t target_thread = tgt->get_thread();
-      RngPtr rng = get_vp_specific_rng( target_thread );
+      RngPtr rng = get_connection_rng( target_thread, target_id );
       Position< D > target_pos = target.get_position( ( *tgt_it ).nc_index );
 
       unsigned long target_number_connections = std::round( number_of_connections_->value( rng, tgt ) );
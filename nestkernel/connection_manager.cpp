@@ -76,6 +76,7 @@ nest::ConnectionManager::ConnectionManager()
   , connections_have_changed_( false )
   , get_connections_has_been_called_( false )
   , use_compressed_spikes_( true )
+  , use_rate_matrix_( false )
   , has_primary_connections_( false )
   , check_primary_connections_()
   , secondary_connections_exist_( false )
@@ -117,6 +118,7 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
     connections_have_changed_ = false;
     get_connections_has_been_called_ = false;
     use_compressed_spikes_ = true;
+    use_rate_matrix_ = false;
     stdp_eps_ = 1.0e-6;
     min_delay_ = max_delay_ = 1;
     sw_construction_connect.reset();
@@ -125,6 +127,9 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
   const size_t num_threads = kernel().vp_manager.get_num_threads();
   connections_.resize( num_threads );
   secondary_recv_buffer_pos_.resize( num_threads );
+  rate_matrices_.resize( num_threads );
+  vt_syn_ids_.clear();
+  vt_syn_ids_.resize( num_threads );
   compressed_spike_data_.resize( 0 );
 
   has_primary_connections_ = false;
@@ -141,6 +146,7 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
     const size_t tid = kernel().vp_manager.get_thread_id();
     connections_.at( tid ) = std::vector< ConnectorBase* >( num_conn_models );
     secondary_recv_buffer_pos_.at( tid ) = std::vector< std::vector< size_t > >();
+    rate_matrices_.at( tid ) = std::vector< RateMatrix >();
   } // of omp parallel
 
   source_table_.initialize();
@@ -163,6 +169,8 @@ nest::ConnectionManager::finalize( const bool adjust_number_of_threads_or_rng_on
   delete_connections_();
   std::vector< std::vector< ConnectorBase* > >().swap( connections_ );
   std::vector< std::vector< std::vector< size_t > > >().swap( secondary_recv_buffer_pos_ );
+  std::vector< std::vector< RateMatrix > >().swap( rate_matrices_ );
+  std::vector< std::map< long, std::vector< synindex > > >().swap( vt_syn_ids_ );
   compressed_spike_data_.clear();
 
   if ( not adjust_number_of_threads_or_rng_only )
@@ -200,6 +208,7 @@ nest::ConnectionManager::set_status( const DictionaryDatum& d )
   }
 
   updateValue< bool >( d, names::use_compressed_spikes, use_compressed_spikes_ );
+  updateValue< bool >( d, names::use_rate_matrix, use_rate_matrix_ );
 
   //  Need to update the saved values if we have changed the delay bounds.
   if ( d->known( names::min_delay ) or d->known( names::max_delay ) )
@@ -225,6 +234,7 @@ nest::ConnectionManager::get_status( DictionaryDatum& dict )
   def< long >( dict, names::num_connections, n );
   def< bool >( dict, names::keep_source_table, keep_source_table_ );
   def< bool >( dict, names::use_compressed_spikes, use_compressed_spikes_ );
+  def< bool >( dict, names::use_rate_matrix, use_rate_matrix_ );
 
   def< double >( dict, names::time_construction_connect, sw_construction_connect.elapsed() );
 
@@ -1037,13 +1047,42 @@ nest::ConnectionManager::trigger_update_weight( const long vt_id,
 {
   const size_t tid = kernel().vp_manager.get_thread_id();
 
-  for ( std::vector< ConnectorBase* >::iterator it = connections_[ tid ].begin(); it != connections_[ tid ].end();
-        ++it )
+  const auto vt_it = vt_syn_ids_[ tid ].find( vt_id );
+  if ( vt_it == vt_syn_ids_[ tid ].end() )
   {
-    if ( *it )
+    return;
+  }
+
+  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_connection_models( tid );
+  for ( const synindex syn_id : vt_it->second )
+  {
+    if ( connections_[ tid ][ syn_id ] )
+    {
+      connections_[ tid ][ syn_id ]->trigger_update_weight( vt_id, tid, dopa_spikes, t_trig, cm );
+    }
+  }
+}
+
+void
+nest::ConnectionManager::update_volume_transmitter_index()
+{
+  for ( size_t tid = 0; tid < vt_syn_ids_.size(); ++tid )
+  {
+    vt_syn_ids_[ tid ].clear();
+
+    const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_connection_models( tid );
+    for ( synindex syn_id = 0; syn_id < cm.size(); ++syn_id )
     {
-      ( *it )->trigger_update_weight(
-        vt_id, tid, dopa_spikes, t_trig, kernel().model_manager.get_connection_models( tid ) );
+      if ( not cm[ syn_id ] )
+      {
+        continue;
+      }
+
+      const long vt_node_id = cm[ syn_id ]->get_vt_node_id();
+      if ( vt_node_id >= 0 )
+      {
+        vt_syn_ids_[ tid ][ vt_node_id ].push_back( syn_id );
+      }
     }
   }
 }
@@ -1680,7 +1719,11 @@ nest::ConnectionManager::deliver_secondary_events( const size_t tid,
     const bool supports_wfr = conn_model.has_property( ConnectionModelProperties::SUPPORTS_WFR );
     if ( not called_from_wfr_update or supports_wfr )
     {
-      if ( positions_tid[ syn_id ].size() > 0 )
+      if ( use_rate_matrix_ and rate_matrices_[ tid ][ syn_id ].is_built() )
+      {
+        rate_matrices_[ tid ][ syn_id ].deliver( recv_buffer );
+      }
+      else if ( positions_tid[ syn_id ].size() > 0 )
       {
         SecondaryEvent& prototype = kernel().model_manager.get_secondary_event_prototype( syn_id, tid );
 
@@ -1711,6 +1754,33 @@ nest::ConnectionManager::deliver_secondary_events( const size_t tid,
   return done;
 }
 
+void
+nest::ConnectionManager::build_rate_matrices( const size_t tid )
+{
+  std::vector< RateMatrix >& matrices = rate_matrices_[ tid ];
+  if ( not use_rate_matrix_ )
+  {
+    std::vector< RateMatrix >().swap( matrices );
+    return;
+  }
+
+  const std::vector< std::vector< size_t > >& positions_tid = secondary_recv_buffer_pos_[ tid ];
+  matrices.resize( positions_tid.size() );
+  for ( synindex syn_id = 0; syn_id < positions_tid.size(); ++syn_id )
+  {
+    const ConnectorModel& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
+    if ( connections_[ tid ][ syn_id ] and positions_tid[ syn_id ].size() > 0
+      and conn_model.has_property( ConnectionModelProperties::SUPPORTS_RATE_MATRIX ) )
+    {
+      matrices[ syn_id ].build( tid, *connections_[ tid ][ syn_id ], positions_tid[ syn_id ] );
+    }
+    else
+    {
+      matrices[ syn_id ].clear();
+    }
+  }
+}
+
 void
 nest::ConnectionManager::compress_secondary_send_buffer_pos( const size_t tid )
 {
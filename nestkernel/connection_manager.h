@@ -39,6 +39,7 @@
 #include "nest_types.h"
 #include "node_collection.h"
 #include "per_thread_bool_indicator.h"
+#include "rate_matrix.h"
 #include "send_buffer_position.h"
 #include "source_table.h"
 #include "spike_data.h"
@@ -287,6 +288,16 @@ public:
   void
   trigger_update_weight( const long vt_node_id, const std::vector< spikecounter >& dopa_spikes, const double t_trig );
 
+  /**
+   * Rebuild the mapping from volume transmitter node IDs to the synapse
+   * types bound to them.
+   *
+   * Called during Prepare and whenever synapse defaults change, so that
+   * trigger_update_weight() only visits connectors of synapse types
+   * actually registered with the triggering volume transmitter.
+   */
+  void update_volume_transmitter_index();
+
   /**
    * Return minimal connection delay, which is precomputed by
    * update_delay_extrema_().
@@ -384,6 +395,20 @@ public:
    */
   bool use_compressed_spikes() const;
 
+  /**
+   * Returns whether instantaneous rate connections are delivered by
+   * sparse matrix-vector products instead of events.
+   */
+  bool use_rate_matrix() const;
+
+  /**
+   * Build the RateMatrix of every synapse model supporting it on thread
+   * tid from the current connections and their weights, or remove all
+   * matrices if use_rate_matrix is false. Called before each run, as
+   * weights and targets may change between runs.
+   */
+  void build_rate_matrices( const size_t tid );
+
   /**
    * Sorts connections in the presynaptic infrastructure by increasing
    * source node ID.
@@ -627,6 +652,12 @@ private:
 
   std::map< size_t, size_t > buffer_pos_of_source_node_id_syn_id_;
 
+  /**
+   * For each volume transmitter, the synapse types whose common
+   * properties refer to it. Structure: threads|vt node IDs|syn_ids.
+   */
+  std::vector< std::map< long, std::vector< synindex > > > vt_syn_ids_;
+
   /**
    * A structure to hold the information about targets for each
    * neuron on the presynaptic side. Internally arranged in a 3d
@@ -678,6 +709,15 @@ private:
    */
   bool use_compressed_spikes_;
 
+  //! Whether instantaneous rate connections are delivered by a RateMatrix
+  bool use_rate_matrix_;
+
+  /**
+   * Instantaneous rate connections as sparse matrices.
+   * structure: threads|synapses
+   */
+  std::vector< std::vector< RateMatrix > > rate_matrices_;
+
   //! Whether primary connections (spikes) exist.
   bool has_primary_connections_;
 
@@ -869,6 +909,12 @@ ConnectionManager::use_compressed_spikes() const
   return use_compressed_spikes_;
 }
 
+inline bool
+ConnectionManager::use_rate_matrix() const
+{
+  return use_rate_matrix_;
+}
+
 inline double
 ConnectionManager::get_stdp_eps() const
 {
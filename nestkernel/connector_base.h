@@ -149,6 +149,15 @@ public:
    */
   virtual size_t get_target_node_id( const size_t tid, const unsigned int lcid ) const = 0;
 
+  /**
+   * Append the target and the weight of every connection to targets and
+   * weights, for building a RateMatrix. The target of disabled
+   * connections is nullptr. Only available for connection models with
+   * the property SUPPORTS_RATE_MATRIX.
+   */
+  virtual void
+  get_rate_matrix_entries( const size_t tid, std::vector< Node* >& targets, std::vector< double >& weights ) const = 0;
+
   /**
    * Send the event e to all connections of this Connector.
    */
@@ -379,6 +388,25 @@ public:
     return C_[ lcid ].get_target( tid )->get_node_id();
   }
 
+  void
+  get_rate_matrix_entries( const size_t tid,
+    std::vector< Node* >& targets,
+    std::vector< double >& weights ) const override
+  {
+    if constexpr ( flag_is_set( ConnectionT::properties, ConnectionModelProperties::SUPPORTS_RATE_MATRIX ) )
+    {
+      for ( size_t lcid = 0; lcid < C_.size(); ++lcid )
+      {
+        targets.push_back( C_[ lcid ].is_disabled() ? nullptr : C_[ lcid ].get_target( tid ) );
+        weights.push_back( C_[ lcid ].get_weight() );
+      }
+    }
+    else
+    {
+      assert( false );
+    }
+  }
+
   void
   send_to_all( const size_t tid, const std::vector< ConnectorModel* >& cm, Event& e ) override
   {
@@ -436,18 +464,18 @@ public:
     const double t_trig,
     const std::vector< ConnectorModel* >& cm ) override
   {
+    // common properties are shared by all connections of this connector,
+    // so the volume transmitter needs to be checked only once
+    const typename ConnectionT::CommonPropertiesType& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+    if ( cp.get_vt_node_id() != vt_node_id )
+    {
+      return;
+    }
+
     for ( size_t i = 0; i < C_.size(); ++i )
     {
-      if ( static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )
-             ->get_common_properties()
-             .get_vt_node_id()
-        == vt_node_id )
-      {
-        C_[ i ].trigger_update_weight( tid,
-          dopa_spikes,
-          t_trig,
-          static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties() );
-      }
+      C_[ i ].trigger_update_weight( tid, dopa_spikes, t_trig, cp );
     }
   }
 
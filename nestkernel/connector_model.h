@@ -58,7 +58,8 @@ enum class ConnectionModelProperties : unsigned
   REQUIRES_SYMMETRIC = 1 << 5,
   REQUIRES_CLOPATH_ARCHIVING = 1 << 6,
   REQUIRES_URBANCZIK_ARCHIVING = 1 << 7,
-  REQUIRES_EPROP_ARCHIVING = 1 << 8
+  REQUIRES_EPROP_ARCHIVING = 1 << 8,
+  SUPPORTS_RATE_MATRIX = 1 << 9
 };
 
 template <>
@@ -110,6 +111,13 @@ public:
 
   virtual const CommonSynapseProperties& get_common_properties() const = 0;
 
+  /**
+   * Return node ID of the volume transmitter the synapse model is bound to, or -1 if there is none.
+   *
+   * Needed because CommonSynapseProperties::get_vt_node_id() is not virtual.
+   */
+  virtual long get_vt_node_id() const = 0;
+
   /**
    * Checks to see if illegal parameters are given in syn_spec.
    *
@@ -194,6 +202,12 @@ public:
     return cp_;
   }
 
+  long
+  get_vt_node_id() const override
+  {
+    return cp_.get_vt_node_id();
+  }
+
   size_t get_syn_id() const override;
   void set_syn_id( synindex syn_id ) override;
 
@@ -43,6 +43,7 @@ namespace nest
 {
 
 class Node;
+class SampleBlock;
 
 /**
  * Encapsulate information sent between nodes.
@@ -636,6 +637,10 @@ public:
    *  and vector of recordables. */
   DataLoggingRequest( const Time&, const Time&, const std::vector< Name >& );
 
+  /** Create event for given time interval, offset for interval start,
+   *  vector of recordables and block into which samples are pushed. */
+  DataLoggingRequest( const Time&, const Time&, const std::vector< Name >&, SampleBlock* );
+
   DataLoggingRequest* clone() const override;
 
   void operator()() override;
@@ -649,6 +654,9 @@ public:
   /** Access to vector of recordables. */
   const std::vector< Name >& record_from() const;
 
+  /** Access to block into which samples are pushed, nullptr if the sender pulls samples. */
+  SampleBlock* get_sample_block() const;
+
 private:
   //! Interval between two recordings, first is step 1
   Time recording_interval_;
@@ -661,6 +669,13 @@ private:
    * routine.
    */
   std::vector< Name > const* const record_from_;
+
+  /**
+   * Block into which the data loggers of the receivers write samples directly.
+   * @note This pointer shall be nullptr unless the event is sent by a connection
+   * routine of a device that has samples pushed.
+   */
+  SampleBlock* const sample_block_;
 };
 
 inline DataLoggingRequest::DataLoggingRequest()
@@ -668,6 +683,7 @@ inline DataLoggingRequest::DataLoggingRequest()
   , recording_interval_( Time::neg_inf() )
   , recording_offset_( Time::ms( 0. ) )
   , record_from_( nullptr )
+  , sample_block_( nullptr )
 {
 }
 
@@ -675,6 +691,7 @@ inline DataLoggingRequest::DataLoggingRequest( const Time& rec_int, const std::v
   : Event()
   , recording_interval_( rec_int )
   , record_from_( &recs )
+  , sample_block_( nullptr )
 {
 }
 
@@ -685,6 +702,19 @@ inline DataLoggingRequest::DataLoggingRequest( const Time& rec_int,
   , recording_interval_( rec_int )
   , recording_offset_( rec_offset )
   , record_from_( &recs )
+  , sample_block_( nullptr )
+{
+}
+
+inline DataLoggingRequest::DataLoggingRequest( const Time& rec_int,
+  const Time& rec_offset,
+  const std::vector< Name >& recs,
+  SampleBlock* sample_block )
+  : Event()
+  , recording_interval_( rec_int )
+  , recording_offset_( rec_offset )
+  , record_from_( &recs )
+  , sample_block_( sample_block )
 {
 }
 
@@ -722,6 +752,12 @@ DataLoggingRequest::record_from() const
   return *record_from_;
 }
 
+inline SampleBlock*
+DataLoggingRequest::get_sample_block() const
+{
+  return sample_block_;
+}
+
 /**
  * Provide logged data through request transmitting reference.
  *
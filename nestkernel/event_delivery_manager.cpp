@@ -48,6 +48,7 @@ namespace nest
 
 EventDeliveryManager::EventDeliveryManager()
   : off_grid_spiking_( false )
+  , compress_off_grid_spikes_( false )
   , moduli_()
   , slice_moduli_()
   , emitted_spikes_register_()
@@ -59,6 +60,8 @@ EventDeliveryManager::EventDeliveryManager()
   , recv_buffer_spike_data_()
   , send_buffer_off_grid_spike_data_()
   , recv_buffer_off_grid_spike_data_()
+  , send_buffer_compact_off_grid_spike_data_()
+  , recv_buffer_compact_off_grid_spike_data_()
   , send_buffer_target_data_()
   , recv_buffer_target_data_()
   , buffer_size_target_data_has_changed_( false )
@@ -86,6 +89,7 @@ EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_onl
 
     // Ensures that ResetKernel resets off_grid_spiking_
     off_grid_spiking_ = false;
+    compress_off_grid_spikes_ = false;
     buffer_size_target_data_has_changed_ = false;
     send_recv_buffer_shrink_limit_ = 0.2;
     send_recv_buffer_shrink_spare_ = 0.1;
@@ -139,6 +143,8 @@ EventDeliveryManager::finalize( const bool )
   recv_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
   recv_buffer_off_grid_spike_data_.clear();
+  send_buffer_compact_off_grid_spike_data_.clear();
+  recv_buffer_compact_off_grid_spike_data_.clear();
 }
 
 void
@@ -146,6 +152,8 @@ EventDeliveryManager::set_status( const DictionaryDatum& dict )
 {
   updateValue< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
 
+  updateValue< bool >( dict, names::compress_off_grid_spikes, compress_off_grid_spikes_ );
+
   double bsl = send_recv_buffer_shrink_limit_;
   if ( updateValue< double >( dict, names::spike_buffer_shrink_limit, bsl ) )
   {
@@ -181,6 +189,7 @@ void
 EventDeliveryManager::get_status( DictionaryDatum& dict )
 {
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  def< bool >( dict, names::compress_off_grid_spikes, compress_off_grid_spikes_ );
   def< unsigned long >(
     dict, names::local_spike_counter, std::accumulate( local_spike_counter_.begin(), local_spike_counter_.end(), 0 ) );
   def< double >( dict, names::spike_buffer_shrink_limit, send_recv_buffer_shrink_limit_ );
@@ -215,6 +224,8 @@ EventDeliveryManager::resize_send_recv_buffers_spike_data_()
     recv_buffer_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
     send_buffer_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
     recv_buffer_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
+    send_buffer_compact_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
+    recv_buffer_compact_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
   }
 }
 
@@ -227,6 +238,7 @@ EventDeliveryManager::configure_spike_data_buffers()
 
   send_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
+  send_buffer_compact_off_grid_spike_data_.clear();
 
   resize_send_recv_buffers_spike_data_();
 }
@@ -360,7 +372,11 @@ EventDeliveryManager::deliver_secondary_events( const size_t tid, const bool cal
 void
 EventDeliveryManager::gather_spike_data()
 {
-  if ( off_grid_spiking_ )
+  if ( off_grid_spiking_ and compress_off_grid_spikes_ )
+  {
+    gather_spike_data_( send_buffer_compact_off_grid_spike_data_, recv_buffer_compact_off_grid_spike_data_ );
+  }
+  else if ( off_grid_spiking_ )
   {
     gather_spike_data_( send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
   }
@@ -594,7 +610,11 @@ EventDeliveryManager::get_global_max_spikes_per_rank_( const SendBufferPosition&
 void
 EventDeliveryManager::deliver_events( const size_t tid )
 {
-  if ( off_grid_spiking_ )
+  if ( off_grid_spiking_ and compress_off_grid_spikes_ )
+  {
+    deliver_events_( tid, recv_buffer_compact_off_grid_spike_data_ );
+  }
+  else if ( off_grid_spiking_ )
   {
     deliver_events_( tid, recv_buffer_off_grid_spike_data_ );
   }
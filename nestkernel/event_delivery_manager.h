@@ -373,6 +373,13 @@ private:
   bool off_grid_spiking_; //!< indicates whether spikes are not constrained to
                           //!< the grid
 
+  /**
+   * Whether off-grid spikes are transmitted as CompactOffGridSpikeData,
+   * with offsets rounded to 32 bit fixed-point numbers, instead of as
+   * OffGridSpikeData with exact offsets.
+   */
+  bool compress_off_grid_spikes_;
+
   /**
    * Table of pre-computed modulos.
    *
@@ -438,6 +445,8 @@ private:
   std::vector< SpikeData > recv_buffer_spike_data_;
   std::vector< OffGridSpikeData > send_buffer_off_grid_spike_data_;
   std::vector< OffGridSpikeData > recv_buffer_off_grid_spike_data_;
+  std::vector< CompactOffGridSpikeData > send_buffer_compact_off_grid_spike_data_;
+  std::vector< CompactOffGridSpikeData > recv_buffer_compact_off_grid_spike_data_;
 
   std::vector< TargetData > send_buffer_target_data_;
   std::vector< TargetData > recv_buffer_target_data_;
@@ -28,6 +28,7 @@
 
 // Includes from nestkernel:
 #include "model.h"
+#include "recordables_map.h"
 
 namespace nest
 {
@@ -87,6 +88,10 @@ public:
 
   Node const& get_prototype() const override;
 
+  std::function< double( const Node& ) > get_recordable_getter( const Name& ) const override;
+
+  std::function< void( Node&, double ) > get_recordable_setter( const Name& ) const override;
+
   void set_model_id( int ) override;
 
   int get_model_id() override;
@@ -268,6 +273,30 @@ GenericModel< ElementT >::get_prototype() const
   return proto_;
 }
 
+template < typename ElementT >
+std::function< double( const Node& ) >
+GenericModel< ElementT >::get_recordable_getter( const Name& name ) const
+{
+  const typename RecordablesMap< ElementT >::DataAccessFct get = RecordablesMap< ElementT >::get_access_function( name );
+  if ( not get )
+  {
+    return std::function< double( const Node& ) >();
+  }
+  return [ get ]( const Node& node ) { return ( static_cast< const ElementT& >( node ).*get )(); };
+}
+
+template < typename ElementT >
+std::function< void( Node&, double ) >
+GenericModel< ElementT >::get_recordable_setter( const Name& name ) const
+{
+  const typename RecordablesMap< ElementT >::DataSetFct set = RecordablesMap< ElementT >::get_set_function( name );
+  if ( not set )
+  {
+    return std::function< void( Node&, double ) >();
+  }
+  return [ set ]( Node& node, double value ) { ( static_cast< ElementT& >( node ).*set )( value ); };
+}
+
 template < typename ElementT >
 void
 GenericModel< ElementT >::set_model_id( int i )
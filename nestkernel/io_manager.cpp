@@ -31,6 +31,7 @@
 #include <sys/types.h>
 
 // C++ includes:
+#include <chrono>
 #include <cstdlib>
 
 // Includes from libnestutil:
@@ -41,6 +42,7 @@
 #include "io_manager_impl.h"
 #include "kernel_manager.h"
 #include "recording_backend_ascii.h"
+#include "recording_backend_binary.h"
 #include "recording_backend_memory.h"
 #include "recording_backend_screen.h"
 #ifdef HAVE_MPI
@@ -50,6 +52,9 @@
 #ifdef HAVE_SIONLIB
 #include "recording_backend_sionlib.h"
 #endif
+#ifdef HAVE_SHM_OPEN
+#include "recording_backend_shm.h"
+#endif
 
 // Includes from sli:
 #include "dictutils.h"
@@ -60,11 +65,18 @@ namespace nest
 
 IOManager::IOManager()
   : overwrite_files_( false )
+  , io_bytes_pending_( 0 )
+  , io_buffer_size_( 64 * 1024 * 1024 )
+  , io_thread_stop_( false )
+  , io_error_( false )
+  , io_bytes_written_( 0 )
+  , time_io_blocked_( 0.0 )
 {
 }
 
 IOManager::~IOManager()
 {
+  stop_io_thread_();
 }
 
 void
@@ -75,6 +87,7 @@ IOManager::initialize( const bool adjust_number_of_threads_or_rng_only )
     // Register backends again, since finalize cleans up
     // so backends from external modules are unloaded
     register_recording_backend< RecordingBackendASCII >( "ascii" );
+    register_recording_backend< RecordingBackendBinary >( "binary" );
     register_recording_backend< RecordingBackendMemory >( "memory" );
     register_recording_backend< RecordingBackendScreen >( "screen" );
 #ifdef HAVE_MPI
@@ -84,6 +97,9 @@ IOManager::initialize( const bool adjust_number_of_threads_or_rng_only )
 #ifdef HAVE_SIONLIB
     register_recording_backend< RecordingBackendSIONlib >( "sionlib" );
 #endif
+#ifdef HAVE_SHM_OPEN
+    register_recording_backend< RecordingBackendSHM >( "shm" );
+#endif
 
     DictionaryDatum dict( new Dictionary );
     // The properties data_path and data_prefix can be set via environment variables
@@ -101,6 +117,11 @@ IOManager::initialize( const bool adjust_number_of_threads_or_rng_only )
     set_data_path_prefix_( dict );
 
     overwrite_files_ = false;
+
+    io_buffer_size_ = 64 * 1024 * 1024;
+    io_error_ = false;
+    io_bytes_written_ = 0;
+    time_io_blocked_ = 0.0;
   }
 
   for ( const auto& it : recording_backends_ )
@@ -116,6 +137,8 @@ IOManager::initialize( const bool adjust_number_of_threads_or_rng_only )
 void
 IOManager::finalize( const bool adjust_number_of_threads_or_rng_only )
 {
+  stop_io_thread_();
+
   for ( const auto& it : recording_backends_ )
   {
     it.second->finalize();
@@ -198,6 +221,17 @@ IOManager::set_status( const DictionaryDatum& d )
 {
   set_data_path_prefix_( d );
   updateValue< bool >( d, names::overwrite_files, overwrite_files_ );
+
+  long io_buffer_size = io_buffer_size_;
+  if ( updateValue< long >( d, names::io_buffer_size, io_buffer_size ) )
+  {
+    if ( io_buffer_size < 1 )
+    {
+      throw BadProperty( "io_buffer_size must be positive." );
+    }
+    std::lock_guard< std::mutex > lock( io_mutex_ );
+    io_buffer_size_ = io_buffer_size;
+  }
 }
 
 DictionaryDatum
@@ -216,6 +250,13 @@ IOManager::get_status( DictionaryDatum& d )
   ( *d )[ names::data_prefix ] = data_prefix_;
   ( *d )[ names::overwrite_files ] = overwrite_files_;
 
+  {
+    std::lock_guard< std::mutex > lock( io_mutex_ );
+    def< long >( d, names::io_buffer_size, io_buffer_size_ );
+    def< long >( d, names::io_bytes_written, io_bytes_written_ );
+    def< double >( d, names::time_io_blocked, time_io_blocked_ );
+  }
+
   ArrayDatum recording_backends;
   for ( const auto& it : recording_backends_ )
   {
@@ -316,6 +357,16 @@ IOManager::write( const Name backend_name,
   recording_backends_[ backend_name ]->write( device, event, double_values, long_values );
 }
 
+void
+IOManager::write_samples( const Name backend_name,
+  const RecordingDevice& device,
+  const Time& stamp,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& double_values )
+{
+  recording_backends_[ backend_name ]->write_samples( device, stamp, senders, double_values );
+}
+
 void
 IOManager::enroll_recorder( const Name backend_name, const RecordingDevice& device, const DictionaryDatum& params )
 {
@@ -392,4 +443,107 @@ IOManager::get_recording_backend_device_status( const Name backend_name,
   recording_backends_[ backend_name ]->get_device_status( device, d );
 }
 
+size_t
+IOManager::get_recorded_events( const Name backend_name,
+  const RecordingDevice& device,
+  const size_t first,
+  DictionaryDatum& events )
+{
+  return recording_backends_[ backend_name ]->get_device_events( device, first, events );
+}
+
+void
+IOManager::write_async( std::ofstream& stream, AsyncBuffer&& data )
+{
+  const size_t n_bytes = data.size();
+
+  std::unique_lock< std::mutex > lock( io_mutex_ );
+  if ( not io_thread_.joinable() )
+  {
+    io_thread_ = std::thread( &IOManager::io_thread_main_, this );
+  }
+
+  // a single buffer larger than io_buffer_size is accepted once nothing else is pending
+  if ( io_bytes_pending_ > 0 and io_bytes_pending_ + n_bytes > io_buffer_size_ )
+  {
+    const auto start = std::chrono::steady_clock::now();
+    io_data_written_.wait( lock,
+      [ this, n_bytes ]() { return io_bytes_pending_ == 0 or io_bytes_pending_ + n_bytes <= io_buffer_size_; } );
+    time_io_blocked_ += std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+  }
+
+  io_queue_.push_back( AsyncWrite { &stream, std::move( data ) } );
+  io_bytes_pending_ += n_bytes;
+  io_data_available_.notify_one();
+}
+
+void
+IOManager::wait_for_async_writes()
+{
+  std::unique_lock< std::mutex > lock( io_mutex_ );
+  if ( io_bytes_pending_ > 0 )
+  {
+    const auto start = std::chrono::steady_clock::now();
+    io_data_written_.wait( lock, [ this ]() { return io_bytes_pending_ == 0; } );
+    time_io_blocked_ += std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+  }
+
+  if ( io_error_ )
+  {
+    io_error_ = false;
+    LOG( M_ERROR, "IOManager::wait_for_async_writes()", "I/O error while writing data to file." );
+    throw IOError();
+  }
+}
+
+void
+IOManager::io_thread_main_()
+{
+  std::unique_lock< std::mutex > lock( io_mutex_ );
+  while ( true )
+  {
+    io_data_available_.wait( lock, [ this ]() { return io_thread_stop_ or not io_queue_.empty(); } );
+    if ( io_queue_.empty() )
+    {
+      return; // stop requested and all data written
+    }
+
+    AsyncWrite job = std::move( io_queue_.front() );
+    io_queue_.pop_front();
+
+    lock.unlock();
+    job.stream->write( job.data.data(), job.data.size() );
+    const bool success = job.stream->good();
+    lock.lock();
+
+    io_bytes_pending_ -= job.data.size();
+    if ( success )
+    {
+      io_bytes_written_ += job.data.size();
+    }
+    else
+    {
+      io_error_ = true;
+    }
+    io_data_written_.notify_all();
+  }
+}
+
+void
+IOManager::stop_io_thread_()
+{
+  if ( not io_thread_.joinable() )
+  {
+    return;
+  }
+
+  {
+    std::lock_guard< std::mutex > lock( io_mutex_ );
+    io_thread_stop_ = true;
+  }
+  io_data_available_.notify_one();
+  io_thread_.join();
+  io_thread_stop_ = false;
+}
+
 } // namespace nest
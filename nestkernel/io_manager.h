@@ -24,9 +24,16 @@
 #define IO_MANAGER_H
 
 // C++ includes:
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 // Includes from libnestutil:
+#include "aligned_allocator.h"
 #include "manager_interface.h"
 
 #include "recording_backend.h"
@@ -42,12 +49,21 @@ namespace nest
  * manages the recording and stimulation backends and the routing of data from
  * and to devices to and from the backends.
  *
+ * IOManager also runs an I/O thread, to which recording backends can hand
+ * buffers of data to be written to files. This keeps the latency of the file
+ * system out of the simulation loop. The amount of data waiting to be written
+ * is bounded by the kernel property io_buffer_size; threads handing over data
+ * block if the bound would be exceeded.
+ *
  * This manager is not responsible for logging and messaging to the user.
  * See LoggingManager if you are looging for that.
  */
 class IOManager : public ManagerInterface
 {
 public:
+  //! Buffer of data to be written by the I/O thread, aligned to cache lines
+  typedef std::vector< char, AlignedAllocator< char, 64 > > AsyncBuffer;
+
   IOManager();
   ~IOManager() override;
 
@@ -136,6 +152,18 @@ public:
     const std::vector< double >& double_values,
     const std::vector< long >& long_values );
 
+  /**
+   * Write one sample of each sender for the time step stamp to the given
+   * recording backend.
+   *
+   * \see RecordingBackend::write_samples()
+   */
+  void write_samples( const Name backend_name,
+    const RecordingDevice& device,
+    const Time& stamp,
+    const std::vector< size_t >& senders,
+    const std::vector< double >& double_values );
+
   void enroll_recorder( const Name, const RecordingDevice&, const DictionaryDatum& );
   void enroll_stimulator( const Name, StimulationDevice&, const DictionaryDatum& );
 
@@ -148,9 +176,51 @@ public:
   void get_recording_backend_device_defaults( const Name, DictionaryDatum& );
   void get_recording_backend_device_status( const Name, const RecordingDevice&, DictionaryDatum& );
 
+  /**
+   * \see RecordingBackend::get_device_events()
+   */
+  size_t get_recorded_events( const Name backend_name,
+    const RecordingDevice& device,
+    const size_t first,
+    DictionaryDatum& events );
+
+  /**
+   * Write data to a file stream on the I/O thread.
+   *
+   * Data handed to the same stream is written in the order of the calls.
+   * The call blocks while the data waiting to be written would exceed
+   * io_buffer_size. The stream must not be used by the caller until
+   * wait_for_async_writes() has returned. This function is thread-safe.
+   */
+  void write_async( std::ofstream& stream, AsyncBuffer&& data );
+
+  /**
+   * Block until all data handed to write_async() has been written.
+   *
+   * Throws IOError if writing failed for any of the data.
+   */
+  void wait_for_async_writes();
+
 private:
   void set_data_path_prefix_( const DictionaryDatum& );
 
+  /**
+   * Main loop of the I/O thread.
+   */
+  void io_thread_main_();
+
+  /**
+   * Write all pending data and terminate the I/O thread.
+   */
+  void stop_io_thread_();
+
+  //! Data to be written to a stream by the I/O thread
+  struct AsyncWrite
+  {
+    std::ofstream* stream;
+    AsyncBuffer data;
+  };
+
   std::string data_path_;   //!< Path for all files written by devices
   std::string data_prefix_; //!< Prefix for all files written by devices
   bool overwrite_files_;    //!< If true, overwrite existing data files.
@@ -164,6 +234,18 @@ private:
    * A mapping from names to registered stimulation backends
    */
   std::map< Name, StimulationBackend* > stimulation_backends_;
+
+  std::thread io_thread_;                     //!< Thread writing data handed to write_async()
+  std::mutex io_mutex_;                       //!< Protects all members of the I/O thread below
+  std::condition_variable io_data_available_; //!< Signals new data or stop request to the I/O thread
+  std::condition_variable io_data_written_;   //!< Signals completed writes to waiting threads
+  std::deque< AsyncWrite > io_queue_;         //!< Data waiting to be written
+  size_t io_bytes_pending_;                   //!< Bytes queued or currently being written
+  size_t io_buffer_size_;                     //!< Maximal number of pending bytes
+  bool io_thread_stop_;                       //!< If true, the I/O thread terminates once the queue is empty
+  bool io_error_;                             //!< If true, writing failed since the last wait
+  unsigned long io_bytes_written_;            //!< Total bytes written by the I/O thread
+  double time_io_blocked_;                    //!< Total time in seconds threads waited for the I/O thread
 };
 
 } // namespace nest
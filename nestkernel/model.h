@@ -24,6 +24,7 @@
 #define MODEL_H
 
 // C++ includes:
+#include <functional>
 #include <new>
 #include <string>
 #include <vector>
@@ -181,6 +182,20 @@ public:
    */
   virtual Node const& get_prototype() const = 0;
 
+  /**
+   * Return function reading recordable name from nodes of this model.
+   *
+   * The function is empty if name is not a recordable of the model.
+   */
+  virtual std::function< double( const Node& ) > get_recordable_getter( const Name& name ) const = 0;
+
+  /**
+   * Return function setting recordable name of nodes of this model.
+   *
+   * The function is empty if name can only be set by set_status().
+   */
+  virtual std::function< void( Node&, double ) > get_recordable_setter( const Name& name ) const = 0;
+
   /**
    * Set the model id on the prototype.
    */
@@ -307,6 +307,12 @@ ModelManager::set_synapse_defaults_( size_t model_id, const DictionaryDatum& par
     }
   }
 
+  // the volume transmitter may have changed between Prepare and Run
+  if ( kernel().simulation_manager.has_been_prepared() )
+  {
+    kernel().connection_manager.update_volume_transmitter_index();
+  }
+
   ALL_ENTRIES_ACCESSED( *params, "ModelManager::set_synapse_defaults_", "Unread dictionary entries: " );
   model_defaults_modified_ = true;
 }
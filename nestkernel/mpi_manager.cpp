@@ -23,6 +23,7 @@
 #include "mpi_manager.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cstdlib>
 
 // Includes from libnestutil:
@@ -68,6 +69,7 @@ nest::MPIManager::MPIManager()
   , send_recv_count_target_data_per_rank_( 0 )
 #ifdef HAVE_MPI
   , comm_step_( std::vector< int >() )
+  , sparse_secondary_events_( false )
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
@@ -793,6 +795,83 @@ nest::MPIManager::communicate_recv_counts_secondary_events()
   std::partial_sum( send_counts_secondary_events_in_int_per_rank_.begin(),
     send_counts_secondary_events_in_int_per_rank_.end() - 1,
     send_displacements_secondary_events_in_int_per_rank_.begin() + 1 );
+
+  // Each chunk contains at least the done marker, so only ranks with
+  // larger chunks are connected to this rank by secondary connections.
+  secondary_events_send_ranks_.clear();
+  secondary_events_recv_ranks_.clear();
+  for ( int rank = 0; rank < get_num_processes(); ++rank )
+  {
+    if ( rank == get_rank() )
+    {
+      continue;
+    }
+    if ( send_counts_secondary_events_in_int_per_rank_[ rank ] > 1 )
+    {
+      secondary_events_send_ranks_.push_back( rank );
+    }
+    if ( recv_counts_secondary_events_in_int_per_rank_[ rank ] > 1 )
+    {
+      secondary_events_recv_ranks_.push_back( rank );
+    }
+  }
+  secondary_events_requests_.resize( secondary_events_send_ranks_.size() + secondary_events_recv_ranks_.size() );
+
+  // Alltoallv is only used if this rank exchanges secondary events with
+  // all other ranks. The decision must be the same on all ranks, as
+  // the done markers are exchanged differently in both cases.
+  const bool dense = secondary_events_send_ranks_.size() == static_cast< size_t >( get_num_processes() - 1 )
+    and secondary_events_recv_ranks_.size() == static_cast< size_t >( get_num_processes() - 1 );
+  sparse_secondary_events_ = any_true( not dense );
+}
+
+void
+nest::MPIManager::communicate_secondary_events_sparse_( void* send_buffer, void* recv_buffer )
+{
+  unsigned int* send_buffer_int = static_cast< unsigned int* >( send_buffer );
+  unsigned int* recv_buffer_int = static_cast< unsigned int* >( recv_buffer );
+
+  size_t request = 0;
+  for ( const int source_rank : secondary_events_recv_ranks_ )
+  {
+    MPI_Irecv( recv_buffer_int + recv_displacements_secondary_events_in_int_per_rank_[ source_rank ],
+      recv_counts_secondary_events_in_int_per_rank_[ source_rank ],
+      MPI_UNSIGNED,
+      source_rank,
+      0,
+      comm,
+      &secondary_events_requests_[ request++ ] );
+  }
+  for ( const int target_rank : secondary_events_send_ranks_ )
+  {
+    MPI_Isend( send_buffer_int + send_displacements_secondary_events_in_int_per_rank_[ target_rank ],
+      send_counts_secondary_events_in_int_per_rank_[ target_rank ],
+      MPI_UNSIGNED,
+      target_rank,
+      0,
+      comm,
+      &secondary_events_requests_[ request++ ] );
+  }
+
+  // events between nodes on this rank do not need to pass through MPI
+  const int rank = get_rank();
+  std::copy( send_buffer_int + send_displacements_secondary_events_in_int_per_rank_[ rank ],
+    send_buffer_int + send_displacements_secondary_events_in_int_per_rank_[ rank ]
+      + send_counts_secondary_events_in_int_per_rank_[ rank ],
+    recv_buffer_int + recv_displacements_secondary_events_in_int_per_rank_[ rank ] );
+
+  // the same done marker is written for all ranks, see
+  // EventDeliveryManager::gather_secondary_events()
+  const int done = send_buffer_int[ get_done_marker_position_in_secondary_events_send_buffer( rank ) ];
+  int all_done;
+  MPI_Allreduce( &done, &all_done, 1, MPI_INT, MPI_LAND, comm );
+
+  MPI_Waitall( request, secondary_events_requests_.data(), MPI_STATUSES_IGNORE );
+
+  for ( int source_rank = 0; source_rank < get_num_processes(); ++source_rank )
+  {
+    recv_buffer_int[ get_done_marker_position_in_secondary_events_recv_buffer( source_rank ) ] = all_done;
+  }
 }
 
 void
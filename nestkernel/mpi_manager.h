@@ -213,6 +213,19 @@ public:
     const int* recv_counts,
     const int* recv_displacements );
 
+  /**
+   * Exchange secondary events with point-to-point messages.
+   *
+   * Messages are only sent to and received from ranks with secondary
+   * connections to or from this rank, and the events between nodes on
+   * this rank are copied within the buffers. As ranks without secondary
+   * connections between them do not receive each others' done markers,
+   * the done markers of all ranks are combined by a reduction and the
+   * result is written to all done marker positions in the receive
+   * buffer.
+   */
+  void communicate_secondary_events_sparse_( void* send_buffer, void* recv_buffer );
+
 #endif /* HAVE_MPI */
 
   template < class D >
@@ -347,6 +360,18 @@ private:
 
   std::vector< int > comm_step_;
 
+  //! Ranks other than this one to which secondary events are sent
+  std::vector< int > secondary_events_send_ranks_;
+
+  //! Ranks other than this one from which secondary events are received
+  std::vector< int > secondary_events_recv_ranks_;
+
+  //! Requests of the point-to-point messages for secondary events
+  std::vector< MPI_Request > secondary_events_requests_;
+
+  //! Whether secondary events are exchanged with point-to-point messages instead of Alltoallv
+  bool sparse_secondary_events_;
+
   unsigned int COMM_OVERFLOW_ERROR; //<! array containing communication partner for each step.
 
 
@@ -703,9 +728,22 @@ template < class D >
 void
 MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
 {
+  // with a single process, all secondary events stay on this rank
+  if ( get_num_processes() == 1 )
+  {
+    recv_buffer.swap( send_buffer );
+    return;
+  }
+
   void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
   void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
 
+  if ( sparse_secondary_events_ )
+  {
+    communicate_secondary_events_sparse_( send_buffer_int, recv_buffer_int );
+    return;
+  }
+
   communicate_Alltoallv_( send_buffer_int,
     &send_counts_secondary_events_in_int_per_rank_[ 0 ],
     &send_displacements_secondary_events_in_int_per_rank_[ 0 ],
@@ -757,8 +795,9 @@ template < class D >
 void
 MPIManager::communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
 {
+  // D is OffGridSpikeData or CompactOffGridSpikeData
   const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
-    sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+    sizeof( D ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
 
   communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
 }
@@ -25,11 +25,15 @@
 // C++ includes:
 #include <cassert>
 
+// Includes from libnestutil:
+#include "compose.hpp"
+
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "mpi_manager_impl.h"
 #include "parameter.h"
+#include "recording_device.h"
 
 // Includes from sli:
 #include "sliexceptions.h"
@@ -92,6 +96,12 @@ get_vp_specific_rng( size_t tid )
   return kernel().random_manager.get_vp_specific_rng( tid );
 }
 
+RngPtr
+get_connection_rng( size_t tid, size_t target_node_id )
+{
+  return kernel().random_manager.get_connection_rng( tid, target_node_id );
+}
+
 void
 set_kernel_status( const DictionaryDatum& dict )
 {
@@ -412,4 +422,244 @@ node_collection_array_index( const Datum* datum, const bool* array, unsigned lon
   return new NodeCollectionDatum( NodeCollection::create( node_ids ) );
 }
 
+void
+get_node_collection_values( const Datum* datum, const std::vector< std::string >& keys, double* values, size_t n )
+{
+  const NodeCollectionDatum node_collection = *dynamic_cast< const NodeCollectionDatum* >( datum );
+  if ( node_collection->size() != n )
+  {
+    throw DimensionMismatch( node_collection->size(), n );
+  }
+  for ( size_t k = 0; k < keys.size(); ++k )
+  {
+    kernel().node_manager.get_values( node_collection, Name( keys[ k ] ), values + k * n );
+  }
+}
+
+void
+get_node_collection_values( const Datum* datum, const std::vector< std::string >& keys, long* values, size_t n )
+{
+  const NodeCollectionDatum node_collection = *dynamic_cast< const NodeCollectionDatum* >( datum );
+  if ( node_collection->size() != n )
+  {
+    throw DimensionMismatch( node_collection->size(), n );
+  }
+  for ( size_t k = 0; k < keys.size(); ++k )
+  {
+    kernel().node_manager.get_values( node_collection, Name( keys[ k ] ), values + k * n );
+  }
+}
+
+void
+set_node_collection_values( const Datum* datum, const std::vector< std::string >& keys, const double* values, size_t n )
+{
+  const NodeCollectionDatum node_collection = *dynamic_cast< const NodeCollectionDatum* >( datum );
+  if ( node_collection->size() != n )
+  {
+    throw DimensionMismatch( node_collection->size(), n );
+  }
+  for ( size_t k = 0; k < keys.size(); ++k )
+  {
+    kernel().node_manager.set_values( node_collection, Name( keys[ k ] ), values + k * n );
+  }
+}
+
+void
+set_node_collection_values( const Datum* datum, const std::vector< std::string >& keys, const long* values, size_t n )
+{
+  const NodeCollectionDatum node_collection = *dynamic_cast< const NodeCollectionDatum* >( datum );
+  if ( node_collection->size() != n )
+  {
+    throw DimensionMismatch( node_collection->size(), n );
+  }
+  for ( size_t k = 0; k < keys.size(); ++k )
+  {
+    kernel().node_manager.set_values( node_collection, Name( keys[ k ] ), values + k * n );
+  }
+}
+
+void
+set_node_collection_status( const Datum* datum, const Datum* params )
+{
+  const NodeCollectionDatum node_collection = *dynamic_cast< const NodeCollectionDatum* >( datum );
+  if ( not node_collection->valid() )
+  {
+    throw KernelException( "InvalidNodeCollectionError" );
+  }
+
+  const DictionaryDatum* dict = dynamic_cast< const DictionaryDatum* >( params );
+  if ( dict )
+  {
+    for ( NodeCollection::const_iterator it = node_collection->begin(); it < node_collection->end(); ++it )
+    {
+      set_node_status( ( *it ).node_id, *dict );
+    }
+    return;
+  }
+
+  const ArrayDatum* dicts = dynamic_cast< const ArrayDatum* >( params );
+  if ( not dicts )
+  {
+    throw TypeMismatch( "dictionary or array of dictionaries", params->gettypename().toString() );
+  }
+  if ( dicts->size() != node_collection->size() )
+  {
+    throw KernelException( "IncompatibleLengths" );
+  }
+
+  size_t i = 0;
+  for ( NodeCollection::const_iterator it = node_collection->begin(); it < node_collection->end(); ++it, ++i )
+  {
+    set_node_status( ( *it ).node_id, getValue< DictionaryDatum >( dicts->get( i ) ) );
+  }
+}
+
+Datum*
+create_node_collection( const std::string& model_name, const long n, const DictionaryDatum& params )
+{
+  if ( n <= 0 )
+  {
+    throw RangeCheck();
+  }
+
+  if ( params->empty() )
+  {
+    return new NodeCollectionDatum( create( model_name, n ) );
+  }
+
+  // unknown models fail as in GetDefaults, which the SLI command calls first
+  const DictionaryDatum defaults = get_model_defaults( model_name );
+  const size_t model_id = kernel().model_manager.get_node_model_id( model_name );
+
+  if ( kernel().model_manager.get_node_model( model_id )->get_prototype().get_element_type() == names::recorder )
+  {
+    // Recording backend properties depend on the backend, which params
+    // may change, so they cannot be set as model defaults.
+    NodeCollectionPTR nodes = create( model_name, n );
+    for ( NodeCollection::const_iterator it = nodes->begin(); it < nodes->end(); ++it )
+    {
+      set_node_status( ( *it ).node_id, params );
+    }
+    return new NodeCollectionDatum( nodes );
+  }
+
+  // lookup2() rejects parameters the model does not have before any
+  // defaults are changed
+  DictionaryDatum old_defaults( new Dictionary );
+  for ( Dictionary::const_iterator it = params->begin(); it != params->end(); ++it )
+  {
+    ( *old_defaults )[ it->first ] = defaults->lookup2( it->first );
+  }
+
+  set_model_defaults( model_name, params );
+  NodeCollectionPTR nodes;
+  try
+  {
+    nodes = create( model_name, n );
+  }
+  catch ( ... )
+  {
+    set_model_defaults( model_name, old_defaults );
+    throw;
+  }
+  set_model_defaults( model_name, old_defaults );
+
+  return new NodeCollectionDatum( nodes );
+}
+
+void
+connect_node_collections( const Datum* sources,
+  const Datum* targets,
+  const DictionaryDatum& conn_spec,
+  const Datum* syn_spec )
+{
+  const NodeCollectionDatum source_nodes = *dynamic_cast< const NodeCollectionDatum* >( sources );
+  const NodeCollectionDatum target_nodes = *dynamic_cast< const NodeCollectionDatum* >( targets );
+
+  std::vector< DictionaryDatum > synapse_params;
+  const DictionaryDatum* syn_dict = dynamic_cast< const DictionaryDatum* >( syn_spec );
+  if ( syn_dict )
+  {
+    synapse_params.push_back( *syn_dict );
+  }
+  else
+  {
+    const ArrayDatum* syn_dicts = dynamic_cast< const ArrayDatum* >( syn_spec );
+    if ( not syn_dicts )
+    {
+      throw TypeMismatch( "dictionary or array of dictionaries", syn_spec->gettypename().toString() );
+    }
+    for ( size_t i = 0; i < syn_dicts->size(); ++i )
+    {
+      synapse_params.push_back( getValue< DictionaryDatum >( syn_dicts->get( i ) ) );
+    }
+  }
+
+  kernel().connection_manager.sw_construction_connect.start();
+
+  // dictionary access checking is handled by connect
+  connect( source_nodes, target_nodes, conn_spec, synapse_params );
+
+  kernel().connection_manager.sw_construction_connect.stop();
+}
+
+ArrayDatum
+get_node_collection_status( const Datum* datum )
+{
+  const NodeCollectionDatum node_collection = *dynamic_cast< const NodeCollectionDatum* >( datum );
+  if ( not node_collection->valid() )
+  {
+    throw KernelException(
+      "InvalidNodeCollection: note that ResetKernel invalidates all previously created NodeCollections." );
+  }
+
+  ArrayDatum result;
+  result.reserve( node_collection->size() );
+  for ( NodeCollection::const_iterator it = node_collection->begin(); it < node_collection->end(); ++it )
+  {
+    result.push_back( get_node_status( ( *it ).node_id ) );
+  }
+  return result;
+}
+
+ArrayDatum
+get_connection_status( const ArrayDatum& conns )
+{
+  ArrayDatum result;
+  result.reserve( conns.size() );
+  for ( size_t conn_index = 0; conn_index < conns.size(); ++conn_index )
+  {
+    result.push_back( get_connection_status( getValue< ConnectionDatum >( conns.get( conn_index ) ) ) );
+  }
+  return result;
+}
+
+DictionaryDatum
+get_events_since( const size_t node_id, const std::vector< long >& cursor )
+{
+  const std::vector< Node* > siblings = kernel().node_manager.get_thread_siblings( node_id );
+  if ( not cursor.empty() and cursor.size() != siblings.size() )
+  {
+    throw BadParameter( "The cursor must contain one position per thread." );
+  }
+
+  DictionaryDatum events( new Dictionary );
+  std::vector< long >* positions = new std::vector< long >( siblings.size() );
+  IntVectorDatum next_cursor( positions );
+  for ( size_t t = 0; t < siblings.size(); ++t )
+  {
+    const RecordingDevice* device = dynamic_cast< const RecordingDevice* >( siblings[ t ] );
+    if ( not device )
+    {
+      throw BadParameter( String::compose( "Node %1 is not a recording device.", node_id ) );
+    }
+    ( *positions )[ t ] = device->get_events( cursor.empty() ? 0 : cursor[ t ], events );
+  }
+
+  DictionaryDatum result( new Dictionary );
+  ( *result )[ names::events ] = events;
+  ( *result )[ names::cursor ] = next_cursor;
+  return result;
+}
+
 } // namespace nest
@@ -68,6 +68,7 @@ void print_nodes_to_stream( std::ostream& out = std::cout );
 RngPtr get_rank_synced_rng();
 RngPtr get_vp_synced_rng( size_t tid );
 RngPtr get_vp_specific_rng( size_t tid );
+RngPtr get_connection_rng( size_t tid, size_t target_node_id );
 
 void set_kernel_status( const DictionaryDatum& dict );
 DictionaryDatum get_kernel_status();
@@ -190,6 +191,81 @@ std::vector< double > apply( const ParameterDatum& param, const DictionaryDatum&
 Datum* node_collection_array_index( const Datum* datum, const long* array, unsigned long n );
 Datum* node_collection_array_index( const Datum* datum, const bool* array, unsigned long n );
 
+/**
+ * Get numeric properties of all nodes in a NodeCollection datum.
+ *
+ * values must have room for keys.size() rows of n entries, one per node.
+ * Row k receives the values of property keys[k]. Entries of nodes that
+ * are not local to this MPI process are set to NaN for double and 0 for
+ * long values.
+ */
+void get_node_collection_values( const Datum* datum, const std::vector< std::string >& keys, double* values, size_t n );
+void get_node_collection_values( const Datum* datum, const std::vector< std::string >& keys, long* values, size_t n );
+
+/**
+ * Set numeric properties of all nodes in a NodeCollection datum.
+ *
+ * values must hold keys.size() rows of n entries, one per node. Property
+ * keys[k] is set from row k.
+ */
+void set_node_collection_values( const Datum* datum,
+  const std::vector< std::string >& keys,
+  const double* values,
+  size_t n );
+void set_node_collection_values( const Datum* datum,
+  const std::vector< std::string >& keys,
+  const long* values,
+  size_t n );
+
+/**
+ * Set the status of all nodes in a NodeCollection datum.
+ *
+ * params is either a single dictionary, which is applied to all nodes,
+ * or an array with one dictionary per node.
+ */
+void set_node_collection_status( const Datum* datum, const Datum* params );
+
+/**
+ * Create n nodes of the given model and return them as NodeCollection datum.
+ *
+ * As the SLI command Create, this sets params as model defaults while the
+ * nodes are created and restores the previous defaults afterwards. For
+ * recorders, params are set on each node after creation instead.
+ */
+Datum* create_node_collection( const std::string& model_name, const long n, const DictionaryDatum& params );
+
+/**
+ * Connect the nodes of two NodeCollection datums.
+ *
+ * syn_spec is either a single dictionary or an array of dictionaries for
+ * collocated synapses. Both specifications must contain all entries that
+ * the SLI command Connect fills in from its defaults.
+ */
+void connect_node_collections( const Datum* sources,
+  const Datum* targets,
+  const DictionaryDatum& conn_spec,
+  const Datum* syn_spec );
+
+/**
+ * Return the status dictionaries of all nodes in a NodeCollection datum.
+ */
+ArrayDatum get_node_collection_status( const Datum* datum );
+
+/**
+ * Return the status dictionaries of all connections in an array of connection datums.
+ */
+ArrayDatum get_connection_status( const ArrayDatum& conns );
+
+/**
+ * Return the events a recording device has stored since the given cursor.
+ *
+ * The cursor holds one position per thread as returned by the previous
+ * call for the same device. An empty cursor returns all events kept in
+ * memory. The returned dictionary contains the events under the key
+ * events and the cursor for the next call under the key cursor.
+ */
+DictionaryDatum get_events_since( const size_t node_id, const std::vector< long >& cursor );
+
 }
 
 
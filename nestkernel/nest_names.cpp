@@ -88,6 +88,7 @@ const Name box( "box" );
 const Name buffer_size( "buffer_size" );
 const Name buffer_size_spike_data( "buffer_size_spike_data" );
 const Name buffer_size_target_data( "buffer_size_target_data" );
+const Name bulk_draws( "bulk_draws" );
 
 const Name C_m( "C_m" );
 const Name Ca( "Ca" );
@@ -102,13 +103,16 @@ const Name capacity( "capacity" );
 const Name center( "center" );
 const Name circular( "circular" );
 const Name clear( "clear" );
+const Name clear_on_read( "clear_on_read" );
 const Name comp_idx( "comp_idx" );
 const Name comparator( "comparator" );
 const Name compartments( "compartments" );
+const Name compress_off_grid_spikes( "compress_off_grid_spikes" );
 const Name conc_Mg2( "conc_Mg2" );
 const Name configbit_0( "configbit_0" );
 const Name configbit_1( "configbit_1" );
 const Name connection_count( "connection_count" );
+const Name connection_rng_keyed_by_target( "connection_rng_keyed_by_target" );
 const Name connection_rules( "connection_rules" );
 const Name connection_type( "connection_type" );
 const Name consistent_integration( "consistent_integration" );
@@ -116,6 +120,8 @@ const Name continuous( "continuous" );
 const Name count_covariance( "count_covariance" );
 const Name count_histogram( "count_histogram" );
 const Name covariance( "covariance" );
+const Name cursor( "cursor" );
+const Name cv_isi( "cv_isi" );
 
 const Name Delta_T( "Delta_T" );
 const Name Delta_V( "Delta_V" );
@@ -126,6 +132,7 @@ const Name data_prefix( "data_prefix" );
 const Name dead_time( "dead_time" );
 const Name dead_time_random( "dead_time_random" );
 const Name dead_time_shape( "dead_time_shape" );
+const Name decimation( "decimation" );
 const Name delay( "delay" );
 const Name delay_u_bars( "delay_u_bars" );
 const Name deliver_interval( "deliver_interval" );
@@ -149,6 +156,7 @@ const Name distal_exc( "distal_exc" );
 const Name distal_inh( "distal_inh" );
 const Name drift_factor( "drift_factor" );
 const Name driver_readout_time( "driver_readout_time" );
+const Name dropped( "dropped" );
 const Name dt( "dt" );
 const Name dU( "U" );
 
@@ -188,9 +196,11 @@ const Name events( "events" );
 const Name extent( "extent" );
 
 const Name f_target( "f_target" );
+const Name fano_factor( "fano_factor" );
 const Name file_extension( "file_extension" );
 const Name filename( "filename" );
 const Name filenames( "filenames" );
+const Name filter_tau( "filter_tau" );
 const Name frequency( "frequency" );
 const Name frozen( "frozen" );
 
@@ -275,6 +285,8 @@ const Name inner_radius( "inner_radius" );
 const Name instant_unblock_NMDA( "instant_unblock_NMDA" );
 const Name instantiations( "instantiations" );
 const Name interval( "interval" );
+const Name io_buffer_size( "io_buffer_size" );
+const Name io_bytes_written( "io_bytes_written" );
 const Name is_refractory( "is_refractory" );
 
 const Name Kd_act( "Kd_act" );
@@ -342,6 +354,7 @@ const Name n_events( "n_events" );
 const Name n_messages( "n_messages" );
 const Name n_proc( "n_proc" );
 const Name n_receptors( "n_receptors" );
+const Name n_spikes( "n_spikes" );
 const Name n_synapses( "n_synapses" );
 const Name network_size( "network_size" );
 const Name neuron( "neuron" );
@@ -365,6 +378,7 @@ const Name origin( "origin" );
 const Name other( "other" );
 const Name outdegree( "outdegree" );
 const Name outer_radius( "outer_radius" );
+const Name overflow( "overflow" );
 const Name overwrite_files( "overwrite_files" );
 
 const Name P( "P" );
@@ -379,6 +393,7 @@ const Name parent_idx( "parent_idx" );
 const Name phase( "phase" );
 const Name phi_max( "phi_max" );
 const Name pairwise_poisson( "pairwise_poisson" );
+const Name per_source( "per_source" );
 const Name polar_angle( "polar_angle" );
 const Name polar_axis( "polar_axis" );
 const Name pool_size( "pool_size" );
@@ -402,6 +417,7 @@ const Name proximal_inh( "proximal_inh" );
 const Name psi( "psi" );
 const Name published( "published" );
 const Name pulse_times( "pulse_times" );
+const Name push_samples( "push_samples" );
 
 const Name q_rr( "q_rr" );
 const Name q_sfa( "q_sfa" );
@@ -413,6 +429,7 @@ const Name rate_IP3R( "rate_IP3R" );
 const Name rate_L( "rate_L" );
 const Name rate_SERCA( "rate_SERCA" );
 const Name rate_slope( "rate_slope" );
+const Name rate_table_tolerance( "rate_table_tolerance" );
 const Name rate_times( "rate_times" );
 const Name rate_values( "rate_values" );
 const Name ratio_ER_cyt( "ratio_ER_cyt" );
@@ -432,6 +449,7 @@ const Name rectangular( "rectangular" );
 const Name rectify_output( "rectify_output" );
 const Name rectify_rate( "rectify_rate" );
 const Name recv_buffer_size_secondary_events( "recv_buffer_size_secondary_events" );
+const Name reductions( "reductions" );
 const Name refractory_input( "refractory_input" );
 const Name registered( "registered" );
 const Name regular_spike_arrival( "regular_spike_arrival" );
@@ -440,6 +458,7 @@ const Name requires_symmetric( "requires_symmetric" );
 const Name reset_pattern( "reset_pattern" );
 const Name resolution( "resolution" );
 const Name rho( "rho" );
+const Name ring_size( "ring_size" );
 const Name rng_seed( "rng_seed" );
 const Name rng_type( "rng_type" );
 const Name rng_types( "rng_types" );
@@ -454,6 +473,7 @@ const Name s_GABA( "s_GABA" );
 const Name SIC_scale( "SIC_scale" );
 const Name SIC_th( "SIC_th" );
 const Name sdev( "sdev" );
+const Name segment_name( "segment_name" );
 const Name send_buffer_size_secondary_events( "send_buffer_size_secondary_events" );
 const Name senders( "senders" );
 const Name shape( "shape" );
@@ -488,6 +508,8 @@ const Name stimulus_source( "stimulus_source" );
 const Name stop( "stop" );
 const Name structural_plasticity_synapses( "structural_plasticity_synapses" );
 const Name structural_plasticity_update_interval( "structural_plasticity_update_interval" );
+const Name subset_fraction( "subset_fraction" );
+const Name subset_seed( "subset_seed" );
 const Name surrogate_gradient( "surrogate_gradient" );
 const Name surrogate_gradient_function( "surrogate_gradient_function" );
 const Name synapse_id( "synapse_id" );
@@ -607,8 +629,10 @@ const Name time_gather_secondary_data( "time_gather_secondary_data" );
 const Name time_gather_spike_data( "time_gather_spike_data" );
 const Name time_gather_target_data( "time_gather_target_data" );
 const Name time_in_steps( "time_in_steps" );
+const Name time_io_blocked( "time_io_blocked" );
 const Name time_simulate( "time_simulate" );
 const Name time_update( "time_update" );
+const Name time_wfr( "time_wfr" );
 const Name times( "times" );
 const Name to_do( "to_do" );
 const Name total_num_virtual_procs( "total_num_virtual_procs" );
@@ -625,6 +649,7 @@ const Name u_ref_squared( "u_ref_squared" );
 const Name update_time_limit( "update_time_limit" );
 const Name upper_right( "upper_right" );
 const Name use_compressed_spikes( "use_compressed_spikes" );
+const Name use_rate_matrix( "use_rate_matrix" );
 const Name use_wfr( "use_wfr" );
 
 const Name v( "v" );
@@ -646,6 +671,7 @@ const Name V_th_alpha_2( "V_th_alpha_2" );
 const Name V_th_max( "V_th_max" );
 const Name V_th_rest( "V_th_rest" );
 const Name V_th_v( "V_th_v" );
+const Name variance( "variance" );
 const Name voltage_clamp( "voltage_clamp" );
 const Name voltage_reset_add( "voltage_reset_add" );
 const Name voltage_reset_fraction( "voltage_reset_fraction" );
@@ -661,8 +687,14 @@ const Name weight_recorder( "weight_recorder" );
 const Name weights( "weights" );
 const Name wfr_comm_interval( "wfr_comm_interval" );
 const Name wfr_interpolation_order( "wfr_interpolation_order" );
+const Name wfr_intervals( "wfr_intervals" );
+const Name wfr_iterations( "wfr_iterations" );
 const Name wfr_max_iterations( "wfr_max_iterations" );
+const Name wfr_skip_unchanged( "wfr_skip_unchanged" );
+const Name wfr_skipped_updates( "wfr_skipped_updates" );
 const Name wfr_tol( "wfr_tol" );
+const Name wfr_updates( "wfr_updates" );
+const Name window( "window" );
 const Name with_reset( "with_reset" );
 
 const Name x( "x" );
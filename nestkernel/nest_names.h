@@ -115,6 +115,7 @@ extern const Name box;
 extern const Name buffer_size;
 extern const Name buffer_size_spike_data;
 extern const Name buffer_size_target_data;
+extern const Name bulk_draws;
 
 extern const Name C_m;
 extern const Name Ca;
@@ -129,13 +130,16 @@ extern const Name capacity;
 extern const Name center;
 extern const Name circular;
 extern const Name clear;
+extern const Name clear_on_read;
 extern const Name comp_idx;
 extern const Name comparator;
 extern const Name compartments;
+extern const Name compress_off_grid_spikes;
 extern const Name conc_Mg2;
 extern const Name configbit_0;
 extern const Name configbit_1;
 extern const Name connection_count;
+extern const Name connection_rng_keyed_by_target;
 extern const Name connection_rules;
 extern const Name connection_type;
 extern const Name consistent_integration;
@@ -143,6 +147,8 @@ extern const Name continuous;
 extern const Name count_covariance;
 extern const Name count_histogram;
 extern const Name covariance;
+extern const Name cursor;
+extern const Name cv_isi;
 
 extern const Name Delta_T;
 extern const Name Delta_V;
@@ -153,6 +159,7 @@ extern const Name data_prefix;
 extern const Name dead_time;
 extern const Name dead_time_random;
 extern const Name dead_time_shape;
+extern const Name decimation;
 extern const Name delay;
 extern const Name delay_u_bars;
 extern const Name deliver_interval;
@@ -176,6 +183,7 @@ extern const Name distal_exc;
 extern const Name distal_inh;
 extern const Name drift_factor;
 extern const Name driver_readout_time;
+extern const Name dropped;
 extern const Name dt;
 extern const Name dU;
 
@@ -216,9 +224,11 @@ extern const Name events;
 extern const Name extent;
 
 extern const Name f_target;
+extern const Name fano_factor;
 extern const Name file_extension;
 extern const Name filename;
 extern const Name filenames;
+extern const Name filter_tau;
 extern const Name frequency;
 extern const Name frozen;
 
@@ -303,6 +313,8 @@ extern const Name inner_radius;
 extern const Name instant_unblock_NMDA;
 extern const Name instantiations;
 extern const Name interval;
+extern const Name io_buffer_size;
+extern const Name io_bytes_written;
 extern const Name is_refractory;
 
 extern const Name Kd_act;
@@ -370,6 +382,7 @@ extern const Name n_events;
 extern const Name n_messages;
 extern const Name n_proc;
 extern const Name n_receptors;
+extern const Name n_spikes;
 extern const Name n_synapses;
 extern const Name network_size;
 extern const Name neuron;
@@ -393,6 +406,7 @@ extern const Name origin;
 extern const Name other;
 extern const Name outdegree;
 extern const Name outer_radius;
+extern const Name overflow;
 extern const Name overwrite_files;
 
 extern const Name P;
@@ -407,6 +421,7 @@ extern const Name parent_idx;
 extern const Name phase;
 extern const Name phi_max;
 extern const Name pairwise_poisson;
+extern const Name per_source;
 extern const Name polar_angle;
 extern const Name polar_axis;
 extern const Name pool_size;
@@ -430,6 +445,7 @@ extern const Name proximal_inh;
 extern const Name psi;
 extern const Name published;
 extern const Name pulse_times;
+extern const Name push_samples;
 
 extern const Name q_rr;
 extern const Name q_sfa;
@@ -441,6 +457,7 @@ extern const Name rate_IP3R;
 extern const Name rate_L;
 extern const Name rate_SERCA;
 extern const Name rate_slope;
+extern const Name rate_table_tolerance;
 extern const Name rate_times;
 extern const Name rate_values;
 extern const Name ratio_ER_cyt;
@@ -460,6 +477,7 @@ extern const Name rectangular;
 extern const Name rectify_output;
 extern const Name rectify_rate;
 extern const Name recv_buffer_size_secondary_events;
+extern const Name reductions;
 extern const Name refractory_input;
 extern const Name registered;
 extern const Name regular_spike_arrival;
@@ -468,6 +486,7 @@ extern const Name requires_symmetric;
 extern const Name reset_pattern;
 extern const Name resolution;
 extern const Name rho;
+extern const Name ring_size;
 extern const Name rng_seed;
 extern const Name rng_type;
 extern const Name rng_types;
@@ -482,6 +501,7 @@ extern const Name s_NMDA;
 extern const Name SIC_scale;
 extern const Name SIC_th;
 extern const Name sdev;
+extern const Name segment_name;
 extern const Name send_buffer_size_secondary_events;
 extern const Name senders;
 extern const Name shape;
@@ -516,6 +536,8 @@ extern const Name stimulus_source;
 extern const Name stop;
 extern const Name structural_plasticity_synapses;
 extern const Name structural_plasticity_update_interval;
+extern const Name subset_fraction;
+extern const Name subset_seed;
 extern const Name surrogate_gradient;
 extern const Name surrogate_gradient_function;
 extern const Name synapse_id;
@@ -635,8 +657,10 @@ extern const Name time_gather_secondary_data;
 extern const Name time_gather_spike_data;
 extern const Name time_gather_target_data;
 extern const Name time_in_steps;
+extern const Name time_io_blocked;
 extern const Name time_simulate;
 extern const Name time_update;
+extern const Name time_wfr;
 extern const Name times;
 extern const Name to_do;
 extern const Name total_num_virtual_procs;
@@ -653,6 +677,7 @@ extern const Name u_ref_squared;
 extern const Name update_time_limit;
 extern const Name upper_right;
 extern const Name use_compressed_spikes;
+extern const Name use_rate_matrix;
 extern const Name use_wfr;
 
 extern const Name v;
@@ -674,6 +699,7 @@ extern const Name V_th_alpha_2;
 extern const Name V_th_max;
 extern const Name V_th_rest;
 extern const Name V_th_v;
+extern const Name variance;
 extern const Name voltage_clamp;
 extern const Name voltage_reset_add;
 extern const Name voltage_reset_fraction;
@@ -689,8 +715,14 @@ extern const Name weight_recorder;
 extern const Name weights;
 extern const Name wfr_comm_interval;
 extern const Name wfr_interpolation_order;
+extern const Name wfr_intervals;
+extern const Name wfr_iterations;
 extern const Name wfr_max_iterations;
+extern const Name wfr_skip_unchanged;
+extern const Name wfr_skipped_updates;
 extern const Name wfr_tol;
+extern const Name wfr_updates;
+extern const Name window;
 extern const Name with_reset;
 
 extern const Name x;
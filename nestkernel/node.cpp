@@ -376,6 +376,12 @@ Node::handle( InstantaneousRateConnectionEvent& )
   throw UnexpectedEvent( "The target node does not handle instantaneous rate input." );
 }
 
+bool
+Node::get_instantaneous_rate_buffers( std::vector< double >*&, std::vector< double >*& )
+{
+  return false;
+}
+
 size_t
 Node::handles_test_event( InstantaneousRateConnectionEvent&, size_t )
 {
@@ -620,6 +620,20 @@ public:
    */
   virtual void handle( InstantaneousRateConnectionEvent& e );
 
+  /**
+   * Provide the buffers into which the node sums its instantaneous rate input.
+   *
+   * A RateMatrix adds the weighted rates of the sources of the node
+   * directly to these buffers instead of delivering
+   * InstantaneousRateConnectionEvents, with positive weights to ex and
+   * other weights to in. Nodes return false if they process their input
+   * differently, e.g., by applying a nonlinearity to each rate, so that
+   * they receive events.
+   *
+   * @ingroup event_interface
+   */
+  virtual bool get_instantaneous_rate_buffers( std::vector< double >*& ex, std::vector< double >*& in );
+
   /**
    * Handler for rate neuron events.
    *
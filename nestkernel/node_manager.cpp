@@ -24,6 +24,7 @@
 
 // C++ includes:
 #include <algorithm>
+#include <limits>
 #include <set>
 
 // Includes from libnestutil:
@@ -42,6 +43,7 @@
 #include "vp_manager_impl.h"
 
 // Includes from sli:
+#include "booldatum.h"
 #include "dictutils.h"
 
 namespace nest
@@ -101,6 +103,175 @@ NodeManager::get_status( size_t idx )
   return d;
 }
 
+void
+NodeManager::get_values( NodeCollectionPTR nc, const Name& key, double* values )
+{
+  get_values_( nc, key, values );
+}
+
+void
+NodeManager::get_values( NodeCollectionPTR nc, const Name& key, long* values )
+{
+  get_values_( nc, key, values );
+}
+
+void
+NodeManager::set_values( NodeCollectionPTR nc, const Name& key, const double* values )
+{
+  set_values_( nc, key, values );
+}
+
+void
+NodeManager::set_values( NodeCollectionPTR nc, const Name& key, const long* values )
+{
+  set_values_( nc, key, values );
+}
+
+std::function< double( const Node& ) >
+NodeManager::get_value_getter_( const Model& model, const Name& key ) const
+{
+  std::function< double( const Node& ) > getter = model.get_recordable_getter( key );
+  if ( getter )
+  {
+    return getter;
+  }
+
+  // properties added by get_status_base() for all local nodes
+  if ( key == names::local )
+  {
+    return []( const Node& ) { return 1.0; };
+  }
+  if ( key == names::global_id )
+  {
+    return []( const Node& node ) { return static_cast< double >( node.get_node_id() ); };
+  }
+  if ( key == names::model_id )
+  {
+    return []( const Node& node ) { return static_cast< double >( node.get_model_id() ); };
+  }
+  if ( key == names::vp )
+  {
+    return []( const Node& node ) { return static_cast< double >( node.get_vp() ); };
+  }
+  if ( key == names::thread )
+  {
+    return []( const Node& node ) { return static_cast< double >( node.get_thread() ); };
+  }
+  if ( key == names::thread_local_id )
+  {
+    return []( const Node& node ) { return static_cast< double >( node.get_thread_lid() ); };
+  }
+  if ( key == names::frozen )
+  {
+    return []( const Node& node ) { return static_cast< double >( node.is_frozen() ); };
+  }
+  if ( key == names::node_uses_wfr )
+  {
+    return []( const Node& node ) { return static_cast< double >( node.node_uses_wfr() ); };
+  }
+  return getter;
+}
+
+template < typename ValueT >
+void
+NodeManager::get_values_( NodeCollectionPTR nc, const Name& key, ValueT* values )
+{
+  // The getter and the status dictionary used for properties without getter
+  // are replaced whenever the model changes along the collection.
+  std::function< double( const Node& ) > getter;
+  DictionaryDatum status( new Dictionary );
+  int last_model_id = -1;
+
+  size_t i = 0;
+  for ( NodeCollection::const_iterator it = nc->begin(); it < nc->end(); ++it, ++i )
+  {
+    Node* node = get_mpi_local_node_or_device_head( ( *it ).node_id );
+    assert( node );
+    if ( node->is_proxy() )
+    {
+      // NaN for floating point types, 0 for integer types
+      values[ i ] = std::numeric_limits< ValueT >::quiet_NaN();
+      continue;
+    }
+
+    if ( node->get_model_id() != last_model_id )
+    {
+      last_model_id = node->get_model_id();
+      getter = get_value_getter_( *kernel().model_manager.get_node_model( last_model_id ), key );
+      status->clear();
+    }
+
+    if ( getter )
+    {
+      values[ i ] = static_cast< ValueT >( getter( *node ) );
+      continue;
+    }
+
+    node->get_status( status );
+    const Token value = status->lookup( key );
+    if ( value.empty() )
+    {
+      throw KeyError( key, node->get_name(), "get_values" );
+    }
+
+    if ( const DoubleDatum* dd = dynamic_cast< const DoubleDatum* >( value.datum() ) )
+    {
+      values[ i ] = static_cast< ValueT >( dd->get() );
+    }
+    else if ( const IntegerDatum* id = dynamic_cast< const IntegerDatum* >( value.datum() ) )
+    {
+      values[ i ] = static_cast< ValueT >( id->get() );
+    }
+    else if ( const BoolDatum* bd = dynamic_cast< const BoolDatum* >( value.datum() ) )
+    {
+      values[ i ] = static_cast< ValueT >( bd->get() );
+    }
+    else
+    {
+      throw TypeMismatch( "double, integer or bool", value.datum()->gettypename().toString() );
+    }
+  }
+}
+
+template < typename ValueT >
+void
+NodeManager::set_values_( NodeCollectionPTR nc, const Name& key, const ValueT* values )
+{
+  // a single dictionary is updated in place for all nodes without setter
+  std::function< void( Node&, double ) > setter;
+  DictionaryDatum params( new Dictionary );
+  int last_model_id = -1;
+
+  size_t i = 0;
+  for ( NodeCollection::const_iterator it = nc->begin(); it < nc->end(); ++it, ++i )
+  {
+    Node* node = get_mpi_local_node_or_device_head( ( *it ).node_id );
+    assert( node );
+    if ( node->is_proxy() )
+    {
+      continue;
+    }
+
+    if ( node->get_model_id() != last_model_id )
+    {
+      last_model_id = node->get_model_id();
+      Model* model = kernel().model_manager.get_node_model( last_model_id );
+      // models without proxies have one instance per thread, which set_status() updates together
+      setter = model->has_proxies() ? model->get_recordable_setter( key ) : std::function< void( Node&, double ) >();
+    }
+
+    if ( setter )
+    {
+      setter( *node, static_cast< double >( values[ i ] ) );
+    }
+    else
+    {
+      ( *params )[ key ] = values[ i ];
+      set_status( ( *it ).node_id, params );
+    }
+  }
+}
+
 NodeCollectionPTR
 NodeManager::add_node( size_t model_id, long n )
 {
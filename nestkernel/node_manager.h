@@ -24,6 +24,7 @@
 #define NODE_MANAGER_H
 
 // C++ includes:
+#include <functional>
 #include <vector>
 
 // Includes from libnestutil:
@@ -76,6 +77,36 @@ public:
    */
   void set_status( size_t, const DictionaryDatum& );
 
+  /**
+   * Get a numeric property of all nodes in a NodeCollection.
+   *
+   * The value of property key of the i-th node in the collection is written
+   * to values[i]; integer and Boolean properties are converted to the type
+   * of values. Entries for nodes that are not local to this MPI process are
+   * set to NaN or 0. Recordables and the properties common to all nodes are
+   * read through access functions looked up once per model, see
+   * get_value_getter_(). Only other properties are read from the status
+   * dictionary of each node.
+   *
+   * @throws nest::KeyError  A node does not have property key.
+   * @throws TypeMismatch    The property of a node is not numeric.
+   */
+  void get_values( NodeCollectionPTR, const Name& key, double* values );
+  void get_values( NodeCollectionPTR, const Name& key, long* values );
+
+  /**
+   * Set a property of all nodes in a NodeCollection.
+   *
+   * Property key of the i-th node in the collection is set to values[i].
+   * Nodes that are not local to this MPI process are skipped. Recordables
+   * registered with a set function in the RecordablesMap of the model are
+   * set directly, all other properties by set_status() of each node.
+   *
+   * @throws nest::UnaccessedDictionaryEntry  A node does not have property key.
+   */
+  void set_values( NodeCollectionPTR, const Name& key, const double* values );
+  void set_values( NodeCollectionPTR, const Name& key, const long* values );
+
   /**
    * Add a number of nodes to the network.
    *
@@ -274,6 +305,23 @@ private:
    */
   void set_status_single_node_( Node&, const DictionaryDatum&, bool clear_flags = true );
 
+  /**
+   * Return function reading property key from nodes of the given model.
+   *
+   * Recordables of the model and the properties that get_status_base()
+   * adds for all local nodes can be read this way. The function is empty
+   * for all other properties.
+   */
+  std::function< double( const Node& ) > get_value_getter_( const Model&, const Name& key ) const;
+
+  //! Implementation of get_values() for the supported value types
+  template < typename ValueT >
+  void get_values_( NodeCollectionPTR, const Name&, ValueT* );
+
+  //! Implementation of set_values() for the supported value types
+  template < typename ValueT >
+  void set_values_( NodeCollectionPTR, const Name&, const ValueT* );
+
   /**
    * Initialized buffers, register in list of nodes to update/finalize.
    *
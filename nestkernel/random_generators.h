@@ -109,11 +109,32 @@ public:
   virtual unsigned long operator()( std::poisson_distribution< unsigned long >& d,
     std::poisson_distribution< unsigned long >::param_type& p ) = 0;
 
+  /**
+   * @brief Fills a buffer with draws from the provided distribution.
+   *
+   * Equivalent to calling the corresponding operator() n times, so the buffer holds the
+   * same numbers as sequential draws would give. The distribution is dispatched only once per
+   * buffer, which allows the compiler to inline the wrapped engine into the loop.
+   *
+   * @param d Distribution that will be called.
+   * @param buffer Buffer of at least n elements to fill.
+   * @param n Number of draws.
+   */
+  virtual void fill( std::uniform_real_distribution<>& d, double* buffer, size_t n ) = 0;
+  virtual void fill( std::normal_distribution<>& d, double* buffer, size_t n ) = 0;
+  virtual void fill( std::binomial_distribution< unsigned long >& d, unsigned long* buffer, size_t n ) = 0;
+  virtual void fill( std::poisson_distribution< unsigned long >& d, unsigned long* buffer, size_t n ) = 0;
+
   /**
    * @brief Uses the wrapped RNG engine to draw a double from a uniform distribution in the range [0, 1).
    */
   virtual double drand() = 0;
 
+  /**
+   * @brief Fills a buffer with n numbers as returned by n calls to drand().
+   */
+  virtual void fill_drand( double* buffer, size_t n ) = 0;
+
   /**
    * @brief Uses the wrapped RNG engine to draw an unsigned long from a uniform distribution in the range [0, N).
    *
@@ -130,6 +151,16 @@ public:
     NodeCollection::const_iterator last,
     std::back_insert_iterator< std::vector< NodeIDTriple > > dest,
     size_t n ) = 0;
+
+  /**
+   * @brief Re-seed the wrapped RNG engine, discarding its current state.
+   *
+   * For counter-based engines (Philox, Threefry), this only sets the key and
+   * resets the counter and is thus cheap enough to be done frequently.
+   *
+   * @param seed Initializer list for C++11-conforming SeedSeq for RNG.
+   */
+  virtual void seed( std::initializer_list< std::uint32_t > seed ) = 0;
 };
 
 /**
@@ -150,10 +181,7 @@ public:
     : rng_()
     , uniform_double_dist_0_1_( 0.0, 1.0 )
   {
-    // Melissa O'Neill's seed sequence generator which provides better distributed seeds
-    // than std::seed_seq; see https://www.pcg-random.org/posts/developing-a-seed_seq-alternative.html
-    randutils::seed_seq_fe128 sseq( seed );
-    rng_.seed( sseq );
+    seed_engine_( seed );
   }
 
   inline unsigned long
@@ -268,12 +296,42 @@ public:
     return d( rng_, p );
   }
 
+  inline void
+  fill( std::uniform_real_distribution<>& d, double* buffer, size_t n ) override
+  {
+    fill_( d, buffer, n );
+  }
+
+  inline void
+  fill( std::normal_distribution<>& d, double* buffer, size_t n ) override
+  {
+    fill_( d, buffer, n );
+  }
+
+  inline void
+  fill( std::binomial_distribution< unsigned long >& d, unsigned long* buffer, size_t n ) override
+  {
+    fill_( d, buffer, n );
+  }
+
+  inline void
+  fill( std::poisson_distribution< unsigned long >& d, unsigned long* buffer, size_t n ) override
+  {
+    fill_( d, buffer, n );
+  }
+
   inline double
   drand() override
   {
     return uniform_double_dist_0_1_( rng_ );
   }
 
+  inline void
+  fill_drand( double* buffer, size_t n ) override
+  {
+    fill_( uniform_double_dist_0_1_, buffer, n );
+  }
+
   inline unsigned long
   ulrand( unsigned long N ) override
   {
@@ -290,7 +348,32 @@ public:
     std::sample( first, last, dest, n, rng_ );
   }
 
+  inline void
+  seed( std::initializer_list< std::uint32_t > seed ) override
+  {
+    seed_engine_( seed );
+  }
+
 private:
+  template < typename DistributionT >
+  inline void
+  fill_( DistributionT& d, typename DistributionT::result_type* buffer, size_t n )
+  {
+    for ( size_t i = 0; i < n; ++i )
+    {
+      buffer[ i ] = d( rng_ );
+    }
+  }
+
+  inline void
+  seed_engine_( std::initializer_list< std::uint32_t > seed )
+  {
+    // Melissa O'Neill's seed sequence generator which provides better distributed seeds
+    // than std::seed_seq; see https://www.pcg-random.org/posts/developing-a-seed_seq-alternative.html
+    randutils::seed_seq_fe128 sseq( seed );
+    rng_.seed( sseq );
+  }
+
   RandomEngineT rng_; //!< Wrapped RNG engine.
   std::uniform_int_distribution< unsigned long > uniform_ulong_dist_;
   std::uniform_real_distribution<> uniform_double_dist_0_1_;
@@ -379,6 +462,22 @@ public:
     return g->operator()( distribution_, params );
   }
 
+  /**
+   * @brief Fills a buffer with n draws from the distribution.
+   *
+   * Gives the same numbers as n calls to operator()( g ). Only available for
+   * distributions for which BaseRandomGenerator provides a fill() overload.
+   *
+   * @param g Pointer to the RNG wrapper.
+   * @param buffer Buffer of at least n elements to fill.
+   * @param n Number of draws.
+   */
+  inline void
+  fill( RngPtr g, result_type* buffer, size_t n )
+  {
+    g->fill( distribution_, buffer, n );
+  }
+
   /**
    * @brief Sets the distribution's associated parameter set to params.
    *
@@ -46,12 +46,15 @@ const std::uint32_t nest::RandomManager::DEFAULT_BASE_SEED_ = 143202461;
 const std::uint32_t nest::RandomManager::RANK_SYNCED_SEEDER_ = 0xc229212d;
 const std::uint32_t nest::RandomManager::THREAD_SYNCED_SEEDER_ = 0x37722d5e;
 const std::uint32_t nest::RandomManager::THREAD_SPECIFIC_SEEDER_ = 0xb84c9bae;
+const std::uint32_t nest::RandomManager::TARGET_KEYED_SEEDER_ = 0x5e7a93c1;
 
 
 nest::RandomManager::RandomManager()
   : current_rng_type_( DEFAULT_RNG_TYPE_ )
   , base_seed_( DEFAULT_BASE_SEED_ )
   , rank_synced_rng_( nullptr )
+  , connection_rng_keyed_by_target_( false )
+  , connection_stream_( 0 )
 {
 }
 
@@ -79,13 +82,18 @@ nest::RandomManager::initialize( const bool adjust_number_of_threads_or_rng_only
 
     current_rng_type_ = DEFAULT_RNG_TYPE_;
     base_seed_ = DEFAULT_BASE_SEED_;
+    connection_rng_keyed_by_target_ = false;
   }
 
+  // Keyed streams restart whenever RNGs are re-created.
+  connection_stream_ = 0;
+
   // Create new RNGs of the currently used RNG type.
   rank_synced_rng_ = rng_types_[ current_rng_type_ ]->create( { base_seed_, RANK_SYNCED_SEEDER_ } );
 
   vp_synced_rngs_.resize( kernel().vp_manager.get_num_threads() );
   vp_specific_rngs_.resize( kernel().vp_manager.get_num_threads() );
+  target_keyed_rngs_.resize( kernel().vp_manager.get_num_threads() );
 
 #pragma omp parallel
   {
@@ -93,6 +101,8 @@ nest::RandomManager::initialize( const bool adjust_number_of_threads_or_rng_only
     const std::uint32_t vp = kernel().vp_manager.get_vp(); // type required for rng initializer
     vp_synced_rngs_[ tid ] = rng_types_[ current_rng_type_ ]->create( { base_seed_, THREAD_SYNCED_SEEDER_ } );
     vp_specific_rngs_[ tid ] = rng_types_[ current_rng_type_ ]->create( { base_seed_, THREAD_SPECIFIC_SEEDER_, vp } );
+    // re-seeded for each target in get_connection_rng()
+    target_keyed_rngs_[ tid ] = rng_types_[ current_rng_type_ ]->create( { base_seed_, TARGET_KEYED_SEEDER_ } );
   }
 }
 
@@ -111,8 +121,10 @@ nest::RandomManager::finalize( const bool adjust_number_of_threads_or_rng_only )
   delete rank_synced_rng_;
   delete_rngs( vp_synced_rngs_ );
   delete_rngs( vp_specific_rngs_ );
+  delete_rngs( target_keyed_rngs_ );
   vp_synced_rngs_.clear();
   vp_specific_rngs_.clear();
+  target_keyed_rngs_.clear();
 
   if ( not adjust_number_of_threads_or_rng_only )
   {
@@ -136,6 +148,7 @@ nest::RandomManager::get_status( DictionaryDatum& d )
   def< ArrayDatum >( d, names::rng_types, rng_types );
   def< long >( d, names::rng_seed, base_seed_ );
   def< std::string >( d, names::rng_type, current_rng_type_ );
+  def< bool >( d, names::connection_rng_keyed_by_target, connection_rng_keyed_by_target_ );
 }
 
 void
@@ -169,6 +182,8 @@ nest::RandomManager::set_status( const DictionaryDatum& d )
     current_rng_type_ = rng_type;
   }
 
+  updateValue< bool >( d, names::connection_rng_keyed_by_target, connection_rng_keyed_by_target_ );
+
   if ( rng_seed_updated or rng_type_updated )
   {
     finalize( /* adjust_number_of_threads_or_rng_only */ true );
@@ -93,6 +93,32 @@ public:
    */
   RngPtr get_vp_specific_rng( size_t tid ) const;
 
+  /**
+   * Get random number generator for creating connections to a given target.
+   *
+   * If connection_rng_keyed_by_target is false, this is the VP-specific
+   * generator of the thread. Otherwise, the thread's target-keyed generator
+   * is re-seeded from the base seed, the number of the current connection
+   * call and the target node ID. All random numbers drawn for the connections
+   * of a target are then independent of the number of threads and ranks and
+   * of the order in which targets are processed.
+   *
+   * Use a counter-based RNG type (Philox, Threefry) with keyed generators,
+   * since re-seeding those is cheap.
+   *
+   * @param tid ID of thread requesting generator
+   * @param target_node_id Node ID of the target of the connections to create
+   */
+  RngPtr get_connection_rng( size_t tid, size_t target_node_id ) const;
+
+  /**
+   * Advance to a fresh set of target-keyed random number streams.
+   *
+   * Must be called in lock-step on all ranks, once for each call creating
+   * connections, so that different calls draw different random numbers.
+   */
+  void advance_connection_stream();
+
   /**
    * Confirm that rank- and thread-synchronized RNGs are in sync.
    *
@@ -129,6 +155,15 @@ private:
   /** Random number generators specific to VPs. */
   std::vector< RngPtr > vp_specific_rngs_;
 
+  /** Random number generators re-seeded for each target during connection creation. */
+  std::vector< RngPtr > target_keyed_rngs_;
+
+  /** Whether connections are created with target-keyed random number generators. */
+  bool connection_rng_keyed_by_target_;
+
+  /** Number of connection calls since the RNGs were last created. */
+  std::uint32_t connection_stream_;
+
   /** RNG type used by default. */
   static const std::string DEFAULT_RNG_TYPE_;
 
@@ -143,6 +178,9 @@ private:
 
   /** Thread-specific seed-sequence initializer component. */
   static const std::uint32_t THREAD_SPECIFIC_SEEDER_;
+
+  /** Target-keyed seed-sequence initializer component. */
+  static const std::uint32_t TARGET_KEYED_SEEDER_;
 };
 
 inline RngPtr
@@ -165,6 +203,28 @@ nest::RandomManager::get_vp_specific_rng( size_t tid ) const
   return vp_specific_rngs_[ tid ];
 }
 
+inline RngPtr
+nest::RandomManager::get_connection_rng( size_t tid, size_t target_node_id ) const
+{
+  assert( tid < static_cast< size_t >( vp_specific_rngs_.size() ) );
+  if ( not connection_rng_keyed_by_target_ )
+  {
+    return vp_specific_rngs_[ tid ];
+  }
+
+  // types required for rng initializer
+  const std::uint32_t target_low = static_cast< std::uint32_t >( target_node_id );
+  const std::uint32_t target_high = static_cast< std::uint32_t >( static_cast< std::uint64_t >( target_node_id ) >> 32 );
+  target_keyed_rngs_[ tid ]->seed( { base_seed_, TARGET_KEYED_SEEDER_, connection_stream_, target_low, target_high } );
+  return target_keyed_rngs_[ tid ];
+}
+
+inline void
+nest::RandomManager::advance_connection_stream()
+{
+  ++connection_stream_;
+}
+
 } // namespace nest
 
 #endif /* RANDOM_MANAGER_H */
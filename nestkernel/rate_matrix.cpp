@@ -0,0 +1,154 @@
+/*
+ *  rate_matrix.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "rate_matrix.h"
+
+// C++ includes:
+#include <unordered_map>
+
+// Includes from nestkernel:
+#include "connector_base.h"
+#include "kernel_manager.h"
+#include "node.h"
+#include "secondary_event.h"
+
+nest::RateMatrix::RateMatrix()
+  : coeff_length_( 0 )
+{
+}
+
+void
+nest::RateMatrix::clear()
+{
+  std::vector< size_t >().swap( row_begin_ );
+  std::vector< std::vector< double >* >().swap( rates_ex_ );
+  std::vector< std::vector< double >* >().swap( rates_in_ );
+  std::vector< size_t >().swap( columns_ );
+  std::vector< double >().swap( weights_ );
+  std::vector< size_t >().swap( source_positions_ );
+  std::vector< double >().swap( source_rates_ );
+}
+
+void
+nest::RateMatrix::build( const size_t tid, const ConnectorBase& connector, const std::vector< size_t >& positions )
+{
+  clear();
+  coeff_length_ = kernel().connection_manager.get_min_delay();
+
+  std::vector< Node* > targets;
+  std::vector< double > weights;
+  connector.get_rate_matrix_entries( tid, targets, weights );
+  assert( targets.size() == positions.size() );
+
+  // assign rows to targets and columns to sources in the order of their
+  // first connection and count the entries of each row
+  std::unordered_map< Node*, size_t > row_of_target;
+  std::unordered_map< size_t, size_t > column_of_position;
+  std::vector< size_t > row_of_entry( targets.size() );
+  std::vector< size_t > row_sizes;
+  for ( size_t lcid = 0; lcid < targets.size(); ++lcid )
+  {
+    if ( not targets[ lcid ] )
+    {
+      continue;
+    }
+
+    const auto row = row_of_target.emplace( targets[ lcid ], rates_ex_.size() );
+    if ( row.second )
+    {
+      std::vector< double >* rates_ex = nullptr;
+      std::vector< double >* rates_in = nullptr;
+      if ( not targets[ lcid ]->get_instantaneous_rate_buffers( rates_ex, rates_in ) )
+      {
+        clear();
+        return;
+      }
+      rates_ex_.push_back( rates_ex );
+      rates_in_.push_back( rates_in );
+      row_sizes.push_back( 0 );
+    }
+    row_of_entry[ lcid ] = row.first->second;
+    ++row_sizes[ row.first->second ];
+
+    if ( column_of_position.emplace( positions[ lcid ], source_positions_.size() ).second )
+    {
+      source_positions_.push_back( positions[ lcid ] );
+    }
+  }
+
+  if ( rates_ex_.empty() )
+  {
+    return;
+  }
+
+  // fill the rows in the order of the connections
+  row_begin_.resize( rates_ex_.size() + 1, 0 );
+  for ( size_t row = 0; row < row_sizes.size(); ++row )
+  {
+    row_begin_[ row + 1 ] = row_begin_[ row ] + row_sizes[ row ];
+  }
+  std::vector< size_t > next_entry( row_begin_.begin(), row_begin_.end() - 1 );
+  columns_.resize( row_begin_.back() );
+  weights_.resize( row_begin_.back() );
+  for ( size_t lcid = 0; lcid < targets.size(); ++lcid )
+  {
+    if ( targets[ lcid ] )
+    {
+      const size_t entry = next_entry[ row_of_entry[ lcid ] ]++;
+      columns_[ entry ] = column_of_position[ positions[ lcid ] ];
+      weights_[ entry ] = weights[ lcid ];
+    }
+  }
+
+  source_rates_.resize( source_positions_.size() * coeff_length_ );
+}
+
+void
+nest::RateMatrix::deliver( std::vector< unsigned int >& recv_buffer )
+{
+  // read the rates of every source only once
+  for ( size_t column = 0; column < source_positions_.size(); ++column )
+  {
+    std::vector< unsigned int >::iterator readpos = recv_buffer.begin() + source_positions_[ column ];
+    double* const rates = &source_rates_[ column * coeff_length_ ];
+    for ( size_t i = 0; i < coeff_length_; ++i )
+    {
+      read_from_comm_buffer( rates[ i ], readpos );
+    }
+  }
+
+  const size_t num_rows = rates_ex_.size();
+  for ( size_t row = 0; row < num_rows; ++row )
+  {
+    for ( size_t entry = row_begin_[ row ]; entry < row_begin_[ row + 1 ]; ++entry )
+    {
+      // same branch on the sign of the weight as in the handlers of the targets
+      const double weight = weights_[ entry ];
+      double* const input = weight >= 0.0 ? rates_ex_[ row ]->data() : rates_in_[ row ]->data();
+      const double* const rates = &source_rates_[ columns_[ entry ] * coeff_length_ ];
+      for ( size_t i = 0; i < coeff_length_; ++i )
+      {
+        input[ i ] += weight * rates[ i ];
+      }
+    }
+  }
+}
@@ -0,0 +1,96 @@
+/*
+ *  rate_matrix.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RATE_MATRIX_H
+#define RATE_MATRIX_H
+
+// C++ includes:
+#include <cstddef>
+#include <vector>
+
+namespace nest
+{
+class ConnectorBase;
+class Node;
+
+/**
+ * Instantaneous rate connections of one synapse model on one thread as a
+ * sparse matrix.
+ *
+ * Instead of deserializing an InstantaneousRateConnectionEvent for every
+ * source and delivering it connection by connection, the rates of all
+ * sources are read from the receive buffer of secondary events once and
+ * multiplied by the matrix of connection weights, which is stored in
+ * compressed sparse row (CSR) format with one row per target node. The
+ * products are added to the input buffers of the targets, which are
+ * obtained from Node::get_instantaneous_rate_buffers().
+ *
+ * Each row holds the connections to its target in the order of the
+ * connections in the Connector, so that the rates are added to the
+ * buffers of the target in the same order as by event delivery and the
+ * results are identical.
+ */
+class RateMatrix
+{
+public:
+  RateMatrix();
+
+  /**
+   * Build the matrix from the connections of a connector.
+   *
+   * positions holds the position in the receive buffer of secondary
+   * events from which each connection reads the rates of its source. If
+   * any target does not provide instantaneous rate buffers, the matrix
+   * is left empty and the connections are delivered as events.
+   */
+  void build( const size_t tid, const ConnectorBase& connector, const std::vector< size_t >& positions );
+
+  //! Remove all entries
+  void clear();
+
+  //! Return true if the matrix replaces event delivery for its connections
+  bool is_built() const;
+
+  //! Add the weighted rates of all sources to the input buffers of all targets
+  void deliver( std::vector< unsigned int >& recv_buffer );
+
+private:
+  size_t coeff_length_; //!< number of rates sent by each source per interval
+
+  std::vector< size_t > row_begin_;                //!< index of the first entry of each row, and the number of entries
+  std::vector< std::vector< double >* > rates_ex_; //!< excitatory input buffer of the target of each row
+  std::vector< std::vector< double >* > rates_in_; //!< inhibitory input buffer of the target of each row
+  std::vector< size_t > columns_;                  //!< column of each entry
+  std::vector< double > weights_;                  //!< weight of each entry
+  std::vector< size_t > source_positions_;         //!< position of the rates of each column in the receive buffer
+  std::vector< double > source_rates_;             //!< rates of all columns in the current interval
+};
+
+inline bool
+RateMatrix::is_built() const
+{
+  return not row_begin_.empty();
+}
+
+} // namespace nest
+
+#endif /* #ifndef RATE_MATRIX_H */
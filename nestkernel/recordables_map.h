@@ -66,13 +66,25 @@ class RecordablesMap : public std::map< Name, double ( HostNode::* )() const >
   typedef std::map< Name, double ( HostNode::* )() const > Base_;
 
 public:
+  RecordablesMap()
+  {
+    instance_ = this;
+  }
+
   virtual ~RecordablesMap()
   {
+    if ( instance_ == this )
+    {
+      instance_ = nullptr;
+    }
   }
 
   //! Datatype for access functions
   typedef double ( HostNode::*DataAccessFct )() const;
 
+  //! Datatype for functions setting a recordable
+  typedef void ( HostNode::*DataSetFct )( double );
+
   /**
    * Create the map.
    *
@@ -104,6 +116,41 @@ public:
     // return recordables_;
   }
 
+  /**
+   * Return the access function of recordable n of HostNode.
+   *
+   * Returns nullptr if HostNode has no recordables map or n is not a
+   * recordable. Used for bulk access to the recordables of many nodes,
+   * see NodeManager::get_values().
+   */
+  static DataAccessFct
+  get_access_function( const Name& n )
+  {
+    if ( not instance_ )
+    {
+      return nullptr;
+    }
+    const typename Base_::const_iterator it = instance_->find( n );
+    return it == instance_->end() ? nullptr : it->second;
+  }
+
+  /**
+   * Return the function setting recordable n of HostNode.
+   *
+   * Returns nullptr if n cannot be set without calling set_status(),
+   * see NodeManager::set_values().
+   */
+  static DataSetFct
+  get_set_function( const Name& n )
+  {
+    if ( not instance_ )
+    {
+      return nullptr;
+    }
+    const typename std::map< Name, DataSetFct >::const_iterator it = instance_->set_functions_.find( n );
+    return it == instance_->set_functions_.end() ? nullptr : it->second;
+  }
+
 private:
   //! Insertion functions to be used in create(), adds entry to map and list
   void
@@ -116,6 +163,25 @@ private:
     // recordables_.push_back(LiteralDatum(n));
   }
 
+  /**
+   * Insert recordable n that can also be set directly by s.
+   *
+   * Only variables that set_status() sets without checks or side effects
+   * may be registered with a set function.
+   */
+  void
+  insert_( const Name& n, const DataAccessFct f, const DataSetFct s )
+  {
+    insert_( n, f );
+    set_functions_.insert( std::make_pair( n, s ) );
+  }
+
+  //! Functions setting recordables directly, a subset of the recordables
+  std::map< Name, DataSetFct > set_functions_;
+
+  //! The static instance of the map for HostNode, if any
+  static RecordablesMap* instance_;
+
   /**
    * SLI list of names of recordables
    *
@@ -126,6 +192,9 @@ private:
   // ArrayDatum recordables_;
 };
 
+template < typename HostNode >
+RecordablesMap< HostNode >* RecordablesMap< HostNode >::instance_ = nullptr;
+
 template < typename HostNode >
 void
 RecordablesMap< HostNode >::create()
@@ -22,7 +22,48 @@
 
 #include "recording_backend.h"
 
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "event.h"
+#include "exceptions.h"
+#include "recording_device.h"
+
 const std::vector< Name > nest::RecordingBackend::NO_DOUBLE_VALUE_NAMES;
 const std::vector< Name > nest::RecordingBackend::NO_LONG_VALUE_NAMES;
 const std::vector< double > nest::RecordingBackend::NO_DOUBLE_VALUES;
 const std::vector< long > nest::RecordingBackend::NO_LONG_VALUES;
+
+void
+nest::RecordingBackend::write_samples( const RecordingDevice& device,
+  const Time& stamp,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& double_values )
+{
+  if ( senders.empty() )
+  {
+    return;
+  }
+
+  const size_t num_values = double_values.size() / senders.size();
+  std::vector< double > values( num_values );
+
+  const DataLoggingReply::Container no_data;
+  DataLoggingReply event( no_data );
+  event.set_stamp( stamp );
+
+  for ( size_t i = 0; i < senders.size(); ++i )
+  {
+    event.set_sender_node_id( senders[ i ] );
+    std::copy( double_values.begin() + i * num_values, double_values.begin() + ( i + 1 ) * num_values, values.begin() );
+    write( device, event, values, NO_LONG_VALUES );
+  }
+}
+
+size_t
+nest::RecordingBackend::get_device_events( const RecordingDevice& device, const size_t, DictionaryDatum& ) const
+{
+  throw KernelException(
+    String::compose( "The recording backend of device %1 does not keep recorded events.", device.get_node_id() ) );
+}
@@ -35,6 +35,7 @@ namespace nest
 
 class RecordingDevice;
 class Event;
+class Time;
 
 /**
  * Abstract base class for all NESTio recording backends
@@ -236,6 +237,25 @@ public:
     const std::vector< double >& double_values,
     const std::vector< long >& long_values ) = 0;
 
+  /**
+   * Write one sample of each of the given senders for the time step stamp.
+   *
+   * The values of all senders are given one after the other in
+   * @p double_values, which contains the same number of values for each
+   * sender. The default implementation calls write() once per sender.
+   * Backends can override this function to store the block in one go.
+   *
+   * @param device the RecordingDevice, backend-specific channel to write to
+   * @param stamp the time of the samples
+   * @param senders node IDs of the senders of the samples
+   * @param double_values values of all senders
+   *
+   */
+  virtual void write_samples( const RecordingDevice& device,
+    const Time& stamp,
+    const std::vector< size_t >& senders,
+    const std::vector< double >& double_values );
+
   /**
    * Set the status of the recording backend using the key-value pairs
    * contained in the params dictionary.
@@ -303,6 +323,26 @@ public:
    */
   virtual void get_device_status( const RecordingDevice& device, DictionaryDatum& params ) const = 0;
 
+  /**
+   * Append the events stored for the given recording device from the
+   * given position on to the arrays in the given events dictionary.
+   *
+   * Positions count all events the backend has stored for the device
+   * instance, including events that have been removed since, so that a
+   * caller can read events incrementally by passing the position
+   * returned by the previous call. The default implementation throws
+   * KernelException, as only backends that keep events in memory can
+   * provide them.
+   *
+   * @param device the recording device for which events are returned
+   * @param first position of the first event to return
+   * @param events dictionary of arrays to append the events to
+   *
+   * @returns the position after the last event stored for the device
+   *
+   */
+  virtual size_t get_device_events( const RecordingDevice& device, const size_t first, DictionaryDatum& events ) const;
+
   static const std::vector< Name > NO_DOUBLE_VALUE_NAMES;
   static const std::vector< Name > NO_LONG_VALUE_NAMES;
   static const std::vector< double > NO_DOUBLE_VALUES;
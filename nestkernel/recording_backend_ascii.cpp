@@ -20,6 +20,9 @@
  *
  */
 
+// C++ includes:
+#include <cstdio>
+
 // Includes from libnestutil:
 #include "compose.hpp"
 
@@ -108,6 +111,17 @@ nest::RecordingBackendASCII::pre_run_hook()
 void
 nest::RecordingBackendASCII::post_run_hook()
 {
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.write_buffer();
+    }
+  }
+
+  // wait once for the records of all devices before flushing the files
+  kernel().io_manager.wait_for_async_writes();
+
   for ( auto& inner : device_data_ )
   {
     for ( auto& device_data : inner )
@@ -126,6 +140,17 @@ nest::RecordingBackendASCII::post_step_hook()
 void
 nest::RecordingBackendASCII::cleanup()
 {
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.write_buffer();
+    }
+  }
+
+  // wait once for the records of all devices before closing the files
+  kernel().io_manager.wait_for_async_writes();
+
   for ( auto& inner : device_data_ )
   {
     for ( auto& device_data : inner )
@@ -239,9 +264,24 @@ nest::RecordingBackendASCII::DeviceData::set_value_names( const std::vector< Nam
   long_value_names_ = long_value_names;
 }
 
+void
+nest::RecordingBackendASCII::DeviceData::write_buffer()
+{
+  if ( buffer_.empty() )
+  {
+    return;
+  }
+
+  // hand the records to the I/O thread of the IOManager, so that the
+  // simulation does not wait for the file system
+  kernel().io_manager.write_async( file_, std::move( buffer_ ) );
+  buffer_ = IOManager::AsyncBuffer();
+}
+
 void
 nest::RecordingBackendASCII::DeviceData::flush_file()
 {
+  // all records must have been written, see RecordingBackendASCII::post_run_hook()
   file_.flush();
 }
 
@@ -291,6 +331,7 @@ nest::RecordingBackendASCII::DeviceData::open_file()
 void
 nest::RecordingBackendASCII::DeviceData::close_file()
 {
+  // all records must have been written, see RecordingBackendASCII::cleanup()
   file_.close();
 }
 
@@ -299,27 +340,86 @@ nest::RecordingBackendASCII::DeviceData::write( const Event& event,
   const std::vector< double >& double_values,
   const std::vector< long >& long_values )
 {
-  file_ << event.get_sender_node_id() << "\t";
+  if ( buffer_.empty() )
+  {
+    buffer_.reserve( BUFFER_SIZE );
+  }
+
+  append_( event.get_sender_node_id() );
+  append_( '\t' );
 
   if ( time_in_steps_ )
   {
-    file_ << event.get_stamp().get_steps() << "\t" << event.get_offset();
+    append_( event.get_stamp().get_steps() );
+    append_( '\t' );
+    append_( event.get_offset() );
   }
   else
   {
-    file_ << ( event.get_stamp().get_ms() - event.get_offset() );
+    append_( event.get_stamp().get_ms() - event.get_offset() );
   }
 
   for ( auto& val : double_values )
   {
-    file_ << "\t" << val;
+    append_( '\t' );
+    append_( val );
   }
   for ( auto& val : long_values )
   {
-    file_ << "\t" << val;
+    append_( '\t' );
+    append_( val );
+  }
+
+  append_( '\n' );
+
+  if ( buffer_.size() >= BUFFER_SIZE )
+  {
+    write_buffer();
   }
+}
 
-  file_ << "\n";
+void
+nest::RecordingBackendASCII::DeviceData::append_( size_t value )
+{
+  char text[ 24 ];
+  const int n = std::snprintf( text, sizeof( text ), "%zu", value );
+  buffer_.insert( buffer_.end(), text, text + n );
+}
+
+void
+nest::RecordingBackendASCII::DeviceData::append_( long value )
+{
+  char text[ 24 ];
+  const int n = std::snprintf( text, sizeof( text ), "%ld", value );
+  buffer_.insert( buffer_.end(), text, text + n );
+}
+
+void
+nest::RecordingBackendASCII::DeviceData::append_( double value )
+{
+  // same format as writing to a stream with std::fixed and
+  // std::setprecision( precision_ ), as done for the header
+  const int precision = static_cast< int >( precision_ );
+  char text[ 64 ];
+  const int n = std::snprintf( text, sizeof( text ), "%.*f", precision, value );
+  if ( static_cast< size_t >( n ) < sizeof( text ) )
+  {
+    buffer_.insert( buffer_.end(), text, text + n );
+  }
+  else
+  {
+    // very large values or many decimal places
+    const size_t pos = buffer_.size();
+    buffer_.resize( pos + n + 1 );
+    std::snprintf( buffer_.data() + pos, n + 1, "%.*f", precision, value );
+    buffer_.resize( pos + n );
+  }
+}
+
+void
+nest::RecordingBackendASCII::DeviceData::append_( char c )
+{
+  buffer_.push_back( c );
 }
 
 void
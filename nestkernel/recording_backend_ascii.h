@@ -26,6 +26,7 @@
 // C++ includes:
 #include <fstream>
 
+#include "io_manager.h"
 #include "recording_backend.h"
 
 /* BeginUserDocs: NOINDEX
@@ -69,6 +70,11 @@ to ``Run`` in between a pair of ``Prepare`` and ``Cleanup`` calls will
 be written to the same file, while the call to ``Run`` will flush all
 data to the file, so it is available for immediate inspection.
 
+During ``Run``, records are formatted into a buffer per recording
+device and thread. Full buffers are handed to the I/O thread of the
+kernel, which writes them to the file in the background, while the
+simulation continues.
+
 If the file name already exists when creating a new recording, the
 call to ``Prepare`` will fail with a ``FileExists`` error. To overwrite
 the old file, the kernel property ``overwrite_files`` can be set to
@@ -199,6 +205,7 @@ private:
     void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
     void open_file();
     void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void write_buffer(); //!< Hand the formatted records to the I/O thread
     void flush_file();
     void close_file();
     void get_status( DictionaryDatum& ) const;
@@ -215,7 +222,22 @@ private:
     std::vector< Name > double_value_names_; //!< names for values of type double
     std::vector< Name > long_value_names_;   //!< names for values of type long
 
+    /**
+     * Records formatted since they were last handed to the I/O thread.
+     *
+     * The buffer is handed over once it holds BUFFER_SIZE bytes, at the
+     * end of each call to Run and on Cleanup.
+     */
+    IOManager::AsyncBuffer buffer_;
+
+    //! Number of bytes collected before the buffer is handed to the I/O thread
+    static constexpr size_t BUFFER_SIZE = 65536;
+
     std::string compute_filename_() const; //!< Compose and return the filename
+    void append_( size_t value );          //!< Append an integer to the buffer
+    void append_( long value );            //!< Append an integer to the buffer
+    void append_( double value );          //!< Append a decimal number with precision_ decimal places to the buffer
+    void append_( char c );                //!< Append a single character to the buffer
   };
 
   typedef std::vector< std::map< size_t, DeviceData > > data_map;
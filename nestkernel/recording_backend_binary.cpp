@@ -0,0 +1,532 @@
+/*
+ *  recording_backend_binary.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// C++ includes:
+#include <cstring>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "recording_device.h"
+#include "vp_manager_impl.h"
+
+// includes from sli:
+#include "dictutils.h"
+
+#include "recording_backend_binary.h"
+
+const unsigned int nest::RecordingBackendBinary::BINARY_REC_BACKEND_VERSION = 1;
+
+nest::RecordingBackendBinary::RecordingBackendBinary()
+{
+}
+
+nest::RecordingBackendBinary::~RecordingBackendBinary() throw()
+{
+}
+
+void
+nest::RecordingBackendBinary::initialize()
+{
+  data_map tmp( kernel().vp_manager.get_num_threads() );
+  device_data_.swap( tmp );
+}
+
+void
+nest::RecordingBackendBinary::finalize()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::enroll( const RecordingDevice& device, const DictionaryDatum& params )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    std::string vp_node_id_string = compute_vp_node_id_string_( device );
+    std::string modelname = device.get_name();
+    auto p = device_data_[ t ].insert( std::make_pair( node_id, DeviceData( modelname, vp_node_id_string ) ) );
+    device_data = p.first;
+  }
+
+  device_data->second.set_status( params );
+}
+
+void
+nest::RecordingBackendBinary::disenroll( const RecordingDevice& device )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data_[ t ].erase( device_data );
+  }
+}
+
+void
+nest::RecordingBackendBinary::set_value_names( const RecordingDevice& device,
+  const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  assert( device_data != device_data_[ t ].end() );
+  device_data->second.set_value_names( double_value_names, long_value_names );
+}
+
+void
+nest::RecordingBackendBinary::pre_run_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::post_run_hook()
+{
+  // hand the events collected so far to the I/O thread, but let the
+  // next run continue while they are written
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.write_chunk();
+    }
+  }
+}
+
+void
+nest::RecordingBackendBinary::post_step_hook()
+{
+  // nothing to do, chunks are written from write() once the buffers are full
+}
+
+void
+nest::RecordingBackendBinary::cleanup()
+{
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.write_chunk();
+    }
+  }
+
+  // wait once for the chunks of all devices before closing the files
+  kernel().io_manager.wait_for_async_writes();
+
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.close_file();
+    }
+  }
+}
+
+void
+nest::RecordingBackendBinary::write( const RecordingDevice& device,
+  const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  device_data->second.write( event, double_values, long_values );
+}
+
+void
+nest::RecordingBackendBinary::write_samples( const RecordingDevice& device,
+  const Time& stamp,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& double_values )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  device_data->second.write_samples( stamp, senders, double_values );
+}
+
+const std::string
+nest::RecordingBackendBinary::compute_vp_node_id_string_( const RecordingDevice& device ) const
+{
+  const double num_vps = kernel().vp_manager.get_num_virtual_processes();
+  const double num_nodes = kernel().node_manager.size();
+  const int vp_digits = static_cast< int >( std::floor( std::log10( num_vps ) ) + 1 );
+  const int node_id_digits = static_cast< int >( std::floor( std::log10( num_nodes ) ) + 1 );
+
+  std::ostringstream vp_node_id_string;
+  vp_node_id_string << "-" << std::setfill( '0' ) << std::setw( node_id_digits ) << device.get_node_id() << "-"
+                    << std::setfill( '0' ) << std::setw( vp_digits ) << device.get_vp();
+
+  return vp_node_id_string.str();
+}
+
+void
+nest::RecordingBackendBinary::prepare()
+{
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_info : inner )
+    {
+      device_info.second.open_file();
+    }
+  }
+}
+
+void
+nest::RecordingBackendBinary::set_status( const DictionaryDatum& )
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::get_status( DictionaryDatum& ) const
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::check_device_status( const DictionaryDatum& params ) const
+{
+  DeviceData dd( "", "" );
+  dd.set_status( params ); // throws if params contains invalid entries
+}
+
+void
+nest::RecordingBackendBinary::get_device_defaults( DictionaryDatum& params ) const
+{
+  DeviceData dd( "", "" );
+  dd.get_status( params );
+}
+
+void
+nest::RecordingBackendBinary::get_device_status( const nest::RecordingDevice& device, DictionaryDatum& d ) const
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::const_iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data->second.get_status( d );
+  }
+}
+
+/* ******************* Device meta data class DeviceData ******************* */
+
+nest::RecordingBackendBinary::DeviceData::DeviceData( std::string modelname, std::string vp_node_id_string )
+  : buffer_size_( 16384 )
+  , modelname_( modelname )
+  , vp_node_id_string_( vp_node_id_string )
+  , file_extension_( "bin" )
+  , label_( "" )
+  , n_rows_( 0 )
+{
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::set_value_names( const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  double_value_names_ = double_value_names;
+  long_value_names_ = long_value_names;
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::open_file()
+{
+  std::string filename = compute_filename_();
+
+  // append to the file created by an earlier simulation if its header still applies
+  if ( filename == created_filename_ and double_value_names_ == created_double_value_names_
+    and long_value_names_ == created_long_value_names_ )
+  {
+    file_.open( filename.c_str(), std::ios::binary | std::ios::app );
+    if ( not file_.good() )
+    {
+      std::string msg = String::compose( "I/O error while opening file '%1'.", filename );
+      LOG( M_ERROR, "RecordingBackendBinary::prepare()", msg );
+      throw IOError();
+    }
+    return;
+  }
+
+  std::ifstream test( filename.c_str() );
+  if ( test.good() and not kernel().io_manager.overwrite_files() )
+  {
+    std::string msg = String::compose(
+      "The file '%1' already exists and overwriting files is disabled. To overwrite files, set "
+      "the kernel property overwrite_files to true. To change the name or location of the file, "
+      "change the kernel properties data_path or data_prefix, or the device property label.",
+      filename );
+    LOG( M_ERROR, "RecordingBackendBinary::enroll()", msg );
+    throw IOError();
+  }
+  test.close();
+
+  file_.open( filename.c_str(), std::ios::binary | std::ios::trunc );
+
+  if ( not file_.good() )
+  {
+    std::string msg = String::compose( "I/O error while opening file '%1'.", filename );
+    LOG( M_ERROR, "RecordingBackendBinary::prepare()", msg );
+    throw IOError();
+  }
+
+  const char magic[ 8 ] = { 'N', 'E', 'S', 'T', 'B', 'I', 'N', '\0' };
+  const std::uint32_t header[ 4 ] = { BINARY_REC_BACKEND_VERSION,
+    0x01020304,
+    static_cast< std::uint32_t >( double_value_names_.size() ),
+    static_cast< std::uint32_t >( long_value_names_.size() ) };
+  const double resolution = Time::get_resolution().get_ms();
+
+  write_raw_( magic, 8 );
+  write_raw_( header, 4 );
+  write_raw_( &resolution, 1 );
+  std::vector< Name > value_names( double_value_names_ );
+  value_names.insert( value_names.end(), long_value_names_.begin(), long_value_names_.end() );
+  for ( const auto& name : value_names )
+  {
+    const std::string& value_name = name.toString();
+    const std::uint32_t length = value_name.size();
+    write_raw_( &length, 1 );
+    write_raw_( value_name.data(), length );
+  }
+
+  created_filename_ = filename;
+  created_double_value_names_ = double_value_names_;
+  created_long_value_names_ = long_value_names_;
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::close_file()
+{
+  // all chunks must have been written, see RecordingBackendBinary::cleanup()
+  if ( file_.is_open() )
+  {
+    file_.close();
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::write( const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  assert( double_values.size() == double_value_names_.size() );
+  assert( long_values.size() == long_value_names_.size() );
+
+  if ( n_rows_ == 0 )
+  {
+    prepare_chunk_();
+  }
+
+  set_< std::int64_t >( 0, event.get_sender_node_id() );
+  set_< std::int64_t >( 1, event.get_stamp().get_steps() );
+  set_< double >( 2, event.get_offset() );
+  for ( size_t i = 0; i < double_values.size(); ++i )
+  {
+    set_< double >( 3 + i, double_values[ i ] );
+  }
+  for ( size_t i = 0; i < long_values.size(); ++i )
+  {
+    set_< std::int64_t >( 3 + double_values.size() + i, long_values[ i ] );
+  }
+
+  if ( ++n_rows_ == static_cast< size_t >( buffer_size_ ) )
+  {
+    write_chunk();
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::write_samples( const Time& stamp,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& double_values )
+{
+  const size_t num_values = double_value_names_.size();
+  assert( double_values.size() == senders.size() * num_values );
+  assert( long_value_names_.empty() );
+
+  const long step = stamp.get_steps();
+  for ( size_t k = 0; k < senders.size(); ++k )
+  {
+    if ( n_rows_ == 0 )
+    {
+      prepare_chunk_();
+    }
+
+    set_< std::int64_t >( 0, senders[ k ] );
+    set_< std::int64_t >( 1, step );
+    set_< double >( 2, 0.0 );
+    for ( size_t i = 0; i < num_values; ++i )
+    {
+      set_< double >( 3 + i, double_values[ k * num_values + i ] );
+    }
+
+    if ( ++n_rows_ == static_cast< size_t >( buffer_size_ ) )
+    {
+      write_chunk();
+    }
+  }
+}
+
+size_t
+nest::RecordingBackendBinary::DeviceData::num_columns_() const
+{
+  return 3 + double_value_names_.size() + long_value_names_.size();
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::prepare_chunk_()
+{
+  chunk_.resize( sizeof( std::uint64_t ) + num_columns_() * buffer_size_ * sizeof( std::int64_t ) );
+}
+
+template < typename T >
+void
+nest::RecordingBackendBinary::DeviceData::set_( size_t column, T value )
+{
+  static_assert( sizeof( T ) == sizeof( std::int64_t ), "all columns have 64 bit entries" );
+  char* entry = chunk_.data() + sizeof( std::uint64_t ) + ( column * buffer_size_ + n_rows_ ) * sizeof( T );
+  std::memcpy( entry, &value, sizeof( T ) );
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::write_chunk()
+{
+  if ( n_rows_ == 0 )
+  {
+    return;
+  }
+
+  const std::uint64_t n_rows = n_rows_;
+  std::memcpy( chunk_.data(), &n_rows, sizeof( n_rows ) );
+
+  // move the columns of a partially filled chunk together
+  char* columns = chunk_.data() + sizeof( n_rows );
+  const size_t column_bytes = n_rows_ * sizeof( std::int64_t );
+  if ( n_rows_ < static_cast< size_t >( buffer_size_ ) )
+  {
+    for ( size_t i = 1; i < num_columns_(); ++i )
+    {
+      std::memmove( columns + i * column_bytes, columns + i * buffer_size_ * sizeof( std::int64_t ), column_bytes );
+    }
+    chunk_.resize( sizeof( n_rows ) + num_columns_() * column_bytes );
+  }
+
+  // hand the chunk to the I/O thread of the IOManager, so that the
+  // simulation does not wait for the file system
+  kernel().io_manager.write_async( file_, std::move( chunk_ ) );
+  chunk_ = IOManager::AsyncBuffer();
+  n_rows_ = 0;
+}
+
+template < typename T >
+void
+nest::RecordingBackendBinary::DeviceData::write_raw_( const T* data, size_t n )
+{
+  file_.write( reinterpret_cast< const char* >( data ), n * sizeof( T ) );
+
+  if ( not file_.good() )
+  {
+    std::string msg = String::compose( "I/O error while writing file '%1'.", compute_filename_() );
+    LOG( M_ERROR, "RecordingBackendBinary::write()", msg );
+    throw IOError();
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::get_status( DictionaryDatum& d ) const
+{
+  ( *d )[ names::buffer_size ] = buffer_size_;
+  ( *d )[ names::file_extension ] = file_extension_;
+
+  std::string filename = compute_filename_();
+  initialize_property_array( d, names::filenames );
+  append_property( d, names::filenames, filename );
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::set_status( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::file_extension, file_extension_ );
+  updateValue< std::string >( d, names::label, label_ );
+
+  long buffer_size = buffer_size_;
+  if ( updateValue< long >( d, names::buffer_size, buffer_size ) and buffer_size != buffer_size_ )
+  {
+    if ( buffer_size < 1 )
+    {
+      throw BadProperty( "buffer_size must be positive." );
+    }
+
+    // write events collected so far with the old layout before resizing
+    if ( file_.is_open() )
+    {
+      write_chunk();
+    }
+    buffer_size_ = buffer_size;
+  }
+}
+
+std::string
+nest::RecordingBackendBinary::DeviceData::compute_filename_() const
+{
+  std::string data_path = kernel().io_manager.get_data_path();
+  if ( not data_path.empty() and not( data_path[ data_path.size() - 1 ] == '/' ) )
+  {
+    data_path += '/';
+  }
+
+  std::string label = label_;
+  if ( label.empty() )
+  {
+    label = modelname_;
+  }
+
+  std::string data_prefix = kernel().io_manager.get_data_prefix();
+
+  return data_path + data_prefix + label + vp_node_id_string_ + "." + file_extension_;
+}
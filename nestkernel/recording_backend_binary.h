@@ -0,0 +1,235 @@
+/*
+ *  recording_backend_binary.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_BACKEND_BINARY_H
+#define RECORDING_BACKEND_BINARY_H
+
+// C++ includes:
+#include <cstdint>
+#include <fstream>
+
+#include "io_manager.h"
+#include "recording_backend.h"
+
+/* BeginUserDocs: NOINDEX
+
+Recording backend `binary` - Write data to binary columnar files
+----------------------------------------------------------------
+
+Description
+~~~~~~~~~~~
+
+The `binary` recording backend writes collected data persistently to
+files in a compact binary format. It is meant for large simulations,
+in which formatting every event as text would take more time than the
+simulation itself.
+
+Like the :doc:`ascii </models/recording_backend_ascii>` backend, this
+backend opens one file per recording device per thread on each MPI
+process, using the same naming pattern:
+
+::
+
+   data_path/data_prefix(label|model_name)-node_id-vp.file_extension
+
+Events are collected per thread in memory and handed to the I/O thread
+of the kernel as column chunks once ``buffer_size`` events have been
+collected, at the end of each call to ``Run`` and on ``Cleanup``. The
+I/O thread writes the chunks to the files in the background, while the
+simulation continues. Files are complete only after ``Cleanup``, which
+is also called at the end of ``Simulate``.
+
+A file is created when a device records to it for the first time. If
+the file exists already, it is only overwritten if the kernel property
+``overwrite_files`` is set. Subsequent simulations append their data to
+the file as further chunks, unless the name of the file or the recorded
+values changed, in which case a new file is created. Files are created
+anew after ``ResetKernel``.
+
+Data format
+~~~~~~~~~~~
+
+All numbers are stored in the native byte order of the machine that
+wrote the file. A file consists of a header followed by any number of
+chunks.
+
+The header contains:
+
+1. the 8 byte magic string ``NESTBIN`` terminated by a null byte,
+2. the format version as 32 bit unsigned integer,
+3. the 32 bit unsigned integer ``0x01020304`` to detect the byte order,
+4. the number of floating point value columns as 32 bit unsigned integer,
+5. the number of integer value columns as 32 bit unsigned integer,
+6. the simulation resolution in ms as 64 bit floating point number,
+7. the names of all floating point columns, followed by the names of
+   all integer columns, each given as 32 bit unsigned length followed
+   by the characters of the name.
+
+Each chunk starts with the number of rows *n* as 64 bit unsigned
+integer, followed by the columns, each consisting of *n* consecutive
+values: the sender node IDs (64 bit integers), the time steps (64 bit
+integers), the negative offsets in ms from the time step (64 bit
+floating point numbers), the floating point value columns (64 bit
+each) and the integer value columns (64 bit each). The time of an
+event in ms is given by ``step * resolution - offset``.
+
+From Python, files can be read with :py:func:`.ReadBinaryRecording`,
+which returns a dictionary of NumPy arrays.
+
+Parameter summary
+~~~~~~~~~~~~~~~~~
+
+buffer_size
+    An integer (default: *16384*) that specifies the number of events
+    collected per device and thread before a chunk is written.
+
+file_extension
+    A string (default: *"bin"*) that specifies the file name extension,
+    without leading dot.
+
+filenames
+    A list of the filenames where data is recorded to. This list has one
+    entry per local thread and is a read-only property.
+
+label
+    A string (default: *""*) that replaces the model name component in
+    the filename if it is set.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * Binary specialization of the RecordingBackend interface.
+ *
+ * RecordingBackendBinary maintains one file and one set of column
+ * buffers for every recording device instance on every thread. Events
+ * are appended to the column buffers by write() and the buffers are
+ * written to the file as a single chunk when they are full or when a
+ * run ends. Files are opened in prepare() and closed in cleanup().
+ */
+class RecordingBackendBinary : public RecordingBackend
+{
+public:
+  const static unsigned int BINARY_REC_BACKEND_VERSION;
+
+  RecordingBackendBinary();
+
+  ~RecordingBackendBinary() throw() override;
+
+  void initialize() override;
+
+  void finalize() override;
+
+  void enroll( const RecordingDevice& device, const DictionaryDatum& params ) override;
+
+  void disenroll( const RecordingDevice& device ) override;
+
+  void set_value_names( const RecordingDevice& device,
+    const std::vector< Name >& double_value_names,
+    const std::vector< Name >& long_value_names ) override;
+
+  void prepare() override;
+
+  void cleanup() override;
+
+  void pre_run_hook() override;
+
+  /**
+   * Hand buffered data to the I/O thread after a single call to Run
+   */
+  void post_run_hook() override;
+
+  void post_step_hook() override;
+
+  void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+
+  void write_samples( const RecordingDevice&,
+    const Time&,
+    const std::vector< size_t >&,
+    const std::vector< double >& ) override;
+
+  void set_status( const DictionaryDatum& ) override;
+  void get_status( DictionaryDatum& ) const override;
+
+  void check_device_status( const DictionaryDatum& ) const override;
+  void get_device_defaults( DictionaryDatum& ) const override;
+  void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
+
+private:
+  const std::string compute_vp_node_id_string_( const RecordingDevice& device ) const;
+
+  struct DeviceData
+  {
+    DeviceData() = delete;
+    DeviceData( std::string, std::string );
+    void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
+    void open_file();
+    void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void write_samples( const Time&, const std::vector< size_t >&, const std::vector< double >& );
+    void write_chunk();
+    void close_file();
+    void get_status( DictionaryDatum& ) const;
+    void set_status( const DictionaryDatum& );
+
+  private:
+    long buffer_size_;                       //!< Number of events collected before a chunk is written
+    std::string modelname_;                  //!< File name up to but not including the "."
+    std::string vp_node_id_string_;          //!< The vp and node ID component of the filename
+    std::string file_extension_;             //!< File name extension without leading "."
+    std::string label_;                      //!< The label of the device.
+    std::ofstream file_;                     //!< File stream to use for the device
+    std::vector< Name > double_value_names_; //!< names for values of type double
+    std::vector< Name > long_value_names_;   //!< names for values of type long
+
+    std::string created_filename_;                   //!< Name of the file created by the device, empty if none
+    std::vector< Name > created_double_value_names_; //!< Double value names in the header of the created file
+    std::vector< Name > created_long_value_names_;   //!< Long value names in the header of the created file
+
+    /**
+     * Chunk of events in the format of the file.
+     *
+     * The chunk holds the row count and buffer_size_ rows in each column.
+     * Columns of a partially filled chunk are moved together before the
+     * chunk is handed to the I/O thread, so that events are not copied
+     * into a separate buffer.
+     */
+    IOManager::AsyncBuffer chunk_;
+    size_t n_rows_; //!< Number of events currently in the chunk
+
+    std::string compute_filename_() const; //!< Compose and return the filename
+    size_t num_columns_() const;           //!< Number of columns including senders, steps and offsets
+    void prepare_chunk_();                 //!< Size the chunk according to buffer_size_
+    template < typename T >
+    void set_( size_t column, T value ); //!< Store value in the current row of a column
+    template < typename T >
+    void write_raw_( const T* data, size_t n ); //!< Write n values from data to the file
+  };
+
+  typedef std::vector< std::map< size_t, DeviceData > > data_map;
+  data_map device_data_;
+};
+
+} // namespace
+
+#endif /* #ifndef RECORDING_BACKEND_BINARY_H */
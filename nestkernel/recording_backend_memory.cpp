@@ -20,6 +20,9 @@
  *
  */
 
+// C++ includes:
+#include <algorithm>
+
 // Includes from nestkernel:
 #include "recording_device.h"
 #include "vp_manager_impl.h"
@@ -112,6 +115,18 @@ nest::RecordingBackendMemory::write( const RecordingDevice& device,
   device_data_[ t ][ node_id ].push_back( event, double_values, long_values );
 }
 
+void
+nest::RecordingBackendMemory::write_samples( const RecordingDevice& device,
+  const Time& stamp,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& double_values )
+{
+  size_t t = device.get_thread();
+  size_t node_id = device.get_node_id();
+
+  device_data_[ t ][ node_id ].push_back_samples( stamp, senders, double_values );
+}
+
 void
 nest::RecordingBackendMemory::check_device_status( const DictionaryDatum& params ) const
 {
@@ -139,6 +154,23 @@ nest::RecordingBackendMemory::get_device_status( const RecordingDevice& device,
   }
 }
 
+size_t
+nest::RecordingBackendMemory::get_device_events( const RecordingDevice& device,
+  const size_t first,
+  DictionaryDatum& events ) const
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  const auto device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    return first;
+  }
+
+  return device_data->second.get_events( first, events );
+}
+
 void
 nest::RecordingBackendMemory::post_run_hook()
 {
@@ -173,6 +205,8 @@ nest::RecordingBackendMemory::prepare()
 
 nest::RecordingBackendMemory::DeviceData::DeviceData()
   : time_in_steps_( false )
+  , clear_on_read_( false )
+  , n_removed_( 0 )
 {
 }
 
@@ -215,7 +249,41 @@ nest::RecordingBackendMemory::DeviceData::push_back( const Event& event,
 }
 
 void
-nest::RecordingBackendMemory::DeviceData::get_status( DictionaryDatum& d ) const
+nest::RecordingBackendMemory::DeviceData::push_back_samples( const Time& stamp,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& double_values )
+{
+  const size_t n = senders.size();
+  assert( double_values.size() == n * double_values_.size() );
+
+  senders_.insert( senders_.end(), senders.begin(), senders.end() );
+
+  if ( time_in_steps_ )
+  {
+    times_steps_.insert( times_steps_.end(), n, stamp.get_steps() );
+    times_offset_.insert( times_offset_.end(), n, 0.0 );
+  }
+  else
+  {
+    times_ms_.insert( times_ms_.end(), n, stamp.get_ms() );
+  }
+
+  // values are given sender by sender, but stored value by value
+  const size_t num_values = double_values_.size();
+  for ( size_t i = 0; i < num_values; ++i )
+  {
+    std::vector< double >& column = double_values_[ i ];
+    const size_t first = column.size();
+    column.resize( first + n );
+    for ( size_t k = 0; k < n; ++k )
+    {
+      column[ first + k ] = double_values[ k * num_values + i ];
+    }
+  }
+}
+
+void
+nest::RecordingBackendMemory::DeviceData::get_status( DictionaryDatum& d )
 {
   DictionaryDatum events;
 
@@ -229,35 +297,108 @@ nest::RecordingBackendMemory::DeviceData::get_status( DictionaryDatum& d ) const
     events = getValue< DictionaryDatum >( d, names::events );
   }
 
-  initialize_property_intvector( events, names::senders );
-  append_property( events, names::senders, senders_ );
+  if ( clear_on_read_ )
+  {
+    n_removed_ += senders_.size();
+  }
+
+  hand_over_< IntVectorDatum >( events, names::senders, senders_ );
 
   if ( time_in_steps_ )
   {
-    initialize_property_intvector( events, names::times );
-    append_property( events, names::times, times_steps_ );
-
-    initialize_property_doublevector( events, names::offsets );
-    append_property( events, names::offsets, times_offset_ );
+    hand_over_< IntVectorDatum >( events, names::times, times_steps_ );
+    hand_over_< DoubleVectorDatum >( events, names::offsets, times_offset_ );
   }
   else
   {
-    initialize_property_doublevector( events, names::times );
-    append_property( events, names::times, times_ms_ );
+    hand_over_< DoubleVectorDatum >( events, names::times, times_ms_ );
   }
 
   for ( size_t i = 0; i < double_values_.size(); ++i )
   {
-    initialize_property_doublevector( events, double_value_names_[ i ] );
-    append_property( events, double_value_names_[ i ], double_values_[ i ] );
+    hand_over_< DoubleVectorDatum >( events, double_value_names_[ i ], double_values_[ i ] );
   }
   for ( size_t i = 0; i < long_values_.size(); ++i )
   {
-    initialize_property_intvector( events, long_value_names_[ i ] );
-    append_property( events, long_value_names_[ i ], long_values_[ i ] );
+    hand_over_< IntVectorDatum >( events, long_value_names_[ i ], long_values_[ i ] );
   }
 
   ( *d )[ names::time_in_steps ] = time_in_steps_;
+  ( *d )[ names::clear_on_read ] = clear_on_read_;
+}
+
+size_t
+nest::RecordingBackendMemory::DeviceData::get_events( const size_t first, DictionaryDatum& events ) const
+{
+  // events removed from memory are skipped
+  const size_t start = std::min( senders_.size(), first > n_removed_ ? first - n_removed_ : 0 );
+
+  append_< IntVectorDatum >( events, names::senders, senders_, start );
+
+  if ( time_in_steps_ )
+  {
+    append_< IntVectorDatum >( events, names::times, times_steps_, start );
+    append_< DoubleVectorDatum >( events, names::offsets, times_offset_, start );
+  }
+  else
+  {
+    append_< DoubleVectorDatum >( events, names::times, times_ms_, start );
+  }
+
+  for ( size_t i = 0; i < double_values_.size(); ++i )
+  {
+    append_< DoubleVectorDatum >( events, double_value_names_[ i ], double_values_[ i ], start );
+  }
+  for ( size_t i = 0; i < long_values_.size(); ++i )
+  {
+    append_< IntVectorDatum >( events, long_value_names_[ i ], long_values_[ i ], start );
+  }
+
+  return n_removed_ + senders_.size();
+}
+
+template < typename DatumT, typename T >
+void
+nest::RecordingBackendMemory::DeviceData::hand_over_( DictionaryDatum& events,
+  const Name& name,
+  std::vector< T >& data )
+{
+  if ( clear_on_read_ and not events->known( name ) )
+  {
+    // The first thread provides the vector of the property. If events
+    // are cleared on read, the data is moved into it without copying.
+    std::vector< T >* values = new std::vector< T >();
+    values->swap( data );
+    ( *events )[ name ] = DatumT( values );
+    return;
+  }
+
+  append_< DatumT >( events, name, data, 0 );
+
+  if ( clear_on_read_ )
+  {
+    data.clear();
+  }
+}
+
+template < typename DatumT, typename T >
+void
+nest::RecordingBackendMemory::DeviceData::append_( DictionaryDatum& events,
+  const Name& name,
+  const std::vector< T >& data,
+  const size_t start ) const
+{
+  if ( not events->known( name ) )
+  {
+    ( *events )[ name ] = DatumT( new std::vector< T >( data.begin() + start, data.end() ) );
+    return;
+  }
+
+  // Data of further threads is appended
+  Token t = events->lookup( name );
+  DatumT* values = dynamic_cast< DatumT* >( t.datum() );
+  assert( values );
+  ( *values )->insert( ( *values )->end(), data.begin() + start, data.end() );
 }
 
 void
@@ -274,6 +415,8 @@ nest::RecordingBackendMemory::DeviceData::set_status( const DictionaryDatum& d )
     time_in_steps_ = time_in_steps;
   }
 
+  updateValue< bool >( d, names::clear_on_read, clear_on_read_ );
+
   size_t n_events = 1;
   if ( updateValue< long >( d, names::n_events, n_events ) and n_events == 0 )
   {
@@ -284,6 +427,8 @@ nest::RecordingBackendMemory::DeviceData::set_status( const DictionaryDatum& d )
 void
 nest::RecordingBackendMemory::DeviceData::clear()
 {
+  n_removed_ += senders_.size();
+
   senders_.clear();
   times_ms_.clear();
   times_steps_.clear();
@@ -65,9 +65,26 @@ be read out of the `n_events` entry in the status dictionary of the
 recording device. To delete data from memory, `n_events` can be set to
 0. Other values cannot be set.
 
+For long simulations, the recorded data can be drained incrementally
+by setting ``clear_on_read`` to *true*. The events are then handed
+over to the caller instead of being copied and removed from memory
+whenever the status of the device is read, so that each call to
+``get("events")`` returns only the events recorded since the previous
+call. Note that every read of the device status, e.g., of a different
+property, also hands over the events.
+
+To read new events without removing them from memory,
+:py:func:`.GetEventsSince` returns the events recorded after a cursor
+obtained from the previous call, without copying the events recorded
+before.
+
 Parameter summary
 ~~~~~~~~~~~~~~~~~
 
+clear_on_read
+    A Boolean (default: *false*) specifying whether recorded events are
+    removed from memory when the status of the device is read.
+
 events
     A dictionary containing the recorded data in the form of one numeric
     array for each quantity measured. It always has the sender global
@@ -132,6 +149,11 @@ public:
 
   void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
 
+  void write_samples( const RecordingDevice&,
+    const Time&,
+    const std::vector< size_t >&,
+    const std::vector< double >& ) override;
+
   void pre_run_hook() override;
 
   void post_run_hook() override;
@@ -146,17 +168,25 @@ public:
   void get_device_defaults( DictionaryDatum& ) const override;
   void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
 
+  size_t get_device_events( const RecordingDevice& device, const size_t first, DictionaryDatum& events ) const override;
+
 private:
   struct DeviceData
   {
     DeviceData();
     void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
     void push_back( const Event&, const std::vector< double >&, const std::vector< long >& );
-    void get_status( DictionaryDatum& ) const;
+    void push_back_samples( const Time&, const std::vector< size_t >&, const std::vector< double >& );
+    void get_status( DictionaryDatum& );
     void set_status( const DictionaryDatum& );
+    size_t get_events( const size_t first, DictionaryDatum& events ) const;
 
   private:
     void clear();
+    template < typename DatumT, typename T >
+    void hand_over_( DictionaryDatum& events, const Name& name, std::vector< T >& data );
+    template < typename DatumT, typename T >
+    void append_( DictionaryDatum& events, const Name& name, const std::vector< T >& data, const size_t start ) const;
     std::vector< long > senders_;                        //!< sender node IDs of the events
     std::vector< double > times_ms_;                     //!< times of registered events in ms
     std::vector< long > times_steps_;                    //!< times of registered events in steps
@@ -166,10 +196,14 @@ private:
     std::vector< std::vector< double > > double_values_; //!< recorded values of type double, one vector per value
     std::vector< std::vector< long > > long_values_;     //!< recorded values of type long, one vector per value
     bool time_in_steps_;                                 //!< Should time be recorded in steps (ms if false)
+    bool clear_on_read_;                                 //!< Should events be removed when they are read
+    size_t n_removed_;                                   //!< Number of events removed from memory so far
   };
 
   typedef std::vector< std::map< size_t, DeviceData > > device_data_map;
-  device_data_map device_data_;
+
+  //! Mutable, as reading the status of a device removes its events if clear_on_read is set
+  mutable device_data_map device_data_;
 };
 
 } // namespace
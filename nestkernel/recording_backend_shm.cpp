@@ -0,0 +1,527 @@
+/*
+ *  recording_backend_shm.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// C++ includes:
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+// C includes:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "recording_device.h"
+#include "vp_manager_impl.h"
+
+// includes from sli:
+#include "dictutils.h"
+
+#include "recording_backend_shm.h"
+
+nest::RecordingBackendSHM::RecordingBackendSHM()
+  : segment_name_( "/nest_stream" )
+  , ring_size_( 4 * 1024 * 1024 )
+  , block_( false )
+  , segment_()
+  , base_( nullptr )
+  , length_( 0 )
+  , header_( nullptr )
+{
+}
+
+nest::RecordingBackendSHM::~RecordingBackendSHM() throw()
+{
+  close_segment_();
+}
+
+void
+nest::RecordingBackendSHM::initialize()
+{
+  device_data_map tmp( kernel().vp_manager.get_num_threads() );
+  device_data_.swap( tmp );
+}
+
+void
+nest::RecordingBackendSHM::finalize()
+{
+  close_segment_();
+}
+
+void
+nest::RecordingBackendSHM::enroll( const RecordingDevice& device, const DictionaryDatum& )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  // the label is only known for certain in set_value_names(), as enroll()
+  // is called before the device has taken over new properties
+  device_data_[ t ][ node_id ];
+}
+
+void
+nest::RecordingBackendSHM::disenroll( const RecordingDevice& device )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  device_data_[ t ].erase( node_id );
+}
+
+void
+nest::RecordingBackendSHM::set_value_names( const RecordingDevice& device,
+  const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  device_data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  assert( device_data != device_data_[ t ].end() );
+  device_data->second.label_ = device.get_label().empty() ? device.get_name() : device.get_label();
+  device_data->second.double_value_names_ = double_value_names;
+  device_data->second.long_value_names_ = long_value_names;
+}
+
+void
+nest::RecordingBackendSHM::prepare()
+{
+  const bool have_devices = std::any_of( device_data_.begin(),
+    device_data_.end(),
+    []( const device_data_map::value_type& inner ) { return not inner.empty(); } );
+  if ( not have_devices )
+  {
+    return;
+  }
+
+  if ( segment_.empty() )
+  {
+    open_segment_();
+  }
+
+  // prepare() is called outside of parallel regions, so that no thread is
+  // writing to its ring here
+  for ( size_t t = 0; t < device_data_.size(); ++t )
+  {
+    for ( const auto& device_data : device_data_[ t ] )
+    {
+      write_device_( t, device_data.first );
+    }
+  }
+
+  __atomic_store_n( &header_->running, 1, __ATOMIC_RELEASE );
+}
+
+void
+nest::RecordingBackendSHM::cleanup()
+{
+  if ( header_ )
+  {
+    __atomic_store_n( &header_->running, 0, __ATOMIC_RELEASE );
+  }
+}
+
+void
+nest::RecordingBackendSHM::pre_run_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendSHM::post_run_hook()
+{
+  // nothing to do, records are visible to the reader as soon as they are written
+}
+
+void
+nest::RecordingBackendSHM::post_step_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendSHM::write( const RecordingDevice& device,
+  const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  const size_t t = device.get_thread();
+  if ( segment_.empty() or device_data_[ t ].find( device.get_node_id() ) == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  const uint64_t size = sizeof( nest_shm_stream_event ) + ( double_values.size() + long_values.size() ) * 8;
+  char* address = reserve_( t, size );
+  if ( not address )
+  {
+    return;
+  }
+
+  nest_shm_stream_event* record = reinterpret_cast< nest_shm_stream_event* >( address );
+  record->record.size = size;
+  record->record.type = NEST_SHM_STREAM_EVENT;
+  record->device = device.get_node_id();
+  record->sender = event.get_sender_node_id();
+  record->step = event.get_stamp().get_steps();
+  record->offset = event.get_offset();
+  record->n_double = double_values.size();
+  record->n_long = long_values.size();
+
+  double* doubles = reinterpret_cast< double* >( record + 1 );
+  std::copy( double_values.begin(), double_values.end(), doubles );
+  int64_t* longs = reinterpret_cast< int64_t* >( doubles + double_values.size() );
+  std::copy( long_values.begin(), long_values.end(), longs );
+
+  commit_( t, size );
+}
+
+void
+nest::RecordingBackendSHM::write_samples( const RecordingDevice& device,
+  const Time& stamp,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& double_values )
+{
+  const size_t t = device.get_thread();
+  if ( segment_.empty() or senders.empty()
+    or device_data_[ t ].find( device.get_node_id() ) == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  // split large rows into records of at most a quarter of the ring, so
+  // that the reader does not have to empty the ring completely before a
+  // record fits
+  const size_t num_values = double_values.size() / senders.size();
+  const uint64_t bytes_per_sender = ( 1 + num_values ) * 8;
+  const size_t max_senders =
+    std::max( uint64_t( 1 ), ( ring_size_ / 4 - sizeof( nest_shm_stream_samples ) ) / bytes_per_sender );
+
+  for ( size_t first = 0; first < senders.size(); first += max_senders )
+  {
+    const size_t n_senders = std::min( max_senders, senders.size() - first );
+    const uint64_t size = sizeof( nest_shm_stream_samples ) + n_senders * bytes_per_sender;
+    char* address = reserve_( t, size );
+    if ( not address )
+    {
+      continue;
+    }
+
+    nest_shm_stream_samples* record = reinterpret_cast< nest_shm_stream_samples* >( address );
+    record->record.size = size;
+    record->record.type = NEST_SHM_STREAM_SAMPLES;
+    record->device = device.get_node_id();
+    record->step = stamp.get_steps();
+    record->n_senders = n_senders;
+    record->n_values = num_values;
+
+    int64_t* node_ids = reinterpret_cast< int64_t* >( record + 1 );
+    std::copy( senders.begin() + first, senders.begin() + first + n_senders, node_ids );
+    double* values = reinterpret_cast< double* >( node_ids + n_senders );
+    std::copy( double_values.begin() + first * num_values,
+      double_values.begin() + ( first + n_senders ) * num_values,
+      values );
+
+    commit_( t, size );
+  }
+}
+
+void
+nest::RecordingBackendSHM::write_device_( const size_t t, const size_t node_id )
+{
+  const DeviceData& device_data = device_data_[ t ][ node_id ];
+
+  std::vector< std::string > names( 1, device_data.label_ );
+  for ( const auto& name : device_data.double_value_names_ )
+  {
+    names.push_back( name.toString() );
+  }
+  for ( const auto& name : device_data.long_value_names_ )
+  {
+    names.push_back( name.toString() );
+  }
+
+  uint64_t size = sizeof( nest_shm_stream_device );
+  for ( const auto& name : names )
+  {
+    size += name.size() + 1;
+  }
+  size = NEST_SHM_STREAM_ALIGN( size );
+
+  char* address = reserve_( t, size );
+  if ( not address )
+  {
+    return;
+  }
+
+  std::memset( address, 0, size );
+  nest_shm_stream_device* record = reinterpret_cast< nest_shm_stream_device* >( address );
+  record->record.size = size;
+  record->record.type = NEST_SHM_STREAM_DEVICE;
+  record->device = node_id;
+  record->n_double = device_data.double_value_names_.size();
+  record->n_long = device_data.long_value_names_.size();
+
+  char* text = reinterpret_cast< char* >( record + 1 );
+  for ( const auto& name : names )
+  {
+    std::memcpy( text, name.c_str(), name.size() + 1 );
+    text += name.size() + 1;
+  }
+
+  commit_( t, size );
+}
+
+char*
+nest::RecordingBackendSHM::reserve_( const size_t t, const uint64_t size )
+{
+  Producer& producer = producers_[ t ];
+  nest_shm_stream_ring* ring = rings_[ t ];
+
+  // records of up to half the size of the ring always fit into an empty
+  // ring, larger ones may never fit
+  if ( 2 * size > ring_size_ )
+  {
+    if ( block_ )
+    {
+      std::string msg = String::compose(
+        "A record of %1 bytes does not fit into a ring buffer of %2 bytes. Increase the ring_size of the shm backend.",
+        size,
+        ring_size_ );
+      LOG( M_ERROR, "RecordingBackendSHM::write()", msg );
+      throw IOError();
+    }
+
+    ++producer.dropped_;
+    __atomic_store_n( &ring->dropped, producer.dropped_, __ATOMIC_RELAXED );
+    return nullptr;
+  }
+
+  // a record that is written at the start of the ring needs space for
+  // padding the remainder of the ring, too
+  const uint64_t offset = producer.write_pos_ & ( ring_size_ - 1 );
+  const uint64_t contiguous = ring_size_ - offset;
+  const uint64_t required = contiguous < size ? contiguous + size : size;
+
+  while ( producer.write_pos_ + required - producer.read_pos_ > ring_size_ )
+  {
+    producer.read_pos_ = __atomic_load_n( &ring->read_pos, __ATOMIC_ACQUIRE );
+    if ( producer.write_pos_ + required - producer.read_pos_ <= ring_size_ )
+    {
+      break;
+    }
+
+    if ( not block_ )
+    {
+      ++producer.dropped_;
+      __atomic_store_n( &ring->dropped, producer.dropped_, __ATOMIC_RELAXED );
+      return nullptr;
+    }
+    std::this_thread::yield();
+  }
+
+  if ( contiguous < size )
+  {
+    nest_shm_stream_record* padding = reinterpret_cast< nest_shm_stream_record* >( data_[ t ] + offset );
+    padding->size = contiguous;
+    padding->type = NEST_SHM_STREAM_PADDING;
+    producer.write_pos_ += contiguous;
+  }
+
+  return data_[ t ] + ( producer.write_pos_ & ( ring_size_ - 1 ) );
+}
+
+void
+nest::RecordingBackendSHM::commit_( const size_t t, const uint64_t size )
+{
+  Producer& producer = producers_[ t ];
+  producer.write_pos_ += size;
+  __atomic_store_n( &rings_[ t ]->write_pos, producer.write_pos_, __ATOMIC_RELEASE );
+}
+
+void
+nest::RecordingBackendSHM::open_segment_()
+{
+  const size_t num_rings = device_data_.size();
+  const uint64_t data_start = ( NEST_SHM_STREAM_RING_OFFSET( num_rings ) + 63 ) & ~uint64_t( 63 );
+  const std::string segment = String::compose( "%1-%2", segment_name_, kernel().mpi_manager.get_rank() );
+
+  // remove a segment left behind by an earlier simulation that was not
+  // shut down properly, so that readers do not attach to stale data
+  shm_unlink( segment.c_str() );
+
+  const int fd = shm_open( segment.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+  if ( fd < 0 )
+  {
+    std::string msg = String::compose( "Could not create shared memory segment '%1': %2", segment, strerror( errno ) );
+    LOG( M_ERROR, "RecordingBackendSHM::prepare()", msg );
+    throw IOError();
+  }
+
+  const uint64_t length = data_start + num_rings * ring_size_;
+  void* base = MAP_FAILED;
+  if ( ftruncate( fd, length ) == 0 )
+  {
+    base = mmap( nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  }
+  const int error = errno;
+  close( fd );
+
+  if ( base == MAP_FAILED )
+  {
+    shm_unlink( segment.c_str() );
+    std::string msg = String::compose( "Could not map shared memory segment '%1': %2", segment, strerror( error ) );
+    LOG( M_ERROR, "RecordingBackendSHM::prepare()", msg );
+    throw IOError();
+  }
+
+  segment_ = segment;
+  base_ = static_cast< char* >( base );
+  length_ = length;
+
+  // the segment is zero-initialized by ftruncate(), so that all rings
+  // are empty
+  header_ = reinterpret_cast< nest_shm_stream_header* >( base_ );
+  header_->version = NEST_SHM_STREAM_VERSION;
+  header_->num_rings = num_rings;
+  header_->ring_size = ring_size_;
+  header_->data_start = data_start;
+  header_->resolution = Time::get_resolution().get_ms();
+  header_->rank = kernel().mpi_manager.get_rank();
+  header_->overflow = block_ ? NEST_SHM_STREAM_BLOCK : NEST_SHM_STREAM_DROP;
+
+  rings_.clear();
+  data_.clear();
+  for ( size_t t = 0; t < num_rings; ++t )
+  {
+    rings_.push_back( reinterpret_cast< nest_shm_stream_ring* >( base_ + NEST_SHM_STREAM_RING_OFFSET( t ) ) );
+    data_.push_back( base_ + data_start + t * ring_size_ );
+  }
+  producers_.assign( num_rings, Producer() );
+
+  // readers check the magic string to see that the header is complete
+  __atomic_thread_fence( __ATOMIC_RELEASE );
+  std::memcpy( header_->magic, NEST_SHM_STREAM_MAGIC, sizeof( header_->magic ) );
+}
+
+void
+nest::RecordingBackendSHM::close_segment_()
+{
+  if ( segment_.empty() )
+  {
+    return;
+  }
+
+  // readers that have mapped the segment can still read the remaining
+  // records after it has been removed
+  munmap( base_, length_ );
+  shm_unlink( segment_.c_str() );
+
+  segment_.clear();
+  base_ = nullptr;
+  length_ = 0;
+  header_ = nullptr;
+  rings_.clear();
+  data_.clear();
+  producers_.clear();
+}
+
+void
+nest::RecordingBackendSHM::set_status( const DictionaryDatum& d )
+{
+  std::string segment_name = segment_name_;
+  long ring_size = ring_size_;
+  std::string overflow = block_ ? "block" : "drop";
+
+  updateValue< std::string >( d, names::segment_name, segment_name );
+  updateValue< long >( d, names::ring_size, ring_size );
+  updateValue< std::string >( d, names::overflow, overflow );
+
+  if ( segment_name.size() < 2 or segment_name[ 0 ] != '/' or segment_name.find( '/', 1 ) != std::string::npos )
+  {
+    throw BadProperty( "segment_name must start with a slash and must not contain further slashes." );
+  }
+  if ( ring_size < 4096 or ring_size > ( 1L << 30 ) or ( ring_size & ( ring_size - 1 ) ) != 0 )
+  {
+    throw BadProperty( "ring_size must be a power of two between 4096 and 2^30." );
+  }
+  if ( overflow != "drop" and overflow != "block" )
+  {
+    throw BadProperty( "overflow must be either \"drop\" or \"block\"." );
+  }
+
+  const bool changed = segment_name != segment_name_ or static_cast< uint64_t >( ring_size ) != ring_size_
+    or ( overflow == "block" ) != block_;
+  if ( changed and header_ and __atomic_load_n( &header_->running, __ATOMIC_ACQUIRE ) )
+  {
+    throw BadProperty( "Properties of the shm backend cannot be changed while a simulation is prepared." );
+  }
+
+  segment_name_ = segment_name;
+  ring_size_ = ring_size;
+  block_ = overflow == "block";
+
+  // the new properties take effect when the segment is created again in
+  // the next call to prepare()
+  if ( changed )
+  {
+    close_segment_();
+  }
+}
+
+void
+nest::RecordingBackendSHM::get_status( DictionaryDatum& d ) const
+{
+  long dropped = 0;
+  for ( const auto& producer : producers_ )
+  {
+    dropped += producer.dropped_;
+  }
+
+  ( *d )[ names::segment_name ] = segment_name_;
+  ( *d )[ names::ring_size ] = static_cast< long >( ring_size_ );
+  ( *d )[ names::overflow ] = std::string( block_ ? "block" : "drop" );
+  ( *d )[ names::dropped ] = dropped;
+}
+
+void
+nest::RecordingBackendSHM::check_device_status( const DictionaryDatum& ) const
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendSHM::get_device_defaults( DictionaryDatum& ) const
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendSHM::get_device_status( const nest::RecordingDevice&, DictionaryDatum& ) const
+{
+  // nothing to do
+}
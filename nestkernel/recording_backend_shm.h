@@ -0,0 +1,235 @@
+/*
+ *  recording_backend_shm.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_BACKEND_SHM_H
+#define RECORDING_BACKEND_SHM_H
+
+// C++ includes:
+#include <cstdint>
+#include <map>
+
+// Includes from nestkernel:
+#include "recording_backend.h"
+#include "shm_stream.h"
+
+/* BeginUserDocs: NOINDEX
+
+Recording backend `shm` - Stream data to other processes via shared memory
+--------------------------------------------------------------------------
+
+Description
+~~~~~~~~~~~
+
+The `shm` recording backend streams the data of all recording devices
+into a POSIX shared memory segment, from which analysis or
+visualization processes on the same machine can read the data while
+the simulation is running. The data does not pass through the file
+system and is not copied between the simulation and the reading
+process.
+
+Each MPI process creates its own segment, which is named after the
+backend property ``segment_name`` followed by a dash and the rank of
+the process, e.g., ``/nest_stream-0``. The segment is created at the
+beginning of the first simulation in which a recording device uses the
+backend and removed by :py:func:`.ResetKernel`, or when the properties
+of the backend are changed.
+
+The segment contains one ring buffer of ``ring_size`` bytes per
+thread, into which the devices on the thread write their data as
+records. Every ring buffer is meant to be emptied by a single reader.
+Before each simulation, a record with the name and the names of the
+recorded values is written for each device. Each spike or other event
+is written as one record with the node IDs of the device and the
+sender, the time and the values of the event. The samples of a
+:doc:`multimeter </models/multimeter>` that pushes its samples are
+written as one record per time step.
+
+The layout of the segment and of all records is defined in the C
+header ``shm_stream.h``, which is installed with NEST and also contains
+a minimal reader. From Python, segments can be read with
+:py:class:`.ShmStreamReader`:
+
+::
+
+   >>> sr = nest.Create("spike_recorder", params={"record_to": "shm"})
+   ...
+   >>> reader = nest.ShmStreamReader()
+   >>> while True:
+   ...     events = reader.read()
+
+If a reader does not keep up with the simulation and a ring buffer is
+full, the behavior is given by the backend property ``overflow``. With
+``"drop"``, new records are discarded and counted in the property
+``dropped``, so that the simulation never waits for the reader.
+With ``"block"``, the thread waits until the reader has freed enough
+space, so that no data is lost, but the simulation does not continue
+if no reader is attached. Records larger than half of a ring buffer
+never fit. They are dropped with ``"drop"`` and stop the simulation
+with an error with ``"block"``. Samples of many nodes are split into
+records of at most a quarter of a ring buffer.
+
+Parameter summary
+~~~~~~~~~~~~~~~~~
+
+The following properties are shared by all devices and set with
+:py:func:`.SetDefaults` on ``"shm"``:
+
+dropped
+    An integer with the number of records discarded on this MPI process
+    because a ring buffer was full. This is a read-only property.
+
+overflow
+    A string (default: *"drop"*) that specifies what happens if a ring
+    buffer is full. Possible values are *"drop"* and *"block"*.
+
+ring_size
+    An integer (default: *4194304*) that specifies the size of the
+    ring buffer of each thread in bytes. It must be a power of two of
+    at least 4096.
+
+segment_name
+    A string (default: *"/nest_stream"*) that specifies the name of the
+    shared memory segment without the rank. It must start with a slash
+    and must not contain any further slashes.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * Shared memory specialization of the RecordingBackend interface.
+ *
+ * RecordingBackendSHM writes the data of all devices on a thread into
+ * the ring buffer of the thread in a shared memory segment, as described
+ * in shm_stream.h. As the ring buffer of a thread is only written by
+ * this thread, no synchronization between threads is necessary. The
+ * thread and the reader synchronize through the read and write
+ * positions of the ring only. The segment is created in prepare() and
+ * removed in finalize().
+ */
+class RecordingBackendSHM : public RecordingBackend
+{
+public:
+  RecordingBackendSHM();
+
+  ~RecordingBackendSHM() throw() override;
+
+  void initialize() override;
+
+  void finalize() override;
+
+  void enroll( const RecordingDevice& device, const DictionaryDatum& params ) override;
+
+  void disenroll( const RecordingDevice& device ) override;
+
+  void set_value_names( const RecordingDevice& device,
+    const std::vector< Name >& double_value_names,
+    const std::vector< Name >& long_value_names ) override;
+
+  /**
+   * Create the segment if necessary and describe all devices in it
+   */
+  void prepare() override;
+
+  void cleanup() override;
+
+  void pre_run_hook() override;
+
+  void post_run_hook() override;
+
+  void post_step_hook() override;
+
+  void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+
+  void write_samples( const RecordingDevice&,
+    const Time&,
+    const std::vector< size_t >&,
+    const std::vector< double >& ) override;
+
+  void set_status( const DictionaryDatum& ) override;
+  void get_status( DictionaryDatum& ) const override;
+
+  void check_device_status( const DictionaryDatum& ) const override;
+  void get_device_defaults( DictionaryDatum& ) const override;
+  void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
+
+private:
+  //! Create the segment and map it into memory
+  void open_segment_();
+
+  //! Unmap and remove the segment
+  void close_segment_();
+
+  //! Write the description of a device to the ring of thread t
+  void write_device_( const size_t t, const size_t node_id );
+
+  /**
+   * Return the address at which a record of the given size can be
+   * written to the ring of thread t, or nullptr if the record is
+   * dropped. The record is passed to the reader by commit_().
+   */
+  char* reserve_( const size_t t, const uint64_t size );
+
+  //! Make the record reserved last visible to the reader
+  void commit_( const size_t t, const uint64_t size );
+
+  struct DeviceData
+  {
+    std::string label_;                      //!< The label or model name of the device
+    std::vector< Name > double_value_names_; //!< names for values of type double
+    std::vector< Name > long_value_names_;   //!< names for values of type long
+  };
+
+  /**
+   * Positions of the producer of a ring.
+   *
+   * The thread keeps copies of its write position and of the last read
+   * position it has seen, so that it only accesses the cache line of
+   * the read position if the ring appears to be full.
+   */
+  struct alignas( 64 ) Producer
+  {
+    uint64_t write_pos_; //!< Position at which the next record is written
+    uint64_t read_pos_;  //!< Read position at the last check for space
+    uint64_t dropped_;   //!< Number of records dropped by this thread
+  };
+
+  typedef std::vector< std::map< size_t, DeviceData > > device_data_map;
+  device_data_map device_data_;
+
+  std::string segment_name_; //!< Name of the segment without rank
+  uint64_t ring_size_;       //!< Size of each ring in bytes
+  bool block_;               //!< Wait for the reader if a ring is full
+
+  std::string segment_;                        //!< Name of the open segment, empty if none is open
+  char* base_;                                 //!< Address of the mapped segment
+  uint64_t length_;                            //!< Length of the mapped segment in bytes
+  nest_shm_stream_header* header_;             //!< Header at the start of the segment
+  std::vector< nest_shm_stream_ring* > rings_; //!< Control blocks of the rings
+  std::vector< char* > data_;                  //!< Data of the rings
+  std::vector< Producer > producers_;          //!< Positions of all threads
+};
+
+} // namespace
+
+#endif /* #ifndef RECORDING_BACKEND_SHM_H */
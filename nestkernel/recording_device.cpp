@@ -56,6 +56,12 @@ nest::RecordingDevice::pre_run_hook( const std::vector< Name >& double_value_nam
   kernel().io_manager.set_recording_value_names( P_.record_to_, *this, double_value_names, long_value_names );
 }
 
+size_t
+nest::RecordingDevice::get_events( const size_t first, DictionaryDatum& events ) const
+{
+  return kernel().io_manager.get_recorded_events( P_.record_to_, *this, first, events );
+}
+
 const std::string&
 nest::RecordingDevice::get_label() const
 {
@@ -216,3 +222,12 @@ nest::RecordingDevice::write( const Event& event,
   kernel().io_manager.write( P_.record_to_, *this, event, double_values, long_values );
   S_.n_events_++;
 }
+
+void
+nest::RecordingDevice::write_samples( const Time& stamp,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& double_values )
+{
+  kernel().io_manager.write_samples( P_.record_to_, *this, stamp, senders, double_values );
+  S_.n_events_ += senders.size();
+}
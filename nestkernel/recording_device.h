@@ -165,7 +165,8 @@ public:
     MULTIMETER,
     SPIKE_RECORDER,
     SPIN_DETECTOR,
-    WEIGHT_RECORDER
+    WEIGHT_RECORDER,
+    SPIKE_STATISTICS_RECORDER
   };
 
   virtual Type get_type() const = 0;
@@ -175,8 +176,17 @@ public:
   void set_status( const DictionaryDatum& ) override;
   void get_status( DictionaryDatum& ) const override;
 
+  /**
+   * Append the events stored by the backend from the given position on
+   * to the events dictionary and return the position after the last event.
+   *
+   * @see RecordingBackend::get_device_events()
+   */
+  size_t get_events( const size_t first, DictionaryDatum& events ) const;
+
 protected:
   void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+  void write_samples( const Time&, const std::vector< size_t >&, const std::vector< double >& );
   void set_initialized_() override;
 
 private:
@@ -0,0 +1,179 @@
+/*
+ *  sample_block.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SAMPLE_BLOCK_H
+#define SAMPLE_BLOCK_H
+
+// C++ includes:
+#include <cassert>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Buffer into which data loggers write samples for a multimeter.
+ *
+ * A multimeter that has its samples pushed owns one SampleBlock per
+ * thread. The data logger of each target on the same thread obtains a
+ * slot in the block when the multimeter is connected to it and writes
+ * the values of every sample directly into that slot of the row for the
+ * sampling step. Each row holds the values of all targets for one
+ * sampling step contiguously, so that the multimeter can hand a row to
+ * the recording backend in a single call.
+ *
+ * The values are read through the RecordablesMap accessors of the data
+ * logger while the target is updated, since the state of a target at
+ * the sampling steps within a time slice is not available to the
+ * multimeter. The block thus replaces the DataLoggingRequest and
+ * DataLoggingReply events and the reply buffers of the loggers, but not
+ * the loggers themselves.
+ *
+ * Rows are indexed by the read/write toggle of the
+ * EventDeliveryManager and by the position of the sampling step in the
+ * time slice, as for the buffers used with DataLoggingReply. Every slot
+ * of a row carries the time step of its data, which allows to detect
+ * slots that were not written in the last slice, e.g., because the
+ * target is frozen.
+ *
+ * @see multimeter, UniversalDataLogger
+ * @ingroup Devices
+ */
+class SampleBlock
+{
+public:
+  SampleBlock();
+
+  /**
+   * Register a target and return the slot to which it writes.
+   */
+  size_t add_target( size_t node_id );
+
+  /**
+   * Allocate rows for the given number of values per target and sampling
+   * steps per time slice.
+   *
+   * Has no effect if the rows have the required size already, so that
+   * samples written at the end of one call to Run are read in the next.
+   */
+  void init( size_t num_vars, size_t rows_per_slice );
+
+  /**
+   * Return pointer to the values of the given slot in a row and mark them
+   * as data for the time step @p stamp.
+   */
+  double* get_values_for_writing( size_t toggle, size_t row, size_t slot, long stamp );
+
+  size_t get_num_targets() const;
+  size_t get_num_rows() const;
+
+  //! Node IDs of all targets, in the order of their slots
+  const std::vector< size_t >& get_senders() const;
+
+  //! Time steps of the data of all slots in the given row
+  const std::vector< long >& get_stamps( size_t toggle, size_t row ) const;
+
+  //! Values of all slots in the given row, one after the other
+  const std::vector< double >& get_values( size_t toggle, size_t row ) const;
+
+private:
+  size_t num_vars_;                                            //!< Number of values per target and step
+  std::vector< size_t > senders_;                              //!< Node IDs of targets, indexed by slot
+  std::vector< std::vector< std::vector< long > > > stamps_;   //!< Time stamps per toggle, row and slot
+  std::vector< std::vector< std::vector< double > > > values_; //!< Values per toggle and row
+};
+
+inline SampleBlock::SampleBlock()
+  : num_vars_( 0 )
+  , senders_()
+  , stamps_( 2 )
+  , values_( 2 )
+{
+}
+
+inline size_t
+SampleBlock::add_target( size_t node_id )
+{
+  senders_.push_back( node_id );
+  return senders_.size() - 1;
+}
+
+inline void
+SampleBlock::init( size_t num_vars, size_t rows_per_slice )
+{
+  if ( num_vars == num_vars_ and rows_per_slice == stamps_[ 0 ].size()
+    and ( rows_per_slice == 0 or stamps_[ 0 ][ 0 ].size() == senders_.size() ) )
+  {
+    return;
+  }
+
+  num_vars_ = num_vars;
+  for ( size_t t = 0; t < 2; ++t )
+  {
+    stamps_[ t ].assign( rows_per_slice, std::vector< long >( senders_.size(), -1 ) );
+    values_[ t ].assign( rows_per_slice, std::vector< double >( senders_.size() * num_vars_, 0.0 ) );
+  }
+}
+
+inline double*
+SampleBlock::get_values_for_writing( size_t toggle, size_t row, size_t slot, long stamp )
+{
+  assert( row < stamps_[ toggle ].size() );
+  assert( slot < senders_.size() );
+
+  stamps_[ toggle ][ row ][ slot ] = stamp;
+  return values_[ toggle ][ row ].data() + slot * num_vars_;
+}
+
+inline size_t
+SampleBlock::get_num_targets() const
+{
+  return senders_.size();
+}
+
+inline size_t
+SampleBlock::get_num_rows() const
+{
+  return stamps_[ 0 ].size();
+}
+
+inline const std::vector< size_t >&
+SampleBlock::get_senders() const
+{
+  return senders_;
+}
+
+inline const std::vector< long >&
+SampleBlock::get_stamps( size_t toggle, size_t row ) const
+{
+  return stamps_[ toggle ][ row ];
+}
+
+inline const std::vector< double >&
+SampleBlock::get_values( size_t toggle, size_t row ) const
+{
+  return values_[ toggle ][ row ];
+}
+
+} // namespace nest
+
+#endif /* #ifndef SAMPLE_BLOCK_H */
@@ -0,0 +1,275 @@
+/*
+ *  shm_stream.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHM_STREAM_H
+#define SHM_STREAM_H
+
+/*
+ * Layout of the shared memory segments written by the `shm` recording
+ * backend and a minimal reader for them.
+ *
+ * This header is written in plain C, so that analysis and visualization
+ * tools can include it without depending on NEST. It is used by
+ * RecordingBackendSHM for writing as well.
+ *
+ * A segment consists of a header, followed by the control blocks of all
+ * rings and the data of all rings. There is one ring per thread of the
+ * MPI process that created the segment. Each ring is a single-producer,
+ * single-consumer queue of records: the thread writes records and
+ * advances write_pos, a single reader consumes them and advances
+ * read_pos. Both positions count bytes since the creation of the
+ * segment and are reduced modulo ring_size to obtain the offset of a
+ * record in the data of the ring. Positions are accessed with atomic
+ * acquire and release operations only.
+ *
+ * Records are aligned to 8 bytes. If a record does not fit between the
+ * write position and the end of the ring, the remainder of the ring is
+ * filled with a padding record and the record is written at the start.
+ *
+ * Usage of the reader:
+ *
+ *   struct nest_shm_stream stream;
+ *   if ( nest_shm_stream_open( "/nest_stream-0", &stream ) == 0 )
+ *   {
+ *     const struct nest_shm_stream_record* record;
+ *     while ( ( record = nest_shm_stream_peek( &stream, ring ) ) )
+ *     {
+ *       ... process record ...
+ *       nest_shm_stream_consume( &stream, ring );
+ *     }
+ *     nest_shm_stream_close( &stream );
+ *   }
+ */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define NEST_SHM_STREAM_MAGIC "NESTSHM"
+#define NEST_SHM_STREAM_VERSION 1
+
+/* Types of records */
+#define NEST_SHM_STREAM_PADDING 0
+#define NEST_SHM_STREAM_DEVICE 1
+#define NEST_SHM_STREAM_EVENT 2
+#define NEST_SHM_STREAM_SAMPLES 3
+
+/* Values of the overflow field of the header */
+#define NEST_SHM_STREAM_DROP 0
+#define NEST_SHM_STREAM_BLOCK 1
+
+struct nest_shm_stream_header
+{
+  char magic[ 8 ];     /* NEST_SHM_STREAM_MAGIC, written last on creation */
+  uint32_t version;    /* NEST_SHM_STREAM_VERSION */
+  uint32_t num_rings;  /* number of rings, one per thread */
+  uint64_t ring_size;  /* bytes of data per ring, a power of two */
+  uint64_t data_start; /* offset of the data of the first ring from the start of the segment */
+  double resolution;   /* simulation resolution in ms */
+  uint32_t rank;       /* MPI rank that created the segment */
+  uint32_t overflow;   /* NEST_SHM_STREAM_DROP or NEST_SHM_STREAM_BLOCK */
+  uint64_t running;    /* 1 while a simulation is prepared, 0 otherwise */
+  char reserved[ 8 ];
+};
+
+/* Positions are kept on separate cache lines to avoid false sharing */
+struct nest_shm_stream_ring
+{
+  uint64_t write_pos; /* written by the producer only */
+  char pad0[ 56 ];
+  uint64_t read_pos; /* written by the consumer only */
+  char pad1[ 56 ];
+  uint64_t dropped; /* number of records dropped because the ring was full */
+  char pad2[ 56 ];
+};
+
+/*
+ * Common header of all records. size is the total size of the record
+ * in bytes, including this header and padding to a multiple of 8.
+ */
+struct nest_shm_stream_record
+{
+  uint32_t size;
+  uint32_t type;
+};
+
+/*
+ * Description of a recording device, written for every device enrolled
+ * in the backend before each simulation. The record is followed by the
+ * null-terminated model name or label of the device and the names of
+ * its n_double double and n_long integer values.
+ */
+struct nest_shm_stream_device
+{
+  struct nest_shm_stream_record record;
+  int64_t device; /* node ID of the device */
+  uint32_t n_double;
+  uint32_t n_long;
+};
+
+/*
+ * A single event, e.g., a spike. The record is followed by n_double
+ * double values and n_long 64 bit integer values. The time of the event
+ * in ms is step * resolution - offset.
+ */
+struct nest_shm_stream_event
+{
+  struct nest_shm_stream_record record;
+  int64_t device;
+  int64_t sender;
+  int64_t step;
+  double offset;
+  uint32_t n_double;
+  uint32_t n_long;
+};
+
+/*
+ * Samples of n_senders nodes taken at the same time step. The record is
+ * followed by the n_senders 64 bit node IDs and n_senders * n_values
+ * doubles, holding all values of the first node, then all values of the
+ * second node and so on.
+ */
+struct nest_shm_stream_samples
+{
+  struct nest_shm_stream_record record;
+  int64_t device;
+  int64_t step;
+  uint32_t n_senders;
+  uint32_t n_values;
+};
+
+#define NEST_SHM_STREAM_ALIGN( size ) ( ( ( size ) + 7 ) & ~( ( uint64_t ) 7 ) )
+
+/* Offset of the control block of a ring from the start of the segment */
+#define NEST_SHM_STREAM_RING_OFFSET( ring ) \
+  ( sizeof( struct nest_shm_stream_header ) + ( ring ) * sizeof( struct nest_shm_stream_ring ) )
+
+/* Reader */
+
+struct nest_shm_stream
+{
+  char* base;
+  uint64_t length;
+  struct nest_shm_stream_header* header;
+};
+
+/*
+ * Map the segment with the given name. Returns 0 on success and -1 if
+ * the segment does not exist or was not written by NEST.
+ */
+static inline int
+nest_shm_stream_open( const char* name, struct nest_shm_stream* stream )
+{
+  struct stat st;
+  void* base;
+  int fd = shm_open( name, O_RDWR, 0 );
+  if ( fd < 0 )
+  {
+    return -1;
+  }
+  if ( fstat( fd, &st ) != 0 || ( uint64_t ) st.st_size < sizeof( struct nest_shm_stream_header ) )
+  {
+    close( fd );
+    return -1;
+  }
+  base = mmap( NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  close( fd );
+  if ( base == MAP_FAILED )
+  {
+    return -1;
+  }
+
+  stream->base = ( char* ) base;
+  stream->length = st.st_size;
+  stream->header = ( struct nest_shm_stream_header* ) base;
+  __atomic_thread_fence( __ATOMIC_ACQUIRE );
+  if ( memcmp( stream->header->magic, NEST_SHM_STREAM_MAGIC, 8 ) != 0
+    || stream->header->version != NEST_SHM_STREAM_VERSION )
+  {
+    munmap( base, st.st_size );
+    return -1;
+  }
+  return 0;
+}
+
+static inline void
+nest_shm_stream_close( struct nest_shm_stream* stream )
+{
+  munmap( stream->base, stream->length );
+  stream->base = NULL;
+  stream->header = NULL;
+}
+
+static inline struct nest_shm_stream_ring*
+nest_shm_stream_get_ring( struct nest_shm_stream* stream, uint32_t ring )
+{
+  return ( struct nest_shm_stream_ring* ) ( stream->base + NEST_SHM_STREAM_RING_OFFSET( ring ) );
+}
+
+/*
+ * Return the next record of the given ring or NULL if the ring is
+ * empty. The record stays valid until it is consumed.
+ */
+static inline const struct nest_shm_stream_record*
+nest_shm_stream_peek( struct nest_shm_stream* stream, uint32_t ring )
+{
+  struct nest_shm_stream_ring* control = nest_shm_stream_get_ring( stream, ring );
+  const uint64_t ring_size = stream->header->ring_size;
+  const char* data = stream->base + stream->header->data_start + ring * ring_size;
+  uint64_t read_pos = __atomic_load_n( &control->read_pos, __ATOMIC_RELAXED );
+  const uint64_t write_pos = __atomic_load_n( &control->write_pos, __ATOMIC_ACQUIRE );
+
+  while ( read_pos != write_pos )
+  {
+    const struct nest_shm_stream_record* record =
+      ( const struct nest_shm_stream_record* ) ( data + ( read_pos & ( ring_size - 1 ) ) );
+    if ( record->type != NEST_SHM_STREAM_PADDING )
+    {
+      return record;
+    }
+    read_pos += record->size;
+    __atomic_store_n( &control->read_pos, read_pos, __ATOMIC_RELEASE );
+  }
+  return NULL;
+}
+
+/*
+ * Release the record last returned by nest_shm_stream_peek() for the
+ * given ring, so that its space can be reused by the producer.
+ */
+static inline void
+nest_shm_stream_consume( struct nest_shm_stream* stream, uint32_t ring )
+{
+  struct nest_shm_stream_ring* control = nest_shm_stream_get_ring( stream, ring );
+  const uint64_t ring_size = stream->header->ring_size;
+  const char* data = stream->base + stream->header->data_start + ring * ring_size;
+  const uint64_t read_pos = __atomic_load_n( &control->read_pos, __ATOMIC_RELAXED );
+  const struct nest_shm_stream_record* record =
+    ( const struct nest_shm_stream_record* ) ( data + ( read_pos & ( ring_size - 1 ) ) );
+
+  __atomic_store_n( &control->read_pos, read_pos + record->size, __ATOMIC_RELEASE );
+}
+
+#endif /* #ifndef SHM_STREAM_H */
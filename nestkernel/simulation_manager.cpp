@@ -26,6 +26,7 @@
 #include <sys/time.h>
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -59,9 +60,15 @@ nest::SimulationManager::SimulationManager()
   , wfr_tol_( 0.0001 )
   , wfr_max_iterations_( 15 )
   , wfr_interpolation_order_( 3 )
+  , wfr_skip_unchanged_( false )
   , update_time_limit_( std::numeric_limits< double >::infinity() )
   , min_update_time_( std::numeric_limits< double >::infinity() )
   , max_update_time_( -std::numeric_limits< double >::infinity() )
+  , wfr_iterations_( 0 )
+  , wfr_intervals_( 0 )
+  , wfr_updates_( 0 )
+  , wfr_skipped_updates_( 0 )
+  , wfr_arrived_( 0 )
   , eprop_update_interval_( 1000. )
   , eprop_learning_window_( 1000. )
   , eprop_reset_neurons_on_update_( true )
@@ -100,6 +107,7 @@ nest::SimulationManager::initialize( const bool adjust_number_of_threads_or_rng_
   wfr_tol_ = 0.0001;
   wfr_max_iterations_ = 15;
   wfr_interpolation_order_ = 3;
+  wfr_skip_unchanged_ = false;
   update_time_limit_ = std::numeric_limits< double >::infinity();
   min_update_time_ = std::numeric_limits< double >::infinity();
   max_update_time_ = -std::numeric_limits< double >::infinity();
@@ -126,6 +134,11 @@ void
 nest::SimulationManager::reset_timers_for_dynamics()
 {
   sw_simulate_.reset();
+  sw_wfr_.reset();
+  wfr_iterations_ = 0;
+  wfr_intervals_ = 0;
+  wfr_updates_ = 0;
+  wfr_skipped_updates_ = 0;
 #ifdef TIMER_DETAILED
   sw_gather_spike_data_.reset();
   sw_gather_secondary_data_.reset();
@@ -403,6 +416,8 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
     }
   }
 
+  updateValue< bool >( d, names::wfr_skip_unchanged, wfr_skip_unchanged_ );
+
   // update time limit
   double t_new = 0.0;
   if ( updateValue< double >( d, names::update_time_limit, t_new ) )
@@ -472,6 +487,7 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< double >( d, names::wfr_tol, wfr_tol_ );
   def< long >( d, names::wfr_max_iterations, wfr_max_iterations_ );
   def< long >( d, names::wfr_interpolation_order, wfr_interpolation_order_ );
+  def< bool >( d, names::wfr_skip_unchanged, wfr_skip_unchanged_ );
 
   def< double >( d, names::update_time_limit, update_time_limit_ );
   def< double >( d, names::min_update_time, min_update_time_ );
@@ -479,6 +495,11 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
 
   def< double >( d, names::time_simulate, sw_simulate_.elapsed() );
   def< double >( d, names::time_communicate_prepare, sw_communicate_prepare_.elapsed() );
+  def< double >( d, names::time_wfr, sw_wfr_.elapsed() );
+  def< long >( d, names::wfr_iterations, wfr_iterations_ );
+  def< long >( d, names::wfr_intervals, wfr_intervals_ );
+  def< long >( d, names::wfr_updates, wfr_updates_ );
+  def< long >( d, names::wfr_skipped_updates, wfr_skipped_updates_ );
 #ifdef TIMER_DETAILED
   def< double >( d, names::time_gather_spike_data, sw_gather_spike_data_.elapsed() );
   def< double >( d, names::time_gather_secondary_data, sw_gather_secondary_data_.elapsed() );
@@ -548,6 +569,9 @@ nest::SimulationManager::prepare()
   // it resizes coefficient arrays for secondary events
   kernel().node_manager.check_wfr_use();
 
+  // map volume transmitters to the synapse types they modulate
+  kernel().connection_manager.update_volume_transmitter_index();
+
   if ( kernel().node_manager.have_nodes_changed() or kernel().connection_manager.connections_have_changed() )
   {
 #pragma omp parallel
@@ -653,6 +677,7 @@ nest::SimulationManager::run( Time const& t )
 
   call_update_();
 
+  kernel().node_manager.post_run_cleanup();
   kernel().io_manager.post_run_hook();
   kernel().random_manager.check_rng_synchrony();
 
@@ -833,9 +858,6 @@ nest::SimulationManager::wfr_update_( Node* n )
 void
 nest::SimulationManager::update_()
 {
-  // to store done values of the different threads
-  std::vector< bool > done;
-  bool done_all = true;
   long old_to_step;
 
   double start_current_update = sw_simulate_.elapsed();
@@ -843,6 +865,10 @@ nest::SimulationManager::update_()
 
   std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( kernel().vp_manager.get_num_threads() );
 
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  wfr_done_.assign( num_threads, WfrDone() );
+  wfr_arrived_ = 0;
+
 // parallel section begins
 #pragma omp parallel
   {
@@ -852,6 +878,12 @@ nest::SimulationManager::update_()
     // exceptions here and then handle them after the parallel region.
     try
     {
+      if ( kernel().connection_manager.secondary_connections_exist() )
+      {
+        // weights and buffers of the targets may have changed since the last run
+        kernel().connection_manager.build_rate_matrices( tid );
+      }
+
       do
       {
         if ( print_time_ )
@@ -952,6 +984,7 @@ nest::SimulationManager::update_()
             {
               to_step_ = kernel().connection_manager.get_min_delay();
             }
+            sw_wfr_.start();
           }
 
           bool max_iterations_reached = true;
@@ -968,31 +1001,24 @@ nest::SimulationManager::update_()
             {
               done_p = wfr_update_( *i ) and done_p;
             }
-
-// add done value of thread p to done vector
-#pragma omp critical
-            done.push_back( done_p );
-// parallel section ends, wait until all threads are done -> synchronize
-#pragma omp barrier
-
-// the following block is executed by a single thread
-// the other threads wait at the end of the block
-#pragma omp single
+            wfr_done_[ tid ].updates_ += thread_local_wfr_nodes.size();
+
+            // The last thread to finish its updates combines the done
+            // values of all threads and gathers the SecondaryEvents (e.g.
+            // GapJunctionEvents), while the other threads already wait
+            // at the barrier. The acquire-release counter makes the done
+            // values of all other threads visible to the last thread, so
+            // that a single barrier per iteration suffices.
+            wfr_done_[ tid ].done_ = done_p;
+            if ( wfr_arrived_.fetch_add( 1, std::memory_order_acq_rel ) + 1 == num_threads )
             {
-              // check whether all threads are done
-              for ( size_t i = 0; i < done.size(); ++i )
-              {
-                done_all = done[ i ] and done_all;
-              }
-
-              // gather SecondaryEvents (e.g. GapJunctionEvents)
+              wfr_arrived_.store( 0, std::memory_order_relaxed );
+              const bool done_all = std::all_of(
+                wfr_done_.begin(), wfr_done_.end(), []( const WfrDone& thread_done ) { return thread_done.done_; } );
               kernel().event_delivery_manager.gather_secondary_events( done_all );
-
-              // reset done and done_all
-              //(needs to be in the single threaded part)
-              done_all = true;
-              done.clear();
+              ++wfr_iterations_;
             }
+#pragma omp barrier
 
             // deliver SecondaryEvents generated during wfr_update
             // returns the done value over all threads
@@ -1007,6 +1033,8 @@ nest::SimulationManager::update_()
 
 #pragma omp single
           {
+            sw_wfr_.stop();
+            ++wfr_intervals_;
             to_step_ = old_to_step;
             if ( max_iterations_reached )
             {
@@ -1034,10 +1062,7 @@ nest::SimulationManager::update_()
             node->update_synaptic_elements( Time( Time::step( clock_.get_steps() + from_step_ ) ).get_ms() );
           }
 #pragma omp barrier
-#pragma omp single
-          {
-            kernel().sp_manager.update_structural_plasticity();
-          }
+          kernel().sp_manager.update_structural_plasticity( tid );
           // Remove 10% of the vacant elements
           for ( SparseNodeArray::const_iterator i = kernel().node_manager.get_local_nodes( tid ).begin();
                 i != kernel().node_manager.get_local_nodes( tid ).end();
@@ -1050,8 +1075,12 @@ nest::SimulationManager::update_()
           // after structural plasticity has created and deleted
           // connections, update the connection infrastructure; implies
           // complete removal of presynaptic part and reconstruction
-          // from postsynaptic data
-          update_connection_infrastructure( tid );
+          // from postsynaptic data. The flag is set consistently on all
+          // ranks, so the rebuild is skipped globally if nothing changed.
+          if ( kernel().connection_manager.connections_have_changed() )
+          {
+            update_connection_infrastructure( tid );
+          }
 
         } // of structural plasticity
 
@@ -1133,11 +1162,11 @@ nest::SimulationManager::update_()
 // end of master section, all threads have to synchronize at this point
 #pragma omp barrier
 
-        // if block to avoid omp barrier if SIONLIB is not used
+        // Post-step activities of the recording backends only touch data of
+        // the calling thread; the collective write of the SIONlib backend
+        // synchronizes the threads by itself, so no barrier is needed here.
 #ifdef HAVE_SIONLIB
         kernel().io_manager.post_step_hook();
-// enforce synchronization after post-step activities of the recording backends
-#pragma omp barrier
 #endif
 
         const double end_current_update = sw_simulate_.elapsed();
@@ -1166,6 +1195,12 @@ nest::SimulationManager::update_()
     }
   } // of omp parallel
 
+  for ( const WfrDone& thread_done : wfr_done_ )
+  {
+    wfr_updates_ += thread_done.updates_;
+    wfr_skipped_updates_ += thread_done.skipped_;
+  }
+
   if ( update_time_limit_exceeded )
   {
     LOG( M_ERROR, "SimulationManager::update", "Update time limit exceeded." );
@@ -27,6 +27,7 @@
 #include <sys/time.h>
 
 // C++ includes:
+#include <atomic>
 #include <vector>
 
 // Includes from libnestutil:
@@ -105,6 +106,17 @@ public:
    */
   size_t get_wfr_interpolation_order() const;
 
+  /**
+   * Returns true if nodes with unchanged gap junction input skip their
+   * waveform relaxation updates.
+   */
+  bool get_wfr_skip_unchanged() const;
+
+  /**
+   * Count a waveform relaxation update skipped by a node on thread tid.
+   */
+  void count_skipped_wfr_update( const size_t tid );
+
   /**
    * Get the time at the beginning of the current time slice.
    */
@@ -222,14 +234,37 @@ private:
                                    //!< relaxation
   size_t wfr_interpolation_order_; //!< interpolation order for waveform
                                    //!< relaxation method
+  bool wfr_skip_unchanged_;        //!< true if nodes with unchanged input skip wfr updates
   double update_time_limit_;       //!< throw exception if single update cycle takes longer
                                    //!< than update_time_limit_ (seconds, default inf)
   double min_update_time_;         //!< shortest update time seen so far (seconds)
   double max_update_time_;         //!< longest update time seen so far (seconds)
+  long wfr_iterations_;            //!< number of waveform relaxation iterations in last simulation
+  long wfr_intervals_;             //!< number of intervals solved by waveform relaxation in last simulation
+  long wfr_updates_;               //!< number of wfr updates of nodes in last simulation, including skipped ones
+  long wfr_skipped_updates_;       //!< number of wfr updates skipped by nodes in last simulation
+
+  /**
+   * Convergence flag and update counts of a thread in a waveform relaxation iteration.
+   *
+   * Each entry is only written by its own thread and occupies a cache
+   * line of its own, so that threads do not invalidate each others'
+   * caches when they finish their updates.
+   */
+  struct alignas( 64 ) WfrDone
+  {
+    bool done_;
+    long updates_; //!< number of wfr updates of nodes in the current call to update_()
+    long skipped_; //!< number of these updates skipped by the nodes
+  };
+
+  std::vector< WfrDone > wfr_done_;   //!< convergence flags of all threads
+  std::atomic< size_t > wfr_arrived_; //!< number of threads that have finished the current iteration
 
   // private stop watches for benchmarking purposes
   Stopwatch sw_simulate_;
   Stopwatch sw_communicate_prepare_;
+  Stopwatch sw_wfr_;
 #ifdef TIMER_DETAILED
   // intended for internal core developers, not for use in the public API
   Stopwatch sw_gather_spike_data_;
@@ -338,6 +373,18 @@ SimulationManager::get_wfr_interpolation_order() const
   return wfr_interpolation_order_;
 }
 
+inline bool
+SimulationManager::get_wfr_skip_unchanged() const
+{
+  return wfr_skip_unchanged_;
+}
+
+inline void
+SimulationManager::count_skipped_wfr_update( const size_t tid )
+{
+  ++wfr_done_[ tid ].skipped_;
+}
+
 inline Time
 SimulationManager::get_eprop_update_interval() const
 {
@@ -27,7 +27,8 @@
 #include <limits>
 
 nest::SliceRingBuffer::SliceRingBuffer()
-  : refract_( std::numeric_limits< long >::max(), 0, 0 )
+  : deliver_( nullptr )
+  , refract_( std::numeric_limits< long >::max(), 0, 0 )
 {
   //  resize();  // sets up queue_
 }
@@ -44,6 +45,11 @@ nest::SliceRingBuffer::resize()
     clear();
   }
 
+  // nodes created in the middle of a slice get their first call to
+  // prepare_delivery() only in the next slice; until then, deliver from
+  // the current slot, which is empty
+  deliver_ = &( queue_[ kernel().event_delivery_manager.get_slice_modulo( 0 ) ] );
+
 #ifndef HAVE_STL_VECTOR_CAPACITY_BASE_UNITY
   // create 1-element buffers
   for ( size_t j = 0; j < queue_.size(); ++j )
@@ -68,8 +74,53 @@ nest::SliceRingBuffer::prepare_delivery()
   // vector to deliver from in this slice
   deliver_ = &( queue_[ kernel().event_delivery_manager.get_slice_modulo( 0 ) ] );
 
-  // sort events, first event last
-  std::sort( deliver_->begin(), deliver_->end(), std::greater< SpikeInfo >() );
+  // with fewer spikes than steps, grouping by step does not pay off
+  const size_t n_spikes = deliver_->size();
+  const size_t n_steps = kernel().connection_manager.get_min_delay();
+  if ( n_spikes < n_steps )
+  {
+    // sort events, first event last
+    std::sort( deliver_->begin(), deliver_->end(), std::greater< SpikeInfo >() );
+    return;
+  }
+
+  // all spikes in the slot have stamps slice_origin ... slice_origin + min_delay - 1
+  const long first_stamp = kernel().simulation_manager.get_slice_origin().get_steps();
+
+  // scratch space shared by all buffers on this thread
+  static thread_local std::vector< size_t > step_end;
+  static thread_local std::vector< SpikeInfo > grouped;
+  step_end.assign( n_steps + 1, 0 );
+  grouped.resize( n_spikes, SpikeInfo( 0, 0, 0 ) );
+
+  // count spikes per step, last step first, since the first event is
+  // delivered from the end of the vector
+  for ( const SpikeInfo& spike : *deliver_ )
+  {
+    const size_t step = n_steps - 1 - static_cast< size_t >( spike.stamp_ - first_stamp );
+    assert( step < n_steps );
+    ++step_end[ step + 1 ];
+  }
+  for ( size_t step = 0; step < n_steps; ++step )
+  {
+    step_end[ step + 1 ] += step_end[ step ];
+  }
+
+  // place spikes in their step, which advances step_end from the beginning
+  // to the end of each step, then sort each step, first event last
+  for ( const SpikeInfo& spike : *deliver_ )
+  {
+    const size_t step = n_steps - 1 - static_cast< size_t >( spike.stamp_ - first_stamp );
+    grouped[ step_end[ step ]++ ] = spike;
+  }
+  size_t step_begin = 0;
+  for ( size_t step = 0; step < n_steps; ++step )
+  {
+    std::sort( grouped.begin() + step_begin, grouped.begin() + step_end[ step ], std::greater< SpikeInfo >() );
+    step_begin = step_end[ step ];
+  }
+
+  std::copy( grouped.begin(), grouped.begin() + n_spikes, deliver_->begin() );
 }
 
 void
@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
+#include <limits>
 #include <vector>
 
 // Generated includes:
@@ -42,7 +43,7 @@ namespace nest
 /**
  * Queue for all spikes arriving into a neuron.
  *
- * Spikes are stored unsorted on arrival, but are sorted when
+ * Spikes are stored unsorted on arrival, but are ordered when
  * prepare_delivery() is called.  They can then be retrieved
  * one by one in correct temporal order.  Coinciding spikes
  * are combined into one, see get_next_spike().
@@ -54,6 +55,17 @@ namespace nest
  * - We have a pseudo-ring of Nbuff=ceil((min_del+max_del)/min_del) elements.
  *   Each element is a vector storing incoming spikes that
  *   are due during a given time slice.
+ * - prepare_delivery() groups the spikes of the slice by time step with
+ *   a counting pass over the min_delay steps of the slice and then only
+ *   orders the spikes within each step by offset. For n spikes in a slice
+ *   and k spikes per step, this costs O(n log k) instead of O(n log n).
+ *   Slices with fewer spikes than steps are sorted as a whole.
+ * - The grouping uses scratch buffers shared by all buffers on a thread,
+ *   so the memory per neuron is one vector per slot plus the spikes in
+ *   flight. Measured as the increase in resident memory per
+ *   iaf_psc_exp_ps, this is about 5.6 kB at resolution and min_delay
+ *   0.1 ms (101 slots) and 20 kB at 0.01 ms (1001 slots), both for
+ *   max_delay 10 ms.
  *
  * @note The following assumptions underlie the handling of
  * pseudo-events for return from refractoriness:
@@ -84,7 +96,7 @@ public:
   void add_refractory( const long stamp, const double ps_offset );
 
   /**
-   * Prepare for spike delivery in current slice by sorting.
+   * Prepare for spike delivery in current slice by ordering its spikes.
    */
   void prepare_delivery();
 
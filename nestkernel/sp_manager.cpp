@@ -44,6 +44,8 @@ SPManager::SPManager()
   , sp_conn_builders_()
   , growthcurve_factories_()
   , growthcurvedict_( new Dictionary() )
+  , pre_synapses_deleted_( false )
+  , post_synapses_deleted_( false )
 {
 }
 
@@ -64,6 +66,7 @@ SPManager::initialize( const bool adjust_number_of_threads_or_rng_only )
 
   structural_plasticity_update_interval_ = 10000.;
   structural_plasticity_enabled_ = false;
+  thread_synaptic_elements_.assign( kernel().vp_manager.get_num_threads(), SynapticElements() );
 }
 
 void
@@ -308,103 +311,159 @@ SPManager::disconnect( NodeCollectionPTR sources,
 }
 
 void
-SPManager::update_structural_plasticity()
+SPManager::update_structural_plasticity( const size_t tid )
 {
   for ( std::vector< SPBuilder* >::const_iterator i = sp_conn_builders_.begin(); i != sp_conn_builders_.end(); ++i )
   {
-    update_structural_plasticity( ( *i ) );
+    update_structural_plasticity( tid, ( *i ) );
   }
 }
 
 void
-SPManager::update_structural_plasticity( SPBuilder* sp_builder )
+SPManager::update_structural_plasticity( const size_t tid, SPBuilder* sp_builder )
 {
-  // Index of neurons having a vacant synaptic element
-  std::vector< size_t > pre_vacant_id;  // pre synaptic elements (e.g Axon)
-  std::vector< size_t > post_vacant_id; // postsynaptic element (e.g Den)
-  std::vector< int > pre_vacant_n;      // number of synaptic elements
-  std::vector< int > post_vacant_n;     // number of synaptic elements
-
-  // Index of neuron deleting a synaptic element
-  std::vector< size_t > pre_deleted_id, post_deleted_id;
-  std::vector< int > pre_deleted_n, post_deleted_n;
-
-  // Global vector for vacant and deleted synaptic element
-  std::vector< size_t > pre_vacant_id_global, post_vacant_id_global;
-  std::vector< int > pre_vacant_n_global, post_vacant_n_global;
-  std::vector< size_t > pre_deleted_id_global, post_deleted_id_global;
-  std::vector< int > pre_deleted_n_global, post_deleted_n_global;
-
-  // Vector of displacements for communication
-  std::vector< int > displacements;
+  const std::string& se_pre_name = sp_builder->get_pre_synaptic_element_name();
+  const std::string& se_post_name = sp_builder->get_post_synaptic_element_name();
+  const size_t syn_id = sp_builder->get_synapse_model();
+
+  // Delete the synapses of lost pre synaptic elements (e.g. Axon)
+  get_synaptic_elements( tid, se_pre_name );
+#pragma omp barrier
+#pragma omp single
+  {
+    exceptions_raised_.assign( kernel().vp_manager.get_num_threads(), nullptr );
+    merge_synaptic_elements_( pre_synaptic_elements_ );
+
+    // Communicate the number of deleted pre-synaptic elements
+    std::vector< size_t > pre_deleted_id_global;
+    std::vector< int > pre_deleted_n_global;
+    std::vector< int > displacements;
+    kernel().mpi_manager.communicate( pre_synaptic_elements_.deleted_id, pre_deleted_id_global, displacements );
+    kernel().mpi_manager.communicate( pre_synaptic_elements_.deleted_n, pre_deleted_n_global, displacements );
+
+    sp_sources_.clear();
+    sp_targets_.clear();
+    pre_synapses_deleted_ = not pre_deleted_id_global.empty();
+    if ( pre_synapses_deleted_ )
+    {
+      select_synapses_from_pre(
+        pre_deleted_id_global, pre_deleted_n_global, syn_id, se_post_name, sp_sources_, sp_targets_ );
+    }
+  }
+  delete_synapses( tid, sp_sources_, sp_targets_, syn_id, se_pre_name, se_post_name );
+#pragma omp barrier
+  check_exceptions_raised_();
 
-  // Get pre synaptic elements data from global nodes
-  get_synaptic_elements(
-    sp_builder->get_pre_synaptic_element_name(), pre_vacant_id, pre_vacant_n, pre_deleted_id, pre_deleted_n );
+  // Delete the synapses of lost postsynaptic elements (e.g. Den)
+  get_synaptic_elements( tid, se_post_name );
+#pragma omp barrier
+#pragma omp single
+  {
+    merge_synaptic_elements_( post_synaptic_elements_ );
 
-  // Communicate the number of deleted pre-synaptic elements
-  kernel().mpi_manager.communicate( pre_deleted_id, pre_deleted_id_global, displacements );
-  kernel().mpi_manager.communicate( pre_deleted_n, pre_deleted_n_global, displacements );
+    // Communicate the number of deleted postsynaptic elements
+    std::vector< size_t > post_deleted_id_global;
+    std::vector< int > post_deleted_n_global;
+    std::vector< int > displacements;
+    kernel().mpi_manager.communicate( post_synaptic_elements_.deleted_id, post_deleted_id_global, displacements );
+    kernel().mpi_manager.communicate( post_synaptic_elements_.deleted_n, post_deleted_n_global, displacements );
 
-  if ( pre_deleted_id_global.size() > 0 )
+    sp_sources_.clear();
+    sp_targets_.clear();
+    post_synapses_deleted_ = not post_deleted_id_global.empty();
+    if ( post_synapses_deleted_ )
+    {
+      select_synapses_from_post( post_deleted_id_global, post_deleted_n_global, syn_id, sp_sources_, sp_targets_ );
+    }
+  }
+  delete_synapses( tid, sp_sources_, sp_targets_, syn_id, se_pre_name, se_post_name );
+#pragma omp barrier
+  check_exceptions_raised_();
+
+  // Update the number of vacant synaptic elements after deletions. The flags
+  // are shared, so all threads take the same branches.
+  if ( pre_synapses_deleted_ or post_synapses_deleted_ )
   {
-    delete_synapses_from_pre( pre_deleted_id_global,
-      pre_deleted_n_global,
-      sp_builder->get_synapse_model(),
-      sp_builder->get_pre_synaptic_element_name(),
-      sp_builder->get_post_synaptic_element_name() );
-    // update the number of synaptic elements
-    get_synaptic_elements(
-      sp_builder->get_pre_synaptic_element_name(), pre_vacant_id, pre_vacant_n, pre_deleted_id, pre_deleted_n );
+    get_synaptic_elements( tid, se_pre_name );
+#pragma omp barrier
+#pragma omp single
+    {
+      merge_synaptic_elements_( pre_synaptic_elements_ );
+    }
+  }
+  if ( post_synapses_deleted_ )
+  {
+    get_synaptic_elements( tid, se_post_name );
+#pragma omp barrier
+#pragma omp single
+    {
+      merge_synaptic_elements_( post_synaptic_elements_ );
+    }
   }
-  // Get postsynaptic elements data from local nodes
-  get_synaptic_elements(
-    sp_builder->get_post_synaptic_element_name(), post_vacant_id, post_vacant_n, post_deleted_id, post_deleted_n );
-  // Communicate the number of deleted postsynaptic elements
-  kernel().mpi_manager.communicate( post_deleted_id, post_deleted_id_global, displacements );
-  kernel().mpi_manager.communicate( post_deleted_n, post_deleted_n_global, displacements );
 
-  if ( post_deleted_id_global.size() > 0 )
+#pragma omp single
   {
-    delete_synapses_from_post( post_deleted_id_global,
-      post_deleted_n_global,
-      sp_builder->get_synapse_model(),
-      sp_builder->get_pre_synaptic_element_name(),
-      sp_builder->get_post_synaptic_element_name() );
-    get_synaptic_elements(
-      sp_builder->get_pre_synaptic_element_name(), pre_vacant_id, pre_vacant_n, pre_deleted_id, pre_deleted_n );
-    get_synaptic_elements(
-      sp_builder->get_post_synaptic_element_name(), post_vacant_id, post_vacant_n, post_deleted_id, post_deleted_n );
+    // Communicate vacant elements
+    std::vector< size_t > pre_vacant_id_global, post_vacant_id_global;
+    std::vector< int > pre_vacant_n_global, post_vacant_n_global;
+    std::vector< int > displacements;
+    kernel().mpi_manager.communicate( pre_synaptic_elements_.vacant_id, pre_vacant_id_global, displacements );
+    kernel().mpi_manager.communicate( pre_synaptic_elements_.vacant_n, pre_vacant_n_global, displacements );
+    kernel().mpi_manager.communicate( post_synaptic_elements_.vacant_id, post_vacant_id_global, displacements );
+    kernel().mpi_manager.communicate( post_synaptic_elements_.vacant_n, post_vacant_n_global, displacements );
+
+    sp_sources_.clear();
+    sp_targets_.clear();
+    if ( pre_vacant_id_global.size() > 0 and post_vacant_id_global.size() > 0 )
+    {
+      select_synapses_to_create(
+        pre_vacant_id_global, pre_vacant_n_global, post_vacant_id_global, post_vacant_n_global, sp_sources_, sp_targets_ );
+    }
   }
 
-  // Communicate vacant elements
-  kernel().mpi_manager.communicate( pre_vacant_id, pre_vacant_id_global, displacements );
-  kernel().mpi_manager.communicate( pre_vacant_n, pre_vacant_n_global, displacements );
-  kernel().mpi_manager.communicate( post_vacant_id, post_vacant_id_global, displacements );
-  kernel().mpi_manager.communicate( post_vacant_n, post_vacant_n_global, displacements );
+  // use the global vectors so that all ranks agree on whether the
+  // connection infrastructure needs to be updated; only the master
+  // thread may set the flag
+  if ( tid == 0 and ( not sp_sources_.empty() or pre_synapses_deleted_ or post_synapses_deleted_ ) )
+  {
+    kernel().connection_manager.set_connections_have_changed();
+  }
 
-  bool synapses_created = false;
-  if ( pre_vacant_id_global.size() > 0 and post_vacant_id_global.size() > 0 )
+  // create synapses
+  try
   {
-    synapses_created = create_synapses(
-      pre_vacant_id_global, pre_vacant_n_global, post_vacant_id_global, post_vacant_n_global, sp_builder );
+    sp_builder->sp_connect( tid, sp_sources_, sp_targets_ );
   }
-  if ( synapses_created or post_deleted_id.size() > 0 or pre_deleted_id.size() > 0 )
+  catch ( std::exception& err )
   {
-    kernel().connection_manager.set_connections_have_changed();
+    // We must create a new exception here, err's lifetime ends at
+    // the end of the catch block.
+    exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
   }
+#pragma omp barrier
+  check_exceptions_raised_();
 }
 
-bool
-SPManager::create_synapses( std::vector< size_t >& pre_id,
+void
+SPManager::check_exceptions_raised_() const
+{
+  for ( size_t tid = 0; tid < exceptions_raised_.size(); ++tid )
+  {
+    if ( exceptions_raised_[ tid ].get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised_[ tid ] ) );
+    }
+  }
+}
+
+void
+SPManager::select_synapses_to_create( std::vector< size_t >& pre_id,
   std::vector< int >& pre_n,
   std::vector< size_t >& post_id,
   std::vector< int >& post_n,
-  SPBuilder* sp_conn_builder )
+  std::vector< size_t >& pre_id_rnd,
+  std::vector< size_t >& post_id_rnd )
 {
-  std::vector< size_t > pre_id_rnd;
-  std::vector< size_t > post_id_rnd;
-
   // shuffle the vacant element
   serialize_id( pre_id, pre_n, pre_id_rnd );
   serialize_id( post_id, post_n, post_id_rnd );
@@ -424,19 +483,15 @@ SPManager::create_synapses( std::vector< size_t >& pre_id,
     global_shuffle( post_id_rnd, pre_id_rnd.size() );
     post_id_rnd.resize( pre_id_rnd.size() );
   }
-
-  // create synapse
-  sp_conn_builder->sp_connect( pre_id_rnd, post_id_rnd );
-
-  return not pre_id_rnd.empty();
 }
 
 void
-SPManager::delete_synapses_from_pre( const std::vector< size_t >& pre_deleted_id,
+SPManager::select_synapses_from_pre( const std::vector< size_t >& pre_deleted_id,
   std::vector< int >& pre_deleted_n,
   const size_t synapse_model,
-  const std::string& se_pre_name,
-  const std::string& se_post_name )
+  const std::string& se_post_name,
+  std::vector< size_t >& sources,
+  std::vector< size_t >& targets )
 {
   // Synapses deletion due to the loss of a pre-synaptic element need a
   // communication of the lists of target
@@ -458,8 +513,10 @@ SPManager::delete_synapses_from_pre( const std::vector< size_t >& pre_deleted_id
   connectivity_it = connectivity.begin();
   for ( ; id_it != pre_deleted_id.end() and n_it != pre_deleted_n.end(); id_it++, n_it++, connectivity_it++ )
   {
-    // Communicate the list of targets
+    // Communicate the list of targets, ordered independently of the
+    // distribution of the connections over threads
     kernel().mpi_manager.communicate( *connectivity_it, global_targets, displacements );
+    std::sort( global_targets.begin(), global_targets.end() );
     // shuffle only the first n items, n is the number of deleted synaptic
     // elements
     if ( -( *n_it ) > static_cast< int >( global_targets.size() ) )
@@ -470,20 +527,43 @@ SPManager::delete_synapses_from_pre( const std::vector< size_t >& pre_deleted_id
 
     for ( int i = 0; i < -( *n_it ); ++i ) // n is negative
     {
-      delete_synapse( *id_it, global_targets[ i ], synapse_model, se_pre_name, se_post_name );
+      sources.push_back( *id_it );
+      targets.push_back( global_targets[ i ] );
+    }
+  }
+}
+
+void
+SPManager::delete_synapses( const size_t tid,
+  const std::vector< size_t >& sources,
+  const std::vector< size_t >& targets,
+  const long syn_id,
+  const std::string& se_pre_name,
+  const std::string& se_post_name )
+{
+  try
+  {
+    for ( size_t i = 0; i < sources.size(); ++i )
+    {
+      delete_synapse( tid, sources[ i ], targets[ i ], syn_id, se_pre_name, se_post_name );
     }
   }
+  catch ( std::exception& err )
+  {
+    // We must create a new exception here, err's lifetime ends at
+    // the end of the catch block.
+    exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+  }
 }
 
 void
-SPManager::delete_synapse( const size_t snode_id,
+SPManager::delete_synapse( const size_t tid,
+  const size_t snode_id,
   const size_t tnode_id,
   const long syn_id,
-  const std::string se_pre_name,
-  const std::string se_post_name )
+  const std::string& se_pre_name,
+  const std::string& se_post_name )
 {
-  // get thread id
-  const size_t tid = kernel().vp_manager.get_thread_id();
   if ( kernel().node_manager.is_local_node_id( snode_id ) )
   {
     Node* const source = kernel().node_manager.get_node_or_proxy( snode_id );
@@ -508,11 +588,11 @@ SPManager::delete_synapse( const size_t snode_id,
 }
 
 void
-SPManager::delete_synapses_from_post( std::vector< size_t >& post_deleted_id,
+SPManager::select_synapses_from_post( const std::vector< size_t >& post_deleted_id,
   std::vector< int >& post_deleted_n,
-  size_t synapse_model,
-  std::string se_pre_name,
-  std::string se_post_name )
+  const size_t synapse_model,
+  std::vector< size_t >& sources,
+  std::vector< size_t >& targets )
 {
   // TODO: Synapses deletion due to the loss of a postsynaptic element can
   // be done locally (except for the update of the number of pre-synaptic
@@ -525,7 +605,7 @@ SPManager::delete_synapses_from_post( std::vector< size_t >& post_deleted_id,
 
   // iterators
   std::vector< std::vector< size_t > >::iterator connectivity_it;
-  std::vector< size_t >::iterator id_it;
+  std::vector< size_t >::const_iterator id_it;
   std::vector< int >::iterator n_it;
 
   // Retrieve the connected sources
@@ -537,8 +617,10 @@ SPManager::delete_synapses_from_post( std::vector< size_t >& post_deleted_id,
 
   for ( ; id_it != post_deleted_id.end() and n_it != post_deleted_n.end(); id_it++, n_it++, connectivity_it++ )
   {
-    // Communicate the list of sources
+    // Communicate the list of sources, ordered independently of the
+    // distribution of the connections over threads
     kernel().mpi_manager.communicate( *connectivity_it, global_sources, displacements );
+    std::sort( global_sources.begin(), global_sources.end() );
     // shuffle only the first n items, n is the number of deleted synaptic
     // elements
     if ( -( *n_it ) > static_cast< int >( global_sources.size() ) )
@@ -549,71 +631,77 @@ SPManager::delete_synapses_from_post( std::vector< size_t >& post_deleted_id,
 
     for ( int i = 0; i < -( *n_it ); i++ ) // n is negative
     {
-      delete_synapse( global_sources[ i ], *id_it, synapse_model, se_pre_name, se_post_name );
+      sources.push_back( global_sources[ i ] );
+      targets.push_back( *id_it );
     }
   }
 }
 
 void
-nest::SPManager::get_synaptic_elements( std::string se_name,
-  std::vector< size_t >& se_vacant_id,
-  std::vector< int >& se_vacant_n,
-  std::vector< size_t >& se_deleted_id,
-  std::vector< int >& se_deleted_n )
+nest::SPManager::get_synaptic_elements( const size_t tid, const std::string& se_name )
 {
-  // local nodes
-  size_t n_vacant_id = 0;
-  size_t n_deleted_id = 0;
-  size_t node_id;
-  int n;
-  size_t n_nodes = kernel().node_manager.size();
-  se_vacant_id.clear();
-  se_vacant_n.clear();
-  se_deleted_id.clear();
-  se_deleted_n.clear();
-
-  se_vacant_id.resize( n_nodes );
-  se_vacant_n.resize( n_nodes );
-  se_deleted_id.resize( n_nodes );
-  se_deleted_n.resize( n_nodes );
-
-  std::vector< size_t >::iterator vacant_id_it = se_vacant_id.begin();
-  std::vector< int >::iterator vacant_n_it = se_vacant_n.begin();
-  std::vector< size_t >::iterator deleted_id_it = se_deleted_id.begin();
-  std::vector< int >::iterator deleted_n_it = se_deleted_n.begin();
-  SparseNodeArray::const_iterator node_it;
-
-  for ( size_t tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
-  {
-    const SparseNodeArray& local_nodes = kernel().node_manager.get_local_nodes( tid );
-    SparseNodeArray::const_iterator node_it;
-    for ( node_it = local_nodes.begin(); node_it < local_nodes.end(); node_it++ )
-    {
-      node_id = node_it->get_node_id();
-      Node* node = node_it->get_node();
-      n = node->get_synaptic_elements_vacant( se_name );
-      if ( n > 0 )
-      {
-        ( *vacant_id_it ) = node_id;
-        ( *vacant_n_it ) = n;
-        n_vacant_id++;
-        vacant_id_it++;
-        vacant_n_it++;
-      }
-      if ( n < 0 )
-      {
-        ( *deleted_id_it ) = node_id;
-        ( *deleted_n_it ) = n;
-        n_deleted_id++;
-        deleted_id_it++;
-        deleted_n_it++;
-      }
+  SynapticElements& elements = thread_synaptic_elements_[ tid ];
+  elements.vacant_id.clear();
+  elements.vacant_n.clear();
+  elements.deleted_id.clear();
+  elements.deleted_n.clear();
+
+  const Name se( se_name );
+  const SparseNodeArray& local_nodes = kernel().node_manager.get_local_nodes( tid );
+  for ( SparseNodeArray::const_iterator node_it = local_nodes.begin(); node_it < local_nodes.end(); node_it++ )
+  {
+    const int n = node_it->get_node()->get_synaptic_elements_vacant( se );
+    if ( n > 0 )
+    {
+      elements.vacant_id.push_back( node_it->get_node_id() );
+      elements.vacant_n.push_back( n );
+    }
+    if ( n < 0 )
+    {
+      elements.deleted_id.push_back( node_it->get_node_id() );
+      elements.deleted_n.push_back( n );
     }
   }
-  se_vacant_id.resize( n_vacant_id );
-  se_vacant_n.resize( n_vacant_id );
-  se_deleted_id.resize( n_deleted_id );
-  se_deleted_n.resize( n_deleted_id );
+}
+
+void
+nest::SPManager::merge_synaptic_elements_( SynapticElements& elements ) const
+{
+  std::vector< std::pair< size_t, int > > vacant;
+  std::vector< std::pair< size_t, int > > deleted;
+  for ( const SynapticElements& thread_elements : thread_synaptic_elements_ )
+  {
+    for ( size_t i = 0; i < thread_elements.vacant_id.size(); ++i )
+    {
+      vacant.emplace_back( thread_elements.vacant_id[ i ], thread_elements.vacant_n[ i ] );
+    }
+    for ( size_t i = 0; i < thread_elements.deleted_id.size(); ++i )
+    {
+      deleted.emplace_back( thread_elements.deleted_id[ i ], thread_elements.deleted_n[ i ] );
+    }
+  }
+
+  // the nodes of each thread are ordered already, so only several threads need sorting
+  if ( thread_synaptic_elements_.size() > 1 )
+  {
+    std::sort( vacant.begin(), vacant.end() );
+    std::sort( deleted.begin(), deleted.end() );
+  }
+
+  elements.vacant_id.resize( vacant.size() );
+  elements.vacant_n.resize( vacant.size() );
+  for ( size_t i = 0; i < vacant.size(); ++i )
+  {
+    elements.vacant_id[ i ] = vacant[ i ].first;
+    elements.vacant_n[ i ] = vacant[ i ].second;
+  }
+  elements.deleted_id.resize( deleted.size() );
+  elements.deleted_n.resize( deleted.size() );
+  for ( size_t i = 0; i < deleted.size(); ++i )
+  {
+    elements.deleted_id[ i ] = deleted[ i ].first;
+    elements.deleted_n[ i ] = deleted[ i ].second;
+  }
 }
 
 void
@@ -646,32 +734,57 @@ nest::SPManager::global_shuffle( std::vector< size_t >& v, size_t n )
 {
   assert( n <= v.size() );
 
-  // shuffle res using the global random number generator
-  unsigned int N = v.size();
+  // Draw n elements without replacement using the global random number
+  // generator. Each draw picks the rnd-th of the elements not drawn so far,
+  // in their original order. A Fenwick tree counting the remaining elements
+  // locates this element in O(log N), avoiding an O(N) erase per draw.
+  const size_t N = v.size();
+  std::vector< size_t > remaining( N + 1, 0 );
+  for ( size_t i = 1; i <= N; ++i )
+  {
+    remaining[ i ] += 1;
+    const size_t parent = i + ( i & ( ~i + 1 ) );
+    if ( parent <= N )
+    {
+      remaining[ parent ] += remaining[ i ];
+    }
+  }
+  size_t top_step = 1;
+  while ( 2 * top_step <= N )
+  {
+    top_step *= 2;
+  }
+
   std::vector< size_t > v2;
-  size_t tmp;
-  unsigned int rnd;
-  std::vector< size_t >::iterator rndi;
-  for ( unsigned int i = 0; i < n; i++ )
-  {
-    N = v.size();
-    rnd = get_rank_synced_rng()->ulrand( N );
-    tmp = v[ rnd ];
-    v2.push_back( tmp );
-    rndi = v.begin();
-    v.erase( rndi + rnd );
-  }
-  v = v2;
+  v2.reserve( n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    size_t rnd = get_rank_synced_rng()->ulrand( N - i );
+
+    // find the last position at which fewer than rnd + 1 elements remain
+    size_t pos = 0;
+    for ( size_t step = top_step; step > 0; step /= 2 )
+    {
+      if ( pos + step <= N and remaining[ pos + step ] <= rnd )
+      {
+        pos += step;
+        rnd -= remaining[ pos ];
+      }
+    }
+    v2.push_back( v[ pos ] );
+
+    for ( size_t j = pos + 1; j <= N; j += j & ( ~j + 1 ) )
+    {
+      --remaining[ j ];
+    }
+  }
+  v.swap( v2 );
 }
 
 
 void
 nest::SPManager::enable_structural_plasticity()
 {
-  if ( kernel().vp_manager.get_num_threads() > 1 )
-  {
-    throw KernelException( "Structural plasticity can not be used with multiple threads" );
-  }
   if ( not kernel().connection_manager.get_keep_source_table() )
   {
     throw KernelException(
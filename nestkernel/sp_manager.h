@@ -24,6 +24,7 @@
 #define SP_MANAGER_H
 
 // C++ includes:
+#include <memory>
 #include <vector>
 
 // Includes from libnestutil:
@@ -39,6 +40,7 @@
 #include "arraydatum.h"
 #include "dict.h"
 #include "dictdatum.h"
+#include "sliexceptions.h"
 
 namespace nest
 {
@@ -120,8 +122,17 @@ public:
    */
   void disconnect( const size_t snode_id, Node* target, size_t target_thread, const size_t syn_id );
 
-  void update_structural_plasticity();
-  void update_structural_plasticity( SPBuilder* );
+  /**
+   * Create and delete synapses according to the synaptic elements of the nodes.
+   *
+   * Must be called by all threads of a parallel region. Each thread gathers the
+   * synaptic elements of its own nodes and creates and deletes the synapses of
+   * its own nodes. Only the communication between ranks and the random matching
+   * of synaptic elements, which is synchronized across ranks, run on a single
+   * thread.
+   */
+  void update_structural_plasticity( const size_t tid );
+  void update_structural_plasticity( const size_t tid, SPBuilder* );
 
   /**
    * Enable structural plasticity
@@ -157,32 +168,50 @@ public:
    */
   long builder_max_delay() const;
 
-  // Creation of synapses
-  bool create_synapses( std::vector< size_t >& pre_vacant_id,
+  /**
+   * Returns whether structural plasticity synapses have been defined.
+   */
+  bool has_sp_synapses() const;
+
+  // Matching of vacant synaptic elements into pairs of sources and targets of new synapses
+  void select_synapses_to_create( std::vector< size_t >& pre_vacant_id,
     std::vector< int >& pre_vacant_n,
     std::vector< size_t >& post_vacant_id,
     std::vector< int >& post_vacant_n,
-    SPBuilder* sp_conn_builder );
-  // Deletion of synapses on the pre synaptic side
-  void delete_synapses_from_pre( const std::vector< size_t >& pre_deleted_id,
+    std::vector< size_t >& sources,
+    std::vector< size_t >& targets );
+  // Selection of the synapses to delete due to the loss of pre-synaptic elements
+  void select_synapses_from_pre( const std::vector< size_t >& pre_deleted_id,
     std::vector< int >& pre_deleted_n,
     const size_t synapse_model,
+    const std::string& se_post_name,
+    std::vector< size_t >& sources,
+    std::vector< size_t >& targets );
+  // Selection of the synapses to delete due to the loss of postsynaptic elements
+  void select_synapses_from_post( const std::vector< size_t >& post_deleted_id,
+    std::vector< int >& post_deleted_n,
+    const size_t synapse_model,
+    std::vector< size_t >& sources,
+    std::vector< size_t >& targets );
+  // Deletion of the selected synapses whose source or target is on thread tid
+  void delete_synapses( const size_t tid,
+    const std::vector< size_t >& sources,
+    const std::vector< size_t >& targets,
+    const long syn_id,
     const std::string& se_pre_name,
     const std::string& se_post_name );
-  // Deletion of synapses on the postsynaptic side
-  void delete_synapses_from_post( std::vector< size_t >& post_deleted_id,
-    std::vector< int >& post_deleted_n,
-    size_t synapse_model,
-    std::string se_pre_name,
-    std::string se_post_name );
   // Deletion of synapses
-  void delete_synapse( size_t source, size_t target, long syn_id, std::string se_pre_name, std::string se_post_name );
+  void delete_synapse( const size_t tid,
+    const size_t source,
+    const size_t target,
+    const long syn_id,
+    const std::string& se_pre_name,
+    const std::string& se_post_name );
 
-  void get_synaptic_elements( std::string se_name,
-    std::vector< size_t >& se_vacant_id,
-    std::vector< int >& se_vacant_n,
-    std::vector< size_t >& se_deleted_id,
-    std::vector< int >& se_deleted_n );
+  /**
+   * Gather the vacant and deleted synaptic elements of the local nodes of thread tid.
+   */
+  void get_synaptic_elements( const size_t tid, const std::string& se_name );
 
   void serialize_id( std::vector< size_t >& id, std::vector< int >& n, std::vector< size_t >& res );
   void global_shuffle( std::vector< size_t >& v );
@@ -208,6 +237,47 @@ private:
   std::vector< GenericGrowthCurveFactory* > growthcurve_factories_;
 
   DictionaryDatum growthcurvedict_; //!< Dictionary for growth rules.
+
+  /**
+   * Vacant and deleted synaptic elements of one type.
+   */
+  struct SynapticElements
+  {
+    std::vector< size_t > vacant_id;
+    std::vector< int > vacant_n;
+    std::vector< size_t > deleted_id;
+    std::vector< int > deleted_n;
+  };
+
+  /**
+   * Merge the synaptic elements gathered by all threads, ordered by node ID.
+   *
+   * The order makes the matching of synaptic elements independent of the number of threads.
+   */
+  void merge_synaptic_elements_( SynapticElements& elements ) const;
+
+  /**
+   * Throw on all threads an exception raised by any thread since the last barrier.
+   */
+  void check_exceptions_raised_() const;
+
+  //! Synaptic elements gathered by each thread during an update
+  std::vector< SynapticElements > thread_synaptic_elements_;
+
+  //! Synaptic elements of the local nodes during an update
+  SynapticElements pre_synaptic_elements_;
+  SynapticElements post_synaptic_elements_;
+
+  //! Sources and targets of the synapses to create or delete in the current update step
+  std::vector< size_t > sp_sources_;
+  std::vector< size_t > sp_targets_;
+
+  //! Whether synapses were deleted due to the loss of pre- and postsynaptic elements
+  bool pre_synapses_deleted_;
+  bool post_synapses_deleted_;
+
+  //! Exceptions raised by the threads during an update
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised_;
 };
 
 inline GrowthCurve*
@@ -229,6 +299,12 @@ SPManager::get_structural_plasticity_update_interval() const
   return structural_plasticity_update_interval_;
 }
 
+inline bool
+SPManager::has_sp_synapses() const
+{
+  return not sp_conn_builders_.empty();
+}
+
 } // namespace nest
 
 #endif /* #ifndef SP_MANAGER_H */
@@ -24,9 +24,14 @@
 #define SPIKE_DATA_H
 
 // C++ includes
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 
 // Includes from nestkernel:
+#include "nest_time.h"
 #include "nest_types.h"
 #include "target.h"
 
@@ -469,6 +474,186 @@ OffGridSpikeData::get_offset() const
 }
 
 
+/**
+ * Off-grid spike data with the offset as 32 bit fixed-point number.
+ *
+ * The offset is stored in units of resolution / ( 2^32 - 1 ), so that
+ * the offset of a spike is rounded by at most half of this unit, about
+ * 1.2e-11 ms for a resolution of 0.1 ms. Entries take 12 instead of the
+ * 16 bytes of OffGridSpikeData. To keep all accesses aligned in buffers
+ * of 4-byte aligned entries, the bits of the SpikeData part are kept in
+ * two unsigned ints and copied into a SpikeData to read or modify them.
+ */
+class CompactOffGridSpikeData
+{
+private:
+  static constexpr double MAX_OFFSET_UNITS = 4294967295.0; //!< largest value of offset_, 2^32 - 1
+
+  unsigned int spike_data_[ 2 ]; //!< bits of the SpikeData part
+  uint32_t offset_;              //!< offset in units of resolution / MAX_OFFSET_UNITS
+
+  SpikeData get_spike_data_() const;
+  void set_spike_data_( const SpikeData& spike_data );
+
+public:
+  CompactOffGridSpikeData();
+  CompactOffGridSpikeData& operator=( const SpikeData& rhs );
+  CompactOffGridSpikeData& operator=( const OffGridSpikeData& rhs );
+
+  size_t get_lcid() const;
+  void set_lcid( size_t );
+  unsigned int get_lag() const;
+  size_t get_tid() const;
+  synindex get_syn_id() const;
+  unsigned int get_marker() const;
+  void reset_marker();
+  void set_complete_marker();
+  void set_end_marker();
+  void set_invalid_marker();
+  bool is_complete_marker() const;
+  bool is_end_marker() const;
+  bool is_invalid_marker() const;
+  double get_offset() const;
+};
+
+//! check legal size
+using success_compact_offgrid_spike_data_size = StaticAssert< sizeof( CompactOffGridSpikeData ) == 12 >::success;
+
+inline CompactOffGridSpikeData::CompactOffGridSpikeData()
+  : offset_( 0 )
+{
+  set_spike_data_( SpikeData() );
+}
+
+inline SpikeData
+CompactOffGridSpikeData::get_spike_data_() const
+{
+  SpikeData spike_data;
+  std::memcpy( static_cast< void* >( &spike_data ), spike_data_, sizeof( SpikeData ) );
+  return spike_data;
+}
+
+inline void
+CompactOffGridSpikeData::set_spike_data_( const SpikeData& spike_data )
+{
+  std::memcpy( spike_data_, static_cast< const void* >( &spike_data ), sizeof( SpikeData ) );
+}
+
+inline CompactOffGridSpikeData&
+CompactOffGridSpikeData::operator=( const SpikeData& rhs )
+{
+  set_spike_data_( rhs );
+  offset_ = 0;
+  return *this;
+}
+
+inline CompactOffGridSpikeData&
+CompactOffGridSpikeData::operator=( const OffGridSpikeData& rhs )
+{
+  set_spike_data_( rhs );
+
+  const double resolution = Time::get_resolution().get_ms();
+  assert( rhs.get_offset() >= 0 and rhs.get_offset() <= resolution );
+  const double units = std::round( rhs.get_offset() / resolution * MAX_OFFSET_UNITS );
+  offset_ = static_cast< uint32_t >( std::min( units, MAX_OFFSET_UNITS ) );
+  return *this;
+}
+
+inline size_t
+CompactOffGridSpikeData::get_lcid() const
+{
+  return get_spike_data_().get_lcid();
+}
+
+inline void
+CompactOffGridSpikeData::set_lcid( size_t value )
+{
+  SpikeData spike_data = get_spike_data_();
+  spike_data.set_lcid( value );
+  set_spike_data_( spike_data );
+}
+
+inline unsigned int
+CompactOffGridSpikeData::get_lag() const
+{
+  return get_spike_data_().get_lag();
+}
+
+inline size_t
+CompactOffGridSpikeData::get_tid() const
+{
+  return get_spike_data_().get_tid();
+}
+
+inline synindex
+CompactOffGridSpikeData::get_syn_id() const
+{
+  return get_spike_data_().get_syn_id();
+}
+
+inline unsigned int
+CompactOffGridSpikeData::get_marker() const
+{
+  return get_spike_data_().get_marker();
+}
+
+inline void
+CompactOffGridSpikeData::reset_marker()
+{
+  SpikeData spike_data = get_spike_data_();
+  spike_data.reset_marker();
+  set_spike_data_( spike_data );
+}
+
+inline void
+CompactOffGridSpikeData::set_complete_marker()
+{
+  SpikeData spike_data = get_spike_data_();
+  spike_data.set_complete_marker();
+  set_spike_data_( spike_data );
+}
+
+inline void
+CompactOffGridSpikeData::set_end_marker()
+{
+  SpikeData spike_data = get_spike_data_();
+  spike_data.set_end_marker();
+  set_spike_data_( spike_data );
+}
+
+inline void
+CompactOffGridSpikeData::set_invalid_marker()
+{
+  SpikeData spike_data = get_spike_data_();
+  spike_data.set_invalid_marker();
+  set_spike_data_( spike_data );
+}
+
+inline bool
+CompactOffGridSpikeData::is_complete_marker() const
+{
+  return get_spike_data_().is_complete_marker();
+}
+
+inline bool
+CompactOffGridSpikeData::is_end_marker() const
+{
+  return get_spike_data_().is_end_marker();
+}
+
+inline bool
+CompactOffGridSpikeData::is_invalid_marker() const
+{
+  return get_spike_data_().is_invalid_marker();
+}
+
+inline double
+CompactOffGridSpikeData::get_offset() const
+{
+  // dividing first gives exactly the resolution for the largest offset
+  return offset_ / MAX_OFFSET_UNITS * Time::get_resolution().get_ms();
+}
+
 /**
  * Combine target rank and spike data information for storage in emitted_spikes_register.
  *
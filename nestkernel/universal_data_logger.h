@@ -32,6 +32,7 @@
 #include "nest_time.h"
 #include "nest_types.h"
 #include "recordables_map.h"
+#include "sample_block.h"
 
 namespace nest
 {
@@ -183,6 +184,11 @@ private:
     {
       return multimeter_;
     }
+    void
+    set_sample_slot( size_t slot )
+    {
+      sample_slot_ = slot;
+    }
     void handle( HostNode&, const DataLoggingRequest& );
     void record_data( const HostNode&, long );
     void reset();
@@ -212,6 +218,9 @@ private:
 
     //! Next buffer entry to write to, with read/write toggle
     std::vector< size_t > next_rec_;
+
+    SampleBlock* sample_block_; //!< Block of the multimeter into which samples are pushed, or nullptr
+    size_t sample_slot_;        //!< Slot of the host node in sample_block_
   };
 
   HostNode& host_; //!< node to which logger belongs
@@ -261,6 +270,12 @@ nest::UniversalDataLogger< HostNode >::connect_logging_device( const DataLogging
   // create one and push it
   data_loggers_.push_back( DataLogger_( req, rmap ) );
 
+  // multimeters that have samples pushed receive them in their own block
+  if ( req.get_sample_block() )
+  {
+    data_loggers_.back().set_sample_slot( req.get_sample_block()->add_target( host_.get_node_id() ) );
+  }
+
   // rport is index plus one, i.e., size
   return data_loggers_.size();
 }
@@ -278,6 +293,8 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::DataLogger_( const DataLoggi
   node_access_()
   , data_()
   , next_rec_( 2, 0 )
+  , sample_block_( req.get_sample_block() )
+  , sample_slot_( 0 )
 {
   const std::vector< Name >& recvars = req.record_from();
   for ( size_t j = 0; j < recvars.size(); ++j )
@@ -445,6 +462,11 @@ private:
     {
       return multimeter_;
     }
+    void
+    set_sample_slot( size_t slot )
+    {
+      sample_slot_ = slot;
+    }
     void handle( HostNode&, const DataLoggingRequest& );
     void record_data( const HostNode&, long );
     void reset();
@@ -474,6 +496,9 @@ private:
 
     //! Next buffer entry to write to, with read/write toggle
     std::vector< size_t > next_rec_;
+
+    SampleBlock* sample_block_; //!< Block of the multimeter into which samples are pushed, or nullptr
+    size_t sample_slot_;        //!< Slot of the host node in sample_block_
   };
 
   HostNode& host_; //!< node to which logger belongs
@@ -524,6 +549,12 @@ nest::DynamicUniversalDataLogger< HostNode >::connect_logging_device( const Data
   // create one and push it
   data_loggers_.push_back( DataLogger_( req, rmap ) );
 
+  // multimeters that have samples pushed receive them in their own block
+  if ( req.get_sample_block() )
+  {
+    data_loggers_.back().set_sample_slot( req.get_sample_block()->add_target( host_.get_node_id() ) );
+  }
+
   // rport is index plus one, i.e., size
   return data_loggers_.size();
 }
@@ -541,6 +572,8 @@ nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::DataLogger_( const Da
   node_access_()
   , data_()
   , next_rec_( 2, 0 )
+  , sample_block_( req.get_sample_block() )
+  , sample_slot_( 0 )
 {
   const std::vector< Name >& recvars = req.record_from();
   for ( size_t j = 0; j < recvars.size(); ++j )
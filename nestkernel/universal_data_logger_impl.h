@@ -131,7 +131,11 @@ nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::init()
   const long recs_per_slice = static_cast< long >(
     std::ceil( kernel().connection_manager.get_min_delay() / static_cast< double >( rec_int_steps_ ) ) );
 
-  data_.resize( 2, DataLoggingReply::Container( recs_per_slice, DataLoggingReply::Item( num_vars_ ) ) );
+  // pushed samples are written to the block of the multimeter instead
+  if ( not sample_block_ )
+  {
+    data_.resize( 2, DataLoggingReply::Container( recs_per_slice, DataLoggingReply::Item( num_vars_ ) ) );
+  }
 
   next_rec_.resize( 2 );               // just for safety's sake
   next_rec_[ 0 ] = next_rec_[ 1 ] = 0; // start at beginning of buffer
@@ -148,6 +152,20 @@ nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::record_data( const Ho
 
   const size_t wt = kernel().event_delivery_manager.write_toggle();
 
+  if ( sample_block_ )
+  {
+    // write to the row of this sampling step in the block of the multimeter
+    const long row = ( step - kernel().simulation_manager.get_slice_origin().get_steps() ) / rec_int_steps_;
+    double* const dest = sample_block_->get_values_for_writing( wt, row, sample_slot_, step + 1 );
+    for ( size_t j = 0; j < num_vars_; ++j )
+    {
+      dest[ j ] = ( *( node_access_[ j ] ) )();
+    }
+
+    next_rec_step_ += rec_int_steps_;
+    return;
+  }
+
   assert( wt < next_rec_.size() );
   assert( wt < data_.size() );
 
@@ -183,10 +201,10 @@ template < typename HostNode >
 void
 nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::handle( HostNode& host, const DataLoggingRequest& request )
 {
-  if ( num_vars_ < 1 )
+  if ( num_vars_ < 1 or sample_block_ )
   {
     return;
-  } // nothing to do
+  } // nothing to do, pushed samples are read by the multimeter
 
   // The following assertions will fire if the user forgot to call init()
   // on the data logger.
@@ -332,7 +350,11 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::init()
   const long recs_per_slice = static_cast< long >(
     std::ceil( kernel().connection_manager.get_min_delay() / static_cast< double >( rec_int_steps_ ) ) );
 
-  data_.resize( 2, DataLoggingReply::Container( recs_per_slice, DataLoggingReply::Item( num_vars_ ) ) );
+  // pushed samples are written to the block of the multimeter instead
+  if ( not sample_block_ )
+  {
+    data_.resize( 2, DataLoggingReply::Container( recs_per_slice, DataLoggingReply::Item( num_vars_ ) ) );
+  }
 
   next_rec_.resize( 2 );               // just for safety's sake
   next_rec_[ 0 ] = next_rec_[ 1 ] = 0; // start at beginning of buffer
@@ -349,6 +371,20 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::record_data( const HostNode&
 
   const size_t wt = kernel().event_delivery_manager.write_toggle();
 
+  if ( sample_block_ )
+  {
+    // write to the row of this sampling step in the block of the multimeter
+    const long row = ( step - kernel().simulation_manager.get_slice_origin().get_steps() ) / rec_int_steps_;
+    double* const dest = sample_block_->get_values_for_writing( wt, row, sample_slot_, step + 1 );
+    for ( size_t j = 0; j < num_vars_; ++j )
+    {
+      dest[ j ] = ( ( host ).*( node_access_[ j ] ) )();
+    }
+
+    next_rec_step_ += rec_int_steps_;
+    return;
+  }
+
   assert( wt < next_rec_.size() );
   assert( wt < data_.size() );
 
@@ -384,9 +420,9 @@ template < typename HostNode >
 void
 nest::UniversalDataLogger< HostNode >::DataLogger_::handle( HostNode& host, const DataLoggingRequest& request )
 {
-  if ( num_vars_ < 1 )
+  if ( num_vars_ < 1 or sample_block_ )
   {
-    // nothing to do
+    // nothing to do, pushed samples are read by the multimeter
     return;
   }
 
@@ -146,9 +146,13 @@ nest::VPManager::set_status( const DictionaryDatum& d )
     {
       errors.push_back( "Model defaults were modified" );
     }
-    if ( kernel().sp_manager.is_structural_plasticity_enabled() and n_threads > 1 )
+    if ( kernel().sp_manager.is_structural_plasticity_enabled() )
     {
-      errors.push_back( "Structural plasticity enabled: multithreading cannot be enabled" );
+      errors.push_back( "Structural plasticity enabled" );
+    }
+    if ( kernel().sp_manager.has_sp_synapses() )
+    {
+      errors.push_back( "Structural plasticity synapses have been set" );
     }
     if ( force_singlethreading_ and n_threads > 1 )
     {
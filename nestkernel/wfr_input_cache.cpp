@@ -0,0 +1,88 @@
+/*
+ *  wfr_input_cache.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "wfr_input_cache.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+
+// Includes from nestkernel:
+#include "event_delivery_manager_impl.h"
+#include "kernel_manager.h"
+#include "secondary_event.h"
+
+nest::WfrInputCache::WfrInputCache()
+  : valid_( false )
+  , sum_weights_( 0.0 )
+{
+}
+
+bool
+nest::WfrInputCache::unchanged( const std::vector< double >& input, const double sum_weights, const double tol ) const
+{
+  if ( not valid_ or sum_weights != sum_weights_ or input.size() != input_.size() )
+  {
+    return false;
+  }
+
+  const double max_change = tol * sum_weights;
+  for ( size_t i = 0; i < input.size(); ++i )
+  {
+    if ( std::abs( input[ i ] - input_[ i ] ) > max_change )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void
+nest::WfrInputCache::store( const std::vector< double >& input,
+  const double sum_weights,
+  const std::vector< double >& coefficients )
+{
+  valid_ = true;
+  sum_weights_ = sum_weights;
+  input_ = input;
+  coefficients_ = coefficients;
+}
+
+bool
+nest::WfrInputCache::resend_if_unchanged( Node& node, std::vector< double >& input, double& sum_weights )
+{
+  if ( not kernel().simulation_manager.get_wfr_skip_unchanged()
+    or not unchanged( input, sum_weights, kernel().simulation_manager.get_wfr_tol() ) )
+  {
+    return false;
+  }
+
+  GapJunctionEvent ge;
+  ge.set_coeffarray( coefficients_ );
+  kernel().event_delivery_manager.send_secondary( node, ge );
+
+  sum_weights = 0.0;
+  std::fill( input.begin(), input.end(), 0.0 );
+
+  kernel().simulation_manager.count_skipped_wfr_update( node.get_thread() );
+  return true;
+}
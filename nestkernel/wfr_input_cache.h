@@ -0,0 +1,107 @@
+/*
+ *  wfr_input_cache.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef WFR_INPUT_CACHE_H
+#define WFR_INPUT_CACHE_H
+
+// C++ includes:
+#include <vector>
+
+namespace nest
+{
+
+class Node;
+
+/**
+ * Gap junction input and output of the last waveform relaxation update of a node.
+ *
+ * A node that receives the same gap junction input as in its last
+ * waveform relaxation (wfr) update would compute the same interpolation
+ * coefficients again. Nodes therefore store their input and the
+ * coefficients they sent in each wfr update. In the next iteration, they
+ * only integrate their dynamics again if their input has changed by
+ * more than the wfr tolerance per unit of gap junction weight, which is
+ * the largest change caused by sources that have converged. Otherwise
+ * they send the stored coefficients and report convergence.
+ *
+ * As the input of a node changes as long as any of its sources has not
+ * converged, only the nodes depending on nodes that have not converged
+ * yet are updated in each iteration, while the iteration still ends
+ * only once all nodes have converged.
+ */
+class WfrInputCache
+{
+public:
+  WfrInputCache();
+
+  /**
+   * Forget the stored input, so that the node is updated in the next
+   * iteration. Called at the end of each interval.
+   */
+  void clear();
+
+  /**
+   * Return true if the node has been updated in the current interval and
+   * its input differs from the input of this update by at most tol
+   * times the summed gap junction weight.
+   */
+  bool unchanged( const std::vector< double >& input, const double sum_weights, const double tol ) const;
+
+  /**
+   * Send the stored coefficients again on behalf of node if its input is
+   * unchanged and skipping is enabled by the kernel parameter
+   * wfr_skip_unchanged.
+   *
+   * If the coefficients were sent, input and sum_weights are reset for
+   * the next iteration and true is returned, so that the node skips its
+   * wfr update and reports convergence.
+   */
+  bool resend_if_unchanged( Node& node, std::vector< double >& input, double& sum_weights );
+
+  //! Store the input of a wfr update and the coefficients sent in it
+  void store( const std::vector< double >& input, const double sum_weights, const std::vector< double >& coefficients );
+
+  //! Return the coefficients sent in the last wfr update
+  const std::vector< double >& get_coefficients() const;
+
+private:
+  bool valid_;                         //!< true if input and coefficients belong to the current interval
+  double sum_weights_;                 //!< summed gap junction weight of the stored input
+  std::vector< double > input_;        //!< summed interpolation coefficients received by the node
+  std::vector< double > coefficients_; //!< interpolation coefficients sent by the node
+};
+
+inline void
+WfrInputCache::clear()
+{
+  valid_ = false;
+}
+
+inline const std::vector< double >&
+WfrInputCache::get_coefficients() const
+{
+  return coefficients_;
+}
+
+} // namespace nest
+
+#endif /* #ifndef WFR_INPUT_CACHE_H */
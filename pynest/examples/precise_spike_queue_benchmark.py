@@ -0,0 +1,115 @@
+# -*- coding: utf-8 -*-
+#
+# precise_spike_queue_benchmark.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Benchmark of the input queue of precise spiking models
+------------------------------------------------------
+
+Neuron models with precise spike times, such as ``iaf_psc_exp_ps``,
+``iaf_psc_alpha_ps`` or ``parrot_neuron_ps``, keep their input spikes
+in a queue that returns them in temporal order during the update. For
+neurons receiving spikes at high rates, operations on this queue can
+dominate the time spent updating the neurons.
+
+This script measures the throughput of the queue. A population of
+``parrot_neuron_ps`` repeats Poisson spike trains of high rate
+generated by ``poisson_generator_ps``, and a population of
+``iaf_psc_exp_ps`` neurons receives all these spikes with a broad
+distribution of delays. The script reports the time spent in the
+simulation loop and the number of spikes delivered to the neurons per
+second of wall-clock time. Running the script with different versions
+of NEST compares their queue implementations.
+
+"""
+
+import time
+
+import nest
+
+###############################################################################
+# Parameter section. The number of input spikes per neuron and step is
+# ``num_parrots * rate * resolution / 1000``.
+
+
+params = {
+    "num_threads": 1,  # number of threads
+    "num_parrots": 100,  # number of spike trains
+    "num_neurons": 100,  # number of neurons receiving all spike trains
+    "rate": 2000.0,  # rate of each spike train in spikes/s
+    "resolution": 0.1,  # simulation resolution in ms
+    "min_delay": 1.0,  # smallest delay in ms
+    "max_delay": 10.0,  # largest delay in ms
+    "presimtime": 50.0,  # simulation time before measurement in ms
+    "simtime": 500.0,  # simulation time of the measurement in ms
+}
+
+
+###############################################################################
+# Build the network. The weights are small, so that the neurons spike
+# rarely and the time is dominated by the handling of input spikes.
+
+
+def build_network():
+    nest.ResetKernel()
+    nest.set_verbosity("M_WARNING")
+    nest.set(local_num_threads=params["num_threads"], resolution=params["resolution"])
+
+    generators = nest.Create("poisson_generator_ps", params["num_parrots"], params={"rate": params["rate"]})
+    parrots = nest.Create("parrot_neuron_ps", params["num_parrots"])
+    neurons = nest.Create("iaf_psc_exp_ps", params["num_neurons"])
+
+    nest.Connect(generators, parrots, "one_to_one", syn_spec={"delay": params["min_delay"]})
+    nest.Connect(
+        parrots,
+        neurons,
+        "all_to_all",
+        syn_spec={
+            "weight": 0.1,
+            "delay": nest.random.uniform(params["min_delay"], params["max_delay"]),
+        },
+    )
+
+    return neurons
+
+
+###############################################################################
+# Simulate and measure. The presimulation excludes the construction of
+# the buffers from the measurement.
+
+
+def run_benchmark():
+    build_network()
+    nest.Simulate(params["presimtime"])
+
+    tic = time.time()
+    nest.Simulate(params["simtime"])
+    wall_time = time.time() - tic
+
+    spikes_received = params["num_parrots"] * params["num_neurons"] * params["rate"] * params["simtime"] / 1000.0
+    time_simulate = nest.GetKernelStatus("time_simulate")
+
+    print(f"Wall-clock time of simulation: {wall_time:.3f} s")
+    print(f"Time in simulation loop:       {time_simulate:.3f} s")
+    print(f"Spikes received per second:    {spikes_received / wall_time:.3e}")
+
+
+if __name__ == "__main__":
+    run_benchmark()
@@ -97,6 +97,7 @@ class NestModule(types.ModuleType):
         _rel_import_star(self, ".lib.hl_api_models")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_nodes")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_parallel_computing")  # noqa: F821
+        _rel_import_star(self, ".lib.hl_api_recording")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_simulation")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_sonata")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_spatial")  # noqa: F821
@@ -183,6 +184,15 @@ class NestModule(types.ModuleType):
         ("Seed value used as base for seeding NEST random number generators " + r"(:math:`1 \leq s\leq 2^{32}-1`)"),
         default=143202461,
     )
+    connection_rng_keyed_by_target = KernelAttribute(
+        "bool",
+        (
+            "Whether random numbers for creating connections are drawn from streams"
+            + " keyed by seed and target node ID, so that the connectivity does not"
+            + " depend on the number of threads and MPI processes"
+        ),
+        default=False,
+    )
     total_num_virtual_procs = KernelAttribute("int", "The total number of virtual processes", default=1)
     local_num_threads = KernelAttribute("int", "The local number of threads", default=1)
     num_processes = KernelAttribute("int", "The number of MPI processes", readonly=True)
@@ -191,6 +201,15 @@ class NestModule(types.ModuleType):
         "Whether to transmit precise spike times in MPI communication",
         readonly=True,
     )
+    compress_off_grid_spikes = KernelAttribute(
+        "bool",
+        (
+            "Whether to transmit the offsets of precise spike times as 32 bit "
+            + "fixed-point numbers instead of doubles, with an error of at most "
+            + "resolution / (2 * (2**32 - 1))"
+        ),
+        default=False,
+    )
     adaptive_target_buffers = KernelAttribute(
         "bool",
         "Whether MPI buffers for communication of connections resize on the fly",
@@ -281,6 +300,28 @@ class NestModule(types.ModuleType):
     wfr_interpolation_order = KernelAttribute(
         "int", "Interpolation order of polynomial used in wfr iterations", default=3
     )
+    wfr_skip_unchanged = KernelAttribute(
+        "bool",
+        "Whether nodes whose gap junction input is unchanged skip their updates in wfr iterations",
+        default=False,
+    )
+    wfr_iterations = KernelAttribute(
+        "int", "Number of waveform relaxation iterations during the last simulation", readonly=True
+    )
+    wfr_intervals = KernelAttribute(
+        "int", "Number of intervals solved by waveform relaxation during the last simulation", readonly=True
+    )
+    wfr_updates = KernelAttribute(
+        "int", "Number of node updates in waveform relaxation iterations during the last simulation", readonly=True
+    )
+    wfr_skipped_updates = KernelAttribute(
+        "int",
+        "Number of node updates skipped in waveform relaxation iterations during the last simulation",
+        readonly=True,
+    )
+    time_wfr = KernelAttribute(
+        "float", "Time in seconds spent in waveform relaxation iterations during the last simulation", readonly=True
+    )
     max_num_syn_models = KernelAttribute("int", "Maximal number of synapse models supported", readonly=True)
     structural_plasticity_synapses = KernelAttribute(
         "dict",
@@ -315,12 +356,39 @@ class NestModule(types.ModuleType):
         ),
         default=True,
     )
+    use_rate_matrix = KernelAttribute(
+        "bool",
+        (
+            "Whether to deliver instantaneous rate connections as sparse"
+            + " matrix-vector products instead of one event per connection;"
+            + " targets that do not sum their inputs linearly always receive events."
+        ),
+        default=False,
+    )
     data_path = KernelAttribute(
         "str",
         "A path, where all data is written to, defaults to current directory",
     )
     data_prefix = KernelAttribute("str", "A common prefix for all data files")
     overwrite_files = KernelAttribute("bool", "Whether to overwrite existing data files", default=False)
+    io_buffer_size = KernelAttribute(
+        "int",
+        (
+            "Maximal number of bytes recording backends may hand to the I/O thread"
+            + " before waiting for data to be written to files"
+        ),
+        default=64 * 1024 * 1024,
+    )
+    io_bytes_written = KernelAttribute(
+        "int",
+        "Number of bytes written to files by the I/O thread since the last reset of the kernel",
+        readonly=True,
+    )
+    time_io_blocked = KernelAttribute(
+        "float",
+        "Time in seconds spent waiting for the I/O thread since the last reset of the kernel",
+        readonly=True,
+    )
     print_time = KernelAttribute(
         "bool",
         "Whether to print progress information during the simulation",
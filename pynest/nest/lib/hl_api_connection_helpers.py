@@ -29,11 +29,12 @@ import copy
 import numpy as np
 
 from .. import pynestkernel as kernel
-from ..ll_api import spp, sps, sr
+from ..ll_api import sps, sr
 from .hl_api_exceptions import NESTErrors
 from .hl_api_types import CollocatedSynapses, Mask, NodeCollection, Parameter
 
 __all__ = [
+    "_complete_specs",
     "_connect_layers_needed",
     "_connect_spatial",
     "_process_conn_spec",
@@ -42,12 +43,16 @@ __all__ = [
 ]
 
 
+# Defaults of the connectivity and synapse specifications, as in the options of the SLI command Connect
+_default_conn_spec = {"rule": "all_to_all"}
+_default_syn_spec = {"synapse_model": "static_synapse"}
+
+
 def _process_conn_spec(conn_spec):
     """Processes the connectivity specifications from None, string or dictionary to a dictionary."""
     if conn_spec is None:
         # Get default conn_spec
-        sr("/Connect /conn_spec GetOption")
-        return spp()
+        return dict(_default_conn_spec)
     elif isinstance(conn_spec, str):
         processed_conn_spec = {"rule": conn_spec}
         return processed_conn_spec
@@ -57,6 +62,25 @@ def _process_conn_spec(conn_spec):
         raise TypeError("conn_spec must be a string or dict")
 
 
+def _complete_specs(conn_spec, syn_spec):
+    """
+    Fills in the defaults for entries missing in the processed connectivity and synapse specifications.
+
+    Returns the connectivity specification dictionary and either a synapse specification dictionary
+    or, for collocated synapses, a list of them.
+    """
+    conn_spec = {**_default_conn_spec, **conn_spec}
+
+    if syn_spec is None:
+        syn_spec = dict(_default_syn_spec)
+    elif isinstance(syn_spec, CollocatedSynapses):
+        syn_spec = [{**_default_syn_spec, **spec} for spec in syn_spec.syn_specs]
+    else:
+        syn_spec = {**_default_syn_spec, **syn_spec}
+
+    return conn_spec, syn_spec
+
+
 def _process_syn_spec(syn_spec, conn_spec, prelength, postlength, use_connect_arrays):
     """Processes the synapse specifications from None, string or dictionary to a dictionary."""
     syn_spec = copy.copy(syn_spec)
@@ -26,8 +26,9 @@ Functions for connection handling
 import numpy
 
 from .. import pynestkernel as kernel
-from ..ll_api import check_stack, connect_arrays, spp, sps, sr
+from ..ll_api import check_stack, connect_arrays, connect_nodes, get_connections, sps, sr
 from .hl_api_connection_helpers import (
+    _complete_specs,
     _connect_layers_needed,
     _connect_spatial,
     _process_conn_spec,
@@ -102,10 +103,7 @@ def GetConnections(source=None, target=None, synapse_model=None, synapse_label=N
     if synapse_label is not None:
         params["synapse_label"] = synapse_label
 
-    sps(params)
-    sr("GetConnections")
-
-    conns = spp()
+    conns = get_connections(params)
 
     if isinstance(conns, tuple):
         conns = SynapseCollection(None)
@@ -261,9 +259,6 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, return_synapsecollection=F
 
         return
 
-    sps(pre)
-    sps(post)
-
     if not isinstance(pre, NodeCollection):
         raise TypeError("Not implemented, presynaptic nodes must be a NodeCollection")
     if not isinstance(post, NodeCollection):
@@ -281,12 +276,11 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, return_synapsecollection=F
         spatial_projections = _process_spatial_projections(processed_conn_spec, processed_syn_spec)
 
         # Connect using ConnectLayers
+        sps(pre)
+        sps(post)
         _connect_spatial(pre, post, spatial_projections)
     else:
-        sps(processed_conn_spec)
-        if processed_syn_spec is not None:
-            sps(processed_syn_spec)
-        sr("Connect")
+        connect_nodes(pre._datum, post._datum, *_complete_specs(processed_conn_spec, processed_syn_spec))
 
     if return_synapsecollection:
         return GetConnections(pre, post)
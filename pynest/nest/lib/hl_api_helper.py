@@ -33,13 +33,14 @@ import warnings
 from string import Template
 
 from .. import pynestkernel as kernel
-from ..ll_api import sli_func, spp, sps, sr
+from ..ll_api import get_node_collection_status, sli_func, spp, sr
 
 __all__ = [
     "broadcast",
     "deprecated",
     "get_parameters",
     "get_parameters_hierarchical_addressing",
+    "get_status_values",
     "get_wrapped_text",
     "is_iterable",
     "is_literal",
@@ -496,6 +497,37 @@ def restructure_data(result, keys):
     return final_result
 
 
+def get_status_values(statuses, keys):
+    """
+    Select values from status dictionaries.
+
+    Missing keys raise the same error as the SLI function ``get``.
+
+    Parameters
+    ----------
+    statuses: tuple
+        status dictionaries of nodes or connections
+    keys: string or list of strings
+        name(s) of properties
+
+    Returns
+    -------
+    tuple:
+        the value for each dictionary if keys is a string, otherwise a tuple
+        with the values of all keys for each dictionary
+    """
+
+    def get_value(status, key):
+        try:
+            return status[key]
+        except KeyError:
+            raise kernel.NESTErrors.DictError("get_d", ": Key '/{}' does not exist in dictionary.".format(key)) from None
+
+    if is_literal(keys):
+        return tuple(get_value(status, keys) for status in statuses)
+    return tuple(tuple(get_value(status, key) for key in keys) for status in statuses)
+
+
 def get_parameters(nc, param):
     """
     Get parameters from nodes.
@@ -518,13 +550,14 @@ def get_parameters(nc, param):
     """
     # param is single literal
     if is_literal(param):
-        cmd = "/{} get".format(param)
-        sps(nc._datum)
-        try:
-            sr(cmd)
-            result = spp()
-        except kernel.NESTError:
-            result = nc.get()[param]  # If the NodeCollection is a composite.
+        statuses = get_node_collection_status(nc._datum)
+        if len(statuses) == 1:
+            result = statuses[0][param]
+        elif any(param in status for status in statuses):
+            # In a composite NodeCollection, nodes without the parameter get None.
+            result = tuple(status.get(param) for status in statuses)
+        else:
+            raise KeyError(param)
     # param is array of strings
     elif is_iterable(param):
         result = {param_name: nc.get(param_name) for param_name in param}
@@ -29,9 +29,18 @@ import webbrowser
 
 import nest
 
-from ..ll_api import check_stack, sli_func, spp, sps, sr
+from ..ll_api import (
+    check_stack,
+    get_connection_status,
+    get_node_collection_status,
+    sli_func,
+    spp,
+    sps,
+    sr,
+)
 from .hl_api_helper import (
     broadcast,
+    get_status_values,
     is_iterable,
     is_literal,
     load_help,
@@ -421,26 +430,16 @@ def GetStatus(nodes, keys=None, output=""):
     if len(nodes) == 0:
         return "[]" if output == "json" else ()
 
-    if keys is None:
-        cmd = "GetStatus"
-    elif is_literal(keys):
-        cmd = "GetStatus {{ /{0} get }} Map".format(keys)
-    elif is_iterable(keys):
-        keys_str = " ".join("/{0}".format(x) for x in keys)
-        cmd = "GetStatus {{ [ [ {0} ] ] get }} Map".format(keys_str)
-    else:
+    if not (keys is None or is_literal(keys) or is_iterable(keys)):
         raise TypeError("keys should be either a string or an iterable")
 
-    sps(nodes)
-
-    sr(cmd)
-
-    result = spp()
+    if isinstance(nodes, nest.NodeCollection):
+        result = get_node_collection_status(nodes._datum)
+    else:
+        result = get_connection_status(nodes._datum)
 
-    if isinstance(result, dict):
-        # We have taken GetStatus on a layer object, or another NodeCollection with metadata, which returns a
-        # dictionary from C++, so we need to turn it into a tuple for consistency.
-        result = (result,)
+    if keys is not None:
+        result = get_status_values(result, keys)
 
     if output == "json":
         result = to_json(result)
@@ -28,7 +28,7 @@ import warnings
 import nest
 
 from .. import pynestkernel as kernel
-from ..ll_api import check_stack, sli_func, spp, sps, sr
+from ..ll_api import check_stack, create_nodes, sli_func, spp, sps, sr
 from .hl_api_helper import is_iterable, model_deprecation_warning
 from .hl_api_info import SetStatus
 from .hl_api_types import NodeCollection, Parameter
@@ -93,7 +93,7 @@ def Create(model, n=1, params=None, positions=None):
 
     # If any of the elements in the parameter dictionary is either an array-like object,
     # or a NEST parameter, we create the nodes first, then set the given values. If not,
-    # we can pass the parameter specification to SLI when the nodes are created.
+    # we can pass the parameter specification to the kernel when the nodes are created.
     iterable_or_parameter_in_params = True
     if isinstance(params, dict) and params:  # if params is a dict and not empty
         iterable_or_parameter_in_params = any(is_iterable(v) or isinstance(v, Parameter) for k, v in params.items())
@@ -133,16 +133,11 @@ def Create(model, n=1, params=None, positions=None):
             node_ids = sli_func("CreateLayerParams", layer_specs, {})
     else:
         # Nodes without positions
-        if not iterable_or_parameter_in_params:
-            cmd = "/%s 3 1 roll exch Create" % model
-            sps(params)
+        if isinstance(n, dict):
+            # a dictionary given instead of n holds the parameters of a single node
+            node_ids = create_nodes(str(model), 1, n)
         else:
-            cmd = "/%s exch Create" % model
-
-        sps(n)
-        sr(cmd)
-
-        node_ids = spp()
+            node_ids = create_nodes(str(model), n, params if not iterable_or_parameter_in_params else {})
 
     if params is not None and iterable_or_parameter_in_params:
         try:
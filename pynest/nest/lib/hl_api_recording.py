@@ -0,0 +1,379 @@
+# -*- coding: utf-8 -*-
+#
+# hl_api_recording.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Functions for reading data written by recording backends
+"""
+
+import struct
+from multiprocessing import resource_tracker, shared_memory
+
+import numpy as np
+
+from ..ll_api import get_events_since
+from .hl_api_models import GetDefaults
+from .hl_api_parallel_computing import Rank
+from .hl_api_types import NodeCollection
+
+__all__ = [
+    "GetEventsSince",
+    "ReadBinaryRecording",
+    "ShmStreamReader",
+]
+
+_BINARY_MAGIC = b"NESTBIN\0"
+_BINARY_BYTE_ORDER_MARK = 0x01020304
+
+
+def GetEventsSince(recorder, cursor=None):
+    """Return the events a recording device has recorded since an earlier call.
+
+    Unlike reading the ``events`` property of the device, only the
+    events recorded after the position given by `cursor` are copied, so
+    that recorded data can be monitored cheaply during long simulations,
+    e.g., between calls to :py:func:`.Run`. The events are not removed
+    from memory. Only devices recording to the `memory` backend keep
+    their events.
+
+    Parameters
+    ----------
+    recorder : NodeCollection or int
+        A single recording device
+    cursor : tuple of int, optional
+        The cursor returned by the previous call for the same device. If
+        it is not given, all events kept in memory are returned.
+
+    Returns
+    -------
+    dict:
+        Dictionary of NumPy arrays in the same format as the ``events``
+        property of the device
+    tuple:
+        Cursor to pass to the next call
+
+    Raises
+    ------
+    NESTError
+        If the node is not a recording device, its backend does not keep
+        events or the cursor does not belong to the current kernel.
+    """
+
+    if isinstance(recorder, NodeCollection):
+        if len(recorder) != 1:
+            raise TypeError("GetEventsSince() expects a single recording device.")
+        recorder = recorder.global_id
+
+    result = get_events_since(recorder, [] if cursor is None else list(cursor))
+
+    return result["events"], tuple(int(position) for position in result["cursor"])
+
+
+def ReadBinaryRecording(filenames):
+    """Read files written by the `binary` recording backend.
+
+    Parameters
+    ----------
+    filenames : str or list of str
+        Name of a single file or names of several files, e.g., the
+        ``filenames`` property of a recording device. The data of all
+        files is concatenated.
+
+    Returns
+    -------
+    dict:
+        Dictionary of NumPy arrays with the keys ``senders``,
+        ``time_step``, ``time_offset`` and ``times`` (in ms), and one
+        entry for each recorded value.
+
+    Raises
+    ------
+    ValueError
+        If a file is not a valid file written by the `binary` backend
+        or files with different columns are combined.
+    """
+
+    if isinstance(filenames, str):
+        filenames = [filenames]
+
+    columns = None
+    resolution = None
+    for filename in filenames:
+        file_resolution, file_columns = _read_binary_file(filename)
+        if columns is None:
+            columns = {name: [values] for name, values in file_columns.items()}
+            resolution = file_resolution
+        elif columns.keys() != file_columns.keys() or resolution != file_resolution:
+            raise ValueError(f"File '{filename}' does not contain the same columns as the other files.")
+        else:
+            for name, values in file_columns.items():
+                columns[name].append(values)
+
+    if columns is None:
+        return {}
+
+    result = {name: np.concatenate(values) for name, values in columns.items()}
+    result["times"] = result["time_step"] * resolution - result["time_offset"]
+
+    return result
+
+
+def _read_binary_file(filename):
+    """Read the header and all chunks of a single file.
+
+    Returns the simulation resolution and a dictionary mapping column
+    names to lists of NumPy arrays, one per chunk.
+    """
+
+    with open(filename, "rb") as f:
+        data = f.read()
+
+    if data[:8] != _BINARY_MAGIC:
+        raise ValueError(f"File '{filename}' was not written by the binary recording backend.")
+
+    byte_order = "<"
+    if struct.unpack_from("<I", data, 12)[0] != _BINARY_BYTE_ORDER_MARK:
+        byte_order = ">"
+    _version, _bom, n_double, n_long = struct.unpack_from(byte_order + "4I", data, 8)
+    (resolution,) = struct.unpack_from(byte_order + "d", data, 24)
+
+    pos = 32
+    value_names = []
+    for _ in range(n_double + n_long):
+        (length,) = struct.unpack_from(byte_order + "I", data, pos)
+        pos += 4
+        value_names.append(data[pos : pos + length].decode())
+        pos += length
+
+    int64 = np.dtype(byte_order + "i8")
+    float64 = np.dtype(byte_order + "f8")
+    column_types = [("senders", int64), ("time_step", int64), ("time_offset", float64)]
+    column_types += [(name, float64) for name in value_names[:n_double]]
+    column_types += [(name, int64) for name in value_names[n_double:]]
+
+    columns = {name: [np.empty(0, dtype=dtype)] for name, dtype in column_types}
+    while pos < len(data):
+        (n_rows,) = struct.unpack_from(byte_order + "Q", data, pos)
+        pos += 8
+        for name, dtype in column_types:
+            columns[name].append(np.frombuffer(data, dtype=dtype, count=n_rows, offset=pos))
+            pos += n_rows * dtype.itemsize
+
+    return resolution, {name: np.concatenate(chunks) for name, chunks in columns.items()}
+
+
+# Layout of segments written by the shm recording backend, see shm_stream.h
+_SHM_MAGIC = b"NESTSHM\0"
+_SHM_VERSION = 1
+_SHM_HEADER = struct.Struct("=8sIIQQdIIQ8x")
+_SHM_RING_SIZE = 192
+_SHM_RECORD = struct.Struct("=II")
+_SHM_DEVICE = struct.Struct("=IIqII")
+_SHM_EVENT = struct.Struct("=IIqqqdII")
+_SHM_SAMPLES = struct.Struct("=IIqqII")
+_SHM_PADDING, _SHM_DEVICE_RECORD, _SHM_EVENT_RECORD, _SHM_SAMPLES_RECORD = range(4)
+
+
+class ShmStreamReader:
+    """Read data streamed by the `shm` recording backend.
+
+    The reader consumes the records in the shared memory segment of one
+    MPI process, which frees the space of the records for new data. Only
+    a single reader must be attached to a segment at any time. The reader
+    can run in another process than the simulation.
+
+    Parameters
+    ----------
+    name : str, optional
+        Name of the segment, e.g., ``"/nest_stream-0"``. By default, the
+        segment of the calling MPI process as given by the
+        ``segment_name`` property of the backend is used.
+
+    Raises
+    ------
+    FileNotFoundError
+        If the segment does not exist.
+    ValueError
+        If the segment was not written by the `shm` backend.
+    """
+
+    def __init__(self, name=None):
+        if name is None:
+            name = f"{GetDefaults('shm', 'segment_name')}-{Rank()}"
+
+        try:
+            self._shm = shared_memory.SharedMemory(name=name.lstrip("/"), track=False)
+        except TypeError:
+            # before Python 3.13, attaching registers the segment for removal at exit
+            self._shm = shared_memory.SharedMemory(name=name.lstrip("/"))
+            resource_tracker.unregister(self._shm._name, "shared_memory")
+
+        self._buf = self._shm.buf
+        magic, version, self._num_rings, self._ring_size, self._data_start, self._resolution, *_ = (
+            _SHM_HEADER.unpack_from(self._buf, 0)
+        )
+        if magic != _SHM_MAGIC or version != _SHM_VERSION:
+            self.close()
+            raise ValueError(f"Shared memory segment '{name}' was not written by the shm recording backend.")
+
+        self._devices = {}
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def close(self):
+        """Detach from the segment."""
+
+        if self._shm is not None:
+            self._buf.release()
+            self._shm.close()
+            self._shm = None
+
+    @property
+    def running(self):
+        """Whether a simulation is currently prepared."""
+
+        return bool(_SHM_HEADER.unpack_from(self._buf, 0)[-1])
+
+    @property
+    def dropped(self):
+        """Number of records the simulation has dropped because a ring buffer was full."""
+
+        return sum(self._ring_position(ring, 2) for ring in range(self._num_rings))
+
+    @property
+    def devices(self):
+        """Dictionary mapping the node IDs of all devices described so far to their labels."""
+
+        return {device: label for device, (label, _, _) in self._devices.items()}
+
+    def read(self):
+        """Consume all records that are available.
+
+        Returns
+        -------
+        dict:
+            Dictionary mapping the node IDs of recording devices to
+            dictionaries of NumPy arrays with the keys ``senders`` and
+            ``times`` (in ms) and one entry for each recorded value.
+            Only devices with new data are contained.
+        """
+
+        chunks = {}
+        for ring in range(self._num_rings):
+            self._read_ring(ring, chunks)
+
+        events = {}
+        for device, device_chunks in chunks.items():
+            _, double_names, long_names = self._devices.get(device, ("", [], []))
+            columns = {"senders": [], "times": []}
+            columns.update({name: [] for name in double_names + long_names})
+            for chunk in device_chunks:
+                for name, values in chunk.items():
+                    columns.setdefault(name, []).append(values)
+            events[device] = {name: np.concatenate(values) for name, values in columns.items() if values}
+
+        return events
+
+    def _ring_position(self, ring, field):
+        """Return the write position (0), read position (1) or drop count (2) of a ring."""
+
+        return struct.unpack_from("=Q", self._buf, _SHM_HEADER.size + ring * _SHM_RING_SIZE + field * 64)[0]
+
+    def _event_dtype(self, device, size):
+        """Return the structured type of event records of the given size written for a device."""
+
+        _, double_names, long_names = self._devices.get(device, ("", [], []))
+        fields = {
+            "names": ["size", "type", "device", "sender", "step", "offset"],
+            "formats": ["=u4", "=u4", "=i8", "=i8", "=i8", "=f8"],
+            "offsets": [0, 4, 8, 16, 24, 32],
+            "itemsize": size,
+        }
+        if double_names:
+            fields["names"].append("doubles")
+            fields["formats"].append(("=f8", (len(double_names),)))
+            fields["offsets"].append(_SHM_EVENT.size)
+        if long_names:
+            fields["names"].append("longs")
+            fields["formats"].append(("=i8", (len(long_names),)))
+            fields["offsets"].append(_SHM_EVENT.size + 8 * len(double_names))
+        return np.dtype(fields)
+
+    def _read_ring(self, ring, chunks):
+        """Parse the available records of a ring into chunks of columns per device."""
+
+        control = _SHM_HEADER.size + ring * _SHM_RING_SIZE
+        write_pos = self._ring_position(ring, 0)
+        read_pos = self._ring_position(ring, 1)
+        data = self._data_start + ring * self._ring_size
+        buf = self._buf
+
+        while read_pos != write_pos:
+            offset = data + (read_pos & (self._ring_size - 1))
+            size, record_type = _SHM_RECORD.unpack_from(buf, offset)
+
+            if record_type == _SHM_DEVICE_RECORD:
+                _, _, device, n_double, n_long = _SHM_DEVICE.unpack_from(buf, offset)
+                start = offset + _SHM_DEVICE.size
+                names = bytes(buf[start : offset + size]).split(b"\0")[: 1 + n_double + n_long]
+                names = [name.decode() for name in names]
+                self._devices[device] = (names[0], names[1 : 1 + n_double], names[1 + n_double :])
+
+            elif record_type == _SHM_EVENT_RECORD:
+                # parse the run of event records of the same device that starts here at once
+                device = _SHM_EVENT.unpack_from(buf, offset)[2]
+                available = min(write_pos - read_pos, self._ring_size - (read_pos & (self._ring_size - 1)))
+                dtype = self._event_dtype(device, size)
+                records = np.frombuffer(buf, dtype=dtype, count=available // size, offset=offset)
+                in_run = records["size"] == size
+                in_run &= records["type"] == _SHM_EVENT_RECORD
+                in_run &= records["device"] == device
+                n_records = len(records) if in_run.all() else int(np.argmin(in_run))
+                records = records[:n_records]
+
+                times = records["step"] * self._resolution - records["offset"]
+                chunk = {"senders": records["sender"].copy(), "times": times}
+                _, double_names, long_names = self._devices.get(device, ("", [], []))
+                chunk.update((name, records["doubles"][:, i].copy()) for i, name in enumerate(double_names))
+                chunk.update((name, records["longs"][:, i].copy()) for i, name in enumerate(long_names))
+                chunks.setdefault(device, []).append(chunk)
+
+                read_pos += n_records * size
+                continue
+
+            elif record_type == _SHM_SAMPLES_RECORD:
+                _, _, device, step, n_senders, n_values = _SHM_SAMPLES.unpack_from(buf, offset)
+                start = offset + _SHM_SAMPLES.size
+                senders = np.frombuffer(buf, dtype=np.int64, count=n_senders, offset=start).copy()
+                values = np.frombuffer(buf, dtype=np.float64, count=n_senders * n_values, offset=start + 8 * n_senders)
+                values = values.reshape(n_senders, n_values)
+                chunk = {"senders": senders, "times": np.full(n_senders, step * self._resolution)}
+                _, double_names, _ = self._devices.get(device, ("", [], []))
+                chunk.update((name, values[:, i].copy()) for i, name in enumerate(double_names))
+                chunks.setdefault(device, []).append(chunk)
+
+            read_pos += size
+
+        # release the space of all records read at once
+        struct.pack_into("=Q", buf, control + 64, read_pos)
@@ -26,7 +26,16 @@ Functions for simulation control
 import warnings
 from contextlib import contextmanager
 
-from ..ll_api import check_stack, spp, sps, sr
+from ..ll_api import (
+    check_stack,
+    cleanup,
+    get_kernel_status,
+    prepare,
+    run_simulation,
+    set_kernel_status,
+    simulate,
+    sr,
+)
 from .hl_api_helper import is_iterable, is_literal
 
 __all__ = [
@@ -61,8 +70,7 @@ def Simulate(t):
 
     """
 
-    sps(float(t))
-    sr("ms Simulate")
+    simulate(float(t))
 
 
 @check_stack
@@ -100,8 +108,7 @@ def Run(t):
 
     """
 
-    sps(float(t))
-    sr("ms Run")
+    run_simulation(float(t))
 
 
 @check_stack
@@ -119,7 +126,7 @@ def Prepare():
 
     """
 
-    sr("Prepare")
+    prepare()
 
 
 @check_stack
@@ -136,7 +143,7 @@ def Cleanup():
     Run, Prepare, Simulate, RunManager
 
     """
-    sr("Cleanup")
+    cleanup()
 
 
 @contextmanager
@@ -248,8 +255,7 @@ def SetKernelStatus(params):
                 warnings.warn(msg + f" \n`{key}` has been ignored")
                 del params[key]
 
-    sps(params)
-    sr("SetKernelStatus")
+    set_kernel_status(params)
 
 
 @check_stack
@@ -288,8 +294,7 @@ def GetKernelStatus(keys=None):
 
     """
 
-    sr("GetKernelStatus")
-    status_root = spp()
+    status_root = get_kernel_status()
 
     if keys is None:
         return status_root
@@ -30,11 +30,23 @@ from math import floor, log
 import numpy
 
 from .. import pynestkernel as kernel
-from ..ll_api import sli_func, spp, sps, sr, take_array_index
+from ..ll_api import (
+    get_connection_status,
+    get_node_collection_status,
+    get_values,
+    set_node_collection_status,
+    set_values,
+    sli_func,
+    spp,
+    sps,
+    sr,
+    take_array_index,
+)
 from .hl_api_helper import (
     broadcast,
     get_parameters,
     get_parameters_hierarchical_addressing,
+    get_status_values,
     is_iterable,
     is_literal,
     restructure_data,
@@ -399,7 +411,13 @@ class NodeCollection:
 
         if len(params) == 0:
             # get() is called without arguments
-            result = sli_func("get", self._datum)
+            statuses = get_node_collection_status(self._datum)
+            if len(statuses) == 1:
+                result = statuses[0]
+            else:
+                # In a composite NodeCollection, nodes without a parameter get None.
+                keys = dict.fromkeys(key for status in statuses for key in status)
+                result = {key: tuple(status.get(key) for status in statuses) for key in keys}
         elif len(params) == 1:
             # params is a tuple with a string or list of strings
             result = get_parameters(self, params[0])
@@ -504,7 +522,72 @@ class NodeCollection:
         if isinstance(params, (list, tuple)) and self.__len__() != len(params):
             raise TypeError("status dict must be a dict, or a list of dicts of length {} ".format(self.__len__()))
 
-        sli_func("SetStatus", self._datum, params)
+        if isinstance(params, (dict, list, tuple)):
+            set_node_collection_status(self._datum, params)
+        else:
+            sli_func("SetStatus", self._datum, params)
+
+    def get_array(self, keys, dtype=float):
+        """
+        Get numeric parameters of all nodes as NumPy array.
+
+        In contrast to :py:meth:`get`, the values are written directly into
+        the returned array by the kernel, without creating a status
+        dictionary for every node. This is considerably faster for large
+        `NodeCollections`.
+
+        Parameters
+        ----------
+        keys : str or list of str
+            Name of the parameter or state variable, or list of names
+        dtype : {float, int}, optional
+            Type of the returned array. Integer and Boolean parameters
+            are converted to this type.
+
+        Returns
+        -------
+        numpy.ndarray:
+            Array with one entry per node for a single key, or with one
+            row per key for a list of keys. In MPI-parallel simulations,
+            entries of nodes on other processes are NaN for floating
+            point types and 0 for integer types.
+
+        Raises
+        ------
+        KeyError
+            If the specified parameter does not exist for the nodes.
+
+        See Also
+        --------
+        :py:func:`get`,
+        :py:func:`set_array`
+        """
+
+        return get_values(self._datum, len(self), keys, dtype)
+
+    def set_array(self, keys, values):
+        """
+        Set numeric parameters of all nodes from a NumPy array.
+
+        In contrast to :py:meth:`set`, the values are passed to the kernel
+        directly, without creating a parameter dictionary for every node.
+
+        Parameters
+        ----------
+        keys : str or list of str
+            Name of the parameter or state variable, or list of names
+        values : numpy.ndarray
+            Array of floating point or integer values with one entry per
+            node for a single key, or with one row per key for a list of
+            keys
+
+        See Also
+        --------
+        :py:func:`set`,
+        :py:func:`get_array`
+        """
+
+        set_values(self._datum, len(self), keys, numpy.asarray(values))
 
     def tolist(self):
         """
@@ -871,20 +954,13 @@ class SynapseCollection:
             # Return empty tuple if get is called with an argument
             return {} if keys is None else ()
 
-        if keys is None:
-            cmd = "GetStatus"
-        elif is_literal(keys):
-            #  Extracting the correct values will be done in restructure_data below
-            cmd = "GetStatus"
-        elif is_iterable(keys):
-            keys_str = " ".join("/{0}".format(x) for x in keys)
-            cmd = "GetStatus {{ [ [ {0} ] ] get }} Map".format(keys_str)
-        else:
+        if not (keys is None or is_literal(keys) or is_iterable(keys)):
             raise TypeError("keys should be either a string or an iterable")
 
-        sps(self._datum)
-        sr(cmd)
-        result = spp()
+        result = get_connection_status(self._datum)
+        if is_iterable(keys) and not is_literal(keys):
+            # Values of a single key are extracted in restructure_data below
+            result = get_status_values(result, keys)
 
         # Need to restructure the data.
         final_result = restructure_data(result, keys)
@@ -54,10 +54,25 @@ from . import pynestkernel as kernel  # noqa pylint: disable=no-name-in-module
 
 __all__ = [
     "check_stack",
+    "cleanup",
     "connect_arrays",
+    "connect_nodes",
+    "create_nodes",
     "set_communicator",
+    "get_connection_status",
+    "get_connections",
     "get_debug",
+    "get_events_since",
+    "get_kernel_status",
+    "get_node_collection_status",
+    "get_values",
+    "prepare",
+    "run_simulation",
     "set_debug",
+    "set_kernel_status",
+    "set_node_collection_status",
+    "set_values",
+    "simulate",
     "sli_func",
     "sli_pop",
     "sli_push",
@@ -76,6 +91,23 @@ sli_push = sps = engine.push
 sli_pop = spp = engine.pop
 take_array_index = engine.take_array_index
 connect_arrays = engine.connect_arrays
+get_values = engine.get_values
+set_values = engine.set_values
+
+# Direct calls to the kernel, bypassing the SLI interpreter
+simulate = engine.simulate
+prepare = engine.prepare
+run_simulation = engine.run_simulation
+cleanup = engine.cleanup
+set_kernel_status = engine.set_kernel_status
+get_kernel_status = engine.get_kernel_status
+set_node_collection_status = engine.set_node_collection_status
+create_nodes = engine.create
+connect_nodes = engine.connect
+get_connections = engine.get_connections
+get_node_collection_status = engine.get_node_collection_status
+get_connection_status = engine.get_connection_status
+get_events_since = engine.get_events_since
 
 
 def catching_sli_run(cmd):
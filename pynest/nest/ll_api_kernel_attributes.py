@@ -19,7 +19,7 @@
 # You should have received a copy of the GNU General Public License
 # along with NEST.  If not, see <http://www.gnu.org/licenses/>.
 
-from .ll_api import spp, sps, sr, stack_checker
+from .ll_api import get_kernel_status, set_kernel_status, stack_checker
 
 
 class KernelAttribute:
@@ -52,8 +52,7 @@ class KernelAttribute:
         if instance is None:
             return self
 
-        sr("GetKernelStatus")
-        status_root = spp()
+        status_root = get_kernel_status()
 
         if self._full_status:
             return status_root
@@ -65,5 +64,4 @@ class KernelAttribute:
         if self._readonly:
             msg = f"`{self._name}` is a read only kernel attribute."
             raise AttributeError(msg)
-        sps({self._name: value})
-        sr("SetKernelStatus")
+        set_kernel_status({self._name: value})
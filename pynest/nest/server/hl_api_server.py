@@ -24,7 +24,9 @@ import importlib
 import inspect
 import io
 import logging
+import math
 import os
+import struct
 import sys
 import time
 import traceback
@@ -32,6 +34,7 @@ from copy import deepcopy
 
 import flask
 import nest
+import numpy as np
 import RestrictedPython
 from flask import Flask, jsonify, request
 from flask.logging import default_handler
@@ -311,6 +314,50 @@ def route_api_call(call):
     return jsonify(response)
 
 
+@app.route("/stream", methods=["GET", "POST"])
+def route_stream():
+    """Route to simulate and stream the new events of recording devices.
+
+    The simulation runs for ``t`` ms in steps of ``interval`` ms
+    (default: 10 ms). After each step, the events recorded since the
+    previous step by each device in ``recorders`` are sent as one frame
+    in the binary format described in encode_events(). All devices must
+    record to the `memory` backend. Events recorded before the request
+    are not sent.
+    """
+
+    if mpi_comm is not None:
+        flask.abort(400, "The route `/stream` is not available when NEST Server runs with MPI.")
+
+    args, kwargs = get_arguments(request)
+    try:
+        t = float(kwargs["t"])
+        interval = float(kwargs.get("interval", 10.0))
+        recorders = kwargs["recorders"]
+        if isinstance(recorders, str):
+            recorders = recorders.split(",")
+        recorders = [int(recorder) for recorder in recorders]
+    except (KeyError, TypeError, ValueError):
+        raise ErrorHandler("The route `/stream` requires the simulation time `t` and a list of `recorders`.")
+    if t <= 0.0 or interval <= 0.0:
+        raise ErrorHandler("The simulation time `t` and the `interval` must be positive.")
+
+    # start from the current end of the recorded events, which also
+    # checks that all recorders keep their events
+    cursors = {}
+    for recorder in recorders:
+        try:
+            _, cursors[recorder] = nest.GetEventsSince(recorder)
+        except NESTError as err:
+            raise ErrorHandler(f"{err.errorname} (NESTError): {err.errormessage}")
+
+    log("route_stream", f"t={t}, interval={interval}, recorders={recorders}")
+    return flask.Response(
+        flask.stream_with_context(stream_events(t, interval, recorders, cursors)),
+        mimetype="application/octet-stream",
+    )
+
+
 # ----------------------
 # Helpers for the server
 # ----------------------
@@ -532,6 +579,51 @@ def api_client(call_name, args, kwargs):
     return nest.serialize_data(response)
 
 
+def stream_events(t, interval, recorders, cursors):
+    """Simulate for t ms and yield the new events of all recorders after every interval."""
+
+    n_steps = max(1, math.ceil(t / interval - 1e-9))
+    with nest.RunManager():
+        for step in range(n_steps):
+            nest.Run(min(interval, t - step * interval))
+            time_ = nest.biological_time
+            for recorder in recorders:
+                events, cursors[recorder] = nest.GetEventsSince(recorder, cursors[recorder])
+                yield encode_events(recorder, time_, events)
+
+
+def encode_events(recorder, time_, events):
+    """Encode the events of a recorder as a frame in a compact binary format.
+
+    All numbers are little-endian. A frame consists of
+
+    1. the number of bytes that follow in the frame as 32 bit unsigned integer,
+    2. the node ID of the recorder as 64 bit integer,
+    3. the simulation time in ms at which the frame was sent as 64 bit floating point number,
+    4. the number of events as 32 bit unsigned integer,
+    5. the number of columns as 32 bit unsigned integer,
+    6. one entry for each column, consisting of the length of the column
+       name as 8 bit unsigned integer, the name, the type of the values
+       (``b"d"`` for 64 bit floating point numbers, ``b"q"`` for 64 bit
+       integers) and the values of all events.
+
+    The columns are those of the ``events`` dictionary of the recorder,
+    e.g., ``senders`` and ``times``.
+    """
+
+    columns = []
+    n_events = 0
+    for name, values in events.items():
+        values = np.asarray(values)
+        n_events = len(values)
+        code = b"q" if np.issubdtype(values.dtype, np.integer) else b"d"
+        name = name.encode()
+        columns.append(struct.pack("<B", len(name)) + name + code + values.astype("<" + code.decode()).tobytes())
+
+    body = struct.pack("<qdII", recorder, time_, n_events, len(columns)) + b"".join(columns)
+    return struct.pack("<I", len(body)) + body
+
+
 def set_mpi_comm(comm):
     global mpi_comm
     mpi_comm = comm
@@ -94,6 +94,7 @@ cdef extern from "nest_datums.h":
 cdef extern from "arraydatum.h":
     cppclass ArrayDatum:
         ArrayDatum() except +
+        ArrayDatum(const ArrayDatum&) except +
         size_t size()
         void reserve(size_t) except +
         void push_back(Datum*) except +
@@ -102,9 +103,13 @@ cdef extern from "arraydatum.h":
 
     cppclass IntVectorDatum:
         IntVectorDatum(vector[long]*) except +
+        IntVectorDatum(const IntVectorDatum&) except +
+        size_t references()
 
     cppclass DoubleVectorDatum:
         DoubleVectorDatum(vector[double]*) except +
+        DoubleVectorDatum(const DoubleVectorDatum&) except +
+        size_t references()
 
 cdef extern from "dict.h":
     cppclass Dictionary:
@@ -120,6 +125,7 @@ cdef extern from "dictdatum.h":
 
     cppclass DictionaryDatum:
         DictionaryDatum(Dictionary *) except +
+        DictionaryDatum(const DictionaryDatum&) except +
         void insert(const string&, Datum*) except +
         TokenMap.const_iterator begin()
         TokenMap.const_iterator end()
@@ -144,11 +150,32 @@ cdef extern from "neststartup.h":
     void nestshutdown(int) except +
     cbool nest_has_mpi4py()
     void c_set_communicator "set_communicator" (object) with gil
+    void get_current_exception(string& errorname, string& message)
+
+# Exception handler for direct calls to the kernel, defined in pynestkernel.pyx
+cdef int raise_kernel_error() except -1
 
 cdef extern from "nest.h" namespace "nest":
     Datum* node_collection_array_index(const Datum* node_collection, const long* array, unsigned long n) except +
     Datum* node_collection_array_index(const Datum* node_collection, const cbool* array, unsigned long n) except +
     void connect_arrays( long* sources, long* targets, double* weights, double* delays, vector[string]& p_keys, double* p_values, size_t n, string syn_model ) except +
+    void get_node_collection_values(const Datum* node_collection, const vector[string]& keys, double* values, size_t n) except +
+    void get_node_collection_values(const Datum* node_collection, const vector[string]& keys, long* values, size_t n) except +
+    void set_node_collection_values(const Datum* node_collection, const vector[string]& keys, const double* values, size_t n) except +
+    void set_node_collection_values(const Datum* node_collection, const vector[string]& keys, const long* values, size_t n) except +
+    void set_node_collection_status(const Datum* node_collection, const Datum* params) except +raise_kernel_error
+    Datum* create_node_collection(const string& model_name, const long n, const DictionaryDatum& params) except +raise_kernel_error
+    void connect_node_collections(const Datum* sources, const Datum* targets, const DictionaryDatum& conn_spec, const Datum* syn_spec) except +raise_kernel_error
+    ArrayDatum get_connections(const DictionaryDatum& params) except +raise_kernel_error
+    ArrayDatum get_node_collection_status(const Datum* node_collection) except +raise_kernel_error
+    ArrayDatum get_connection_status(const ArrayDatum& conns) except +raise_kernel_error
+    void set_kernel_status(const DictionaryDatum& params) except +raise_kernel_error
+    DictionaryDatum get_kernel_status() except +raise_kernel_error
+    void simulate(const double& t) except +raise_kernel_error
+    void kernel_run "nest::run"(const double& t) except +raise_kernel_error
+    void prepare() except +raise_kernel_error
+    void cleanup() except +raise_kernel_error
+    DictionaryDatum get_events_since(size_t node_id, const vector[long]& cursor) except +raise_kernel_error
 
 cdef extern from *:
 
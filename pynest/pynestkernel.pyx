@@ -148,6 +148,67 @@ cdef class SLILiteral:
             return self.name >= obj
 
 
+class KernelCallError(Exception):
+    """Error raised by a direct call to the kernel, see raise_kernel_error().
+
+    The NESTEngine methods that call the kernel directly convert it to the
+    same NESTError that the corresponding SLI command would raise.
+    """
+
+    def __init__(self, errorname, message):
+        Exception.__init__(self, errorname, message)
+        self.errorname = errorname
+        self.message = message
+
+    def to_nest_error(self, commandname):
+        exceptionCls = getattr(NESTErrors, self.errorname)
+        return exceptionCls(commandname, ': ' + self.message)
+
+
+cdef int raise_kernel_error() except -1:
+    # Called by Cython while the C++ exception is being handled
+    cdef string errorname
+    cdef string message
+    get_current_exception(errorname, message)
+    raise KernelCallError(errorname.decode('utf-8'), message.decode('utf-8'))
+
+
+cdef class VectorDatumBuffer:
+    """Expose the vector of an IntVectorDatum or DoubleVectorDatum through the buffer protocol
+
+    The buffer holds a reference to the vector, which is kept alive as long
+    as the buffer or any NumPy array created from it exists.
+    """
+
+    cdef Datum* datum
+    cdef char* data
+    cdef bytes format
+    cdef Py_ssize_t shape[1]
+    cdef Py_ssize_t itemsize
+
+    def __cinit__(self):
+        self.datum = NULL
+
+    def __dealloc__(self):
+        del self.datum
+
+    def __getbuffer__(self, Py_buffer* buffer, int flags):
+        buffer.buf = self.data
+        buffer.format = self.format
+        buffer.internal = NULL
+        buffer.itemsize = self.itemsize
+        buffer.len = self.shape[0] * self.itemsize
+        buffer.ndim = 1
+        buffer.obj = self
+        buffer.readonly = 0
+        buffer.shape = self.shape
+        buffer.strides = &self.itemsize
+        buffer.suboffsets = NULL
+
+    def __releasebuffer__(self, Py_buffer* buffer):
+        pass
+
+
 cdef class NESTEngine:
 
     cdef SLIInterpreter* pEngine
@@ -350,6 +411,302 @@ cdef class NESTEngine:
             exceptionCls = getattr(NESTErrors, str(e))
             raise exceptionCls('connect_arrays', '') from None
 
+    def get_values(self, node_collection, n, keys, dtype):
+        """Get numeric properties of all nodes as NumPy array, bypassing SLI and per-node dictionaries
+
+        For a single key, the array has one entry per node, for a list of keys one row per key.
+        """
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not HAVE_NUMPY:
+            raise NESTErrors.PyNESTError("NumPy is not available")
+        if not (isinstance(node_collection, SLIDatum) and (<SLIDatum> node_collection).dtype == SLI_TYPE_NODECOLLECTION.decode()):
+            raise TypeError('node_collection must be a NodeCollection, got {}'.format(type(node_collection)))
+
+        cdef Datum* nc_datum = (<SLIDatum> node_collection).thisptr
+        cdef vector[string] key_strings
+        cdef double[::1] values_double_mv
+        cdef long[::1] values_long_mv
+
+        shape = n if isinstance(keys, str) else (len(keys), n)
+        for key in ([keys] if isinstance(keys, str) else keys):
+            key_strings.push_back(key.encode('UTF-8'))
+
+        # the kernel writes every entry directly into the memory of the returned array
+        dtype = numpy.dtype(dtype)
+        values = numpy.empty(shape, dtype=dtype)
+        try:
+            if dtype == numpy.double:
+                values_double_mv = values.reshape(-1)
+                if values.size > 0:
+                    get_node_collection_values(nc_datum, key_strings, &values_double_mv[0], <size_t> n)
+            elif dtype == numpy.dtype(int):
+                values_long_mv = values.reshape(-1)
+                if values.size > 0:
+                    get_node_collection_values(nc_datum, key_strings, &values_long_mv[0], <size_t> n)
+            else:
+                raise TypeError('dtype must be float or int, got {}'.format(dtype))
+        except RuntimeError as e:
+            exceptionCls = getattr(NESTErrors, str(e))
+            raise exceptionCls('get_values', '') from None
+
+        return values
+
+    def set_values(self, node_collection, n, keys, values):
+        """Set numeric properties of all nodes from a NumPy array, bypassing SLI and per-node dictionaries
+
+        For a single key, values has one entry per node, for a list of keys one row per key.
+        """
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not HAVE_NUMPY:
+            raise NESTErrors.PyNESTError("NumPy is not available")
+        if not (isinstance(node_collection, SLIDatum) and (<SLIDatum> node_collection).dtype == SLI_TYPE_NODECOLLECTION.decode()):
+            raise TypeError('node_collection must be a NodeCollection, got {}'.format(type(node_collection)))
+        if not isinstance(values, numpy.ndarray):
+            raise TypeError('values must be a NumPy array')
+
+        shape = (n,) if isinstance(keys, str) else (len(keys), n)
+        if values.shape != shape:
+            raise ValueError('values must have one entry per node in the NodeCollection and key, got shape {}'.format(values.shape))
+        if values.size == 0:
+            return
+
+        cdef Datum* nc_datum = (<SLIDatum> node_collection).thisptr
+        cdef vector[string] key_strings
+        cdef double[::1] values_double_mv
+        cdef long[::1] values_long_mv
+
+        for key in ([keys] if isinstance(keys, str) else keys):
+            key_strings.push_back(key.encode('UTF-8'))
+
+        try:
+            if numpy.issubdtype(values.dtype, numpy.floating):
+                values_double_mv = numpy.ascontiguousarray(values, dtype=numpy.double).reshape(-1)
+                set_node_collection_values(nc_datum, key_strings, &values_double_mv[0], <size_t> n)
+            elif numpy.issubdtype(values.dtype, numpy.integer) or numpy.issubdtype(values.dtype, numpy.bool_):
+                values_long_mv = numpy.ascontiguousarray(values, dtype=int).reshape(-1)
+                set_node_collection_values(nc_datum, key_strings, &values_long_mv[0], <size_t> n)
+            else:
+                raise TypeError('values must be a NumPy array of floats or integers, got {}'.format(values.dtype))
+        except RuntimeError as e:
+            exceptionCls = getattr(NESTErrors, str(e))
+            raise exceptionCls('set_values', '') from None
+
+    # The following methods call the kernel directly instead of executing
+    # the corresponding SLI command, which avoids the overhead of the
+    # interpreter for frequently used functions.
+
+    def simulate(self, t):
+        """Simulate for t ms, equivalent to the SLI command Simulate"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        try:
+            simulate(t)
+        except KernelCallError as e:
+            raise e.to_nest_error('Simulate_d') from None
+
+    def prepare(self):
+        """Prepare the simulation, equivalent to the SLI command Prepare"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        try:
+            prepare()
+        except KernelCallError as e:
+            raise e.to_nest_error('Prepare') from None
+
+    def run_simulation(self, t):
+        """Run a prepared simulation for t ms, equivalent to the SLI command Run"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        try:
+            kernel_run(t)
+        except KernelCallError as e:
+            raise e.to_nest_error('Run_d') from None
+
+    def cleanup(self):
+        """Clean up after a simulation, equivalent to the SLI command Cleanup"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        try:
+            cleanup()
+        except KernelCallError as e:
+            raise e.to_nest_error('Cleanup') from None
+
+    def set_kernel_status(self, params):
+        """Set kernel parameters, equivalent to the SLI command SetKernelStatus"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not isinstance(params, dict):
+            raise TypeError('params must be a dict, got {}'.format(type(params)))
+
+        cdef Datum* params_datum = python_object_to_datum(params)
+        try:
+            set_kernel_status(deref(<DictionaryDatum*> params_datum))
+        except KernelCallError as e:
+            raise e.to_nest_error('SetKernelStatus') from None
+        finally:
+            del params_datum
+
+    def get_kernel_status(self):
+        """Get the kernel parameters, equivalent to the SLI command GetKernelStatus"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+
+        cdef DictionaryDatum* status = NULL
+        try:
+            status = new DictionaryDatum(get_kernel_status())
+            return sli_dict_to_object(status)
+        except KernelCallError as e:
+            raise e.to_nest_error('GetKernelStatus') from None
+        finally:
+            del status
+
+    def set_node_collection_status(self, node_collection, params):
+        """Set the parameters of all nodes, equivalent to the SLI command SetStatus
+
+        params is either a dict applied to all nodes or a list with one dict per node.
+        """
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not (isinstance(node_collection, SLIDatum) and (<SLIDatum> node_collection).dtype == SLI_TYPE_NODECOLLECTION.decode()):
+            raise TypeError('node_collection must be a NodeCollection, got {}'.format(type(node_collection)))
+        if not isinstance(params, (dict, list, tuple)):
+            raise TypeError('params must be a dict or a list of dicts, got {}'.format(type(params)))
+
+        cdef Datum* nc_datum = (<SLIDatum> node_collection).thisptr
+        cdef Datum* params_datum = python_object_to_datum(params)
+        try:
+            set_node_collection_status(nc_datum, params_datum)
+        except KernelCallError as e:
+            # SetStatus calls SetStatus_id for every node, so errors of nodes carry its name
+            if e.errorname in ('InvalidNodeCollectionError', 'IncompatibleLengths'):
+                raise e.to_nest_error('SetStatus') from None
+            raise e.to_nest_error('SetStatus_id') from None
+        finally:
+            del params_datum
+
+    def create(self, model, n, params):
+        """Create n nodes of a model, equivalent to the SLI command Create
+
+        params is a dict of parameters for the new nodes, which may be empty.
+        """
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if isinstance(n, bool) or not (isinstance(n, int) or (HAVE_NUMPY and isinstance(n, numpy.integer))):
+            raise TypeError('n must be an integer, got {}'.format(type(n)))
+        if not isinstance(params, dict):
+            raise TypeError('params must be a dict, got {}'.format(type(params)))
+
+        cdef string model_string = model.encode('UTF-8')
+        cdef Datum* params_datum = python_object_to_datum(params)
+        cdef Datum* nc_datum = NULL
+        try:
+            nc_datum = create_node_collection(model_string, n, deref(<DictionaryDatum*> params_datum))
+            return sli_datum_to_object(nc_datum)
+        except KernelCallError as e:
+            raise e.to_nest_error('Create') from None
+        finally:
+            del params_datum
+            del nc_datum
+
+    def connect(self, sources, targets, conn_spec, syn_spec):
+        """Connect two NodeCollections, equivalent to the SLI command Connect
+
+        Unlike the SLI command, this does not fill in default values, so
+        conn_spec must contain the rule and syn_spec the synapse model.
+        syn_spec is a dict or a list of dicts for collocated synapses.
+        """
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        for nodes in (sources, targets):
+            if not (isinstance(nodes, SLIDatum) and (<SLIDatum> nodes).dtype == SLI_TYPE_NODECOLLECTION.decode()):
+                raise TypeError('sources and targets must be NodeCollections, got {}'.format(type(nodes)))
+        if not isinstance(conn_spec, dict):
+            raise TypeError('conn_spec must be a dict, got {}'.format(type(conn_spec)))
+        if not isinstance(syn_spec, (dict, list, tuple)):
+            raise TypeError('syn_spec must be a dict or a list of dicts, got {}'.format(type(syn_spec)))
+
+        cdef Datum* conn_spec_datum = NULL
+        cdef Datum* syn_spec_datum = NULL
+        try:
+            conn_spec_datum = python_object_to_datum(conn_spec)
+            syn_spec_datum = python_object_to_datum(syn_spec)
+            connect_node_collections((<SLIDatum> sources).thisptr, (<SLIDatum> targets).thisptr,
+                                     deref(<DictionaryDatum*> conn_spec_datum), syn_spec_datum)
+        except KernelCallError as e:
+            raise e.to_nest_error('Connect_g_g_D_D' if isinstance(syn_spec, dict) else 'Connect_g_g_D_a') from None
+        finally:
+            del conn_spec_datum
+            del syn_spec_datum
+
+    def get_connections(self, params):
+        """Get the connections selected by params, equivalent to the SLI command GetConnections"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not isinstance(params, dict):
+            raise TypeError('params must be a dict, got {}'.format(type(params)))
+
+        cdef Datum* params_datum = python_object_to_datum(params)
+        cdef ArrayDatum* conns = NULL
+        try:
+            conns = new ArrayDatum(get_connections(deref(<DictionaryDatum*> params_datum)))
+            return sli_array_to_object(conns)
+        except KernelCallError as e:
+            raise e.to_nest_error('GetConnections_D') from None
+        finally:
+            del params_datum
+            del conns
+
+    def get_node_collection_status(self, node_collection):
+        """Get a tuple with the status dicts of all nodes, equivalent to the SLI command GetStatus"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not (isinstance(node_collection, SLIDatum) and (<SLIDatum> node_collection).dtype == SLI_TYPE_NODECOLLECTION.decode()):
+            raise TypeError('node_collection must be a NodeCollection, got {}'.format(type(node_collection)))
+
+        cdef ArrayDatum* status = NULL
+        try:
+            status = new ArrayDatum(get_node_collection_status((<SLIDatum> node_collection).thisptr))
+            return sli_array_to_object(status)
+        except KernelCallError as e:
+            raise e.to_nest_error('GetStatus_g') from None
+        finally:
+            del status
+
+    def get_connection_status(self, conns):
+        """Get a tuple with the status dicts of a list of connections, equivalent to the SLI command GetStatus"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not isinstance(conns, (list, tuple)):
+            raise TypeError('conns must be a list of connections, got {}'.format(type(conns)))
+
+        cdef Datum* conns_datum = python_object_to_datum(conns)
+        cdef ArrayDatum* status = NULL
+        try:
+            status = new ArrayDatum(get_connection_status(deref(<ArrayDatum*> conns_datum)))
+            return sli_array_to_object(status)
+        except KernelCallError as e:
+            raise e.to_nest_error('GetStatus_a') from None
+        finally:
+            del conns_datum
+            del status
+
+    def get_events_since(self, node_id, cursor):
+        """Get the events a recording device has recorded since the given cursor"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+
+        cdef vector[long] positions = cursor
+        cdef DictionaryDatum* result = NULL
+        try:
+            result = new DictionaryDatum(get_events_since(node_id, positions))
+            return sli_dict_to_object(result)
+        except KernelCallError as e:
+            raise e.to_nest_error('GetEventsSince') from None
+        finally:
+            del result
+
 cdef inline Datum* python_object_to_datum(obj) except NULL:
 
     cdef Datum* ret = NULL
@@ -595,22 +952,39 @@ cdef inline object sli_vector_to_object(sli_vector_ptr_t dat, vector_value_t _ =
 
     cdef vector_value_t* array_data = NULL
     cdef vector[vector_value_t]* vector_ptr = NULL
+    cdef VectorDatumBuffer buf
 
     if sli_vector_ptr_t is sli_vector_int_ptr_t and vector_value_t is long:
         vector_ptr = deref_ivector(dat)
-        arr = array.clone(ARRAY_LONG, vector_ptr.size(), False)
-        array_data = arr.data.as_longs
-        if HAVE_NUMPY:
-            ret_dtype = int
+        ret_dtype = int
     elif sli_vector_ptr_t is sli_vector_double_ptr_t and vector_value_t is double:
         vector_ptr = deref_dvector(dat)
-        arr = array.clone(ARRAY_DOUBLE, vector_ptr.size(), False)
-        array_data = arr.data.as_doubles
-        if HAVE_NUMPY:
-            ret_dtype = float
+        ret_dtype = float
     else:
         raise NESTErrors.PyNESTError("unsupported specialization")
 
+    # If the vector is not referenced anywhere else, the NumPy array
+    # takes over a reference to it instead of copying the data
+    if HAVE_NUMPY and vector_ptr.size() > 0 and dat.references() == 1:
+        buf = VectorDatumBuffer()
+        if sli_vector_ptr_t is sli_vector_int_ptr_t:
+            buf.datum = <Datum*> new IntVectorDatum(deref(dat))
+            buf.format = b'l'
+        else:
+            buf.datum = <Datum*> new DoubleVectorDatum(deref(dat))
+            buf.format = b'd'
+        buf.data = <char*> &vector_ptr.front()
+        buf.shape[0] = vector_ptr.size()
+        buf.itemsize = sizeof(vector_value_t)
+        return numpy.frombuffer(buf, dtype=ret_dtype)
+
+    if sli_vector_ptr_t is sli_vector_int_ptr_t:
+        arr = array.clone(ARRAY_LONG, vector_ptr.size(), False)
+        array_data = arr.data.as_longs
+    else:
+        arr = array.clone(ARRAY_DOUBLE, vector_ptr.size(), False)
+        array_data = arr.data.as_doubles
+
     # skip when vector_ptr points to an empty vector
     if vector_ptr.size() > 0:
         memcpy(array_data, &vector_ptr.front(), vector_ptr.size() * sizeof(vector_value_t))
@@ -28,5 +28,7 @@
 #include "test_block_vector.h"
 #include "test_enum_bitfield.h"
 #include "test_parameter.h"
+#include "test_random_generators.h"
 #include "test_sort.h"
 #include "test_target_fields.h"
+#include "test_wfr_input_cache.h"
@@ -0,0 +1,189 @@
+/*
+ *  test_random_generators.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_RANDOM_GENERATORS_H
+#define TEST_RANDOM_GENERATORS_H
+
+// C++ includes:
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// Generated includes:
+#include "config.h"
+
+// Includes from nestkernel:
+#include "random_generators.h"
+
+// Includes from thirdparty:
+#ifdef HAVE_RANDOM123
+#include "Random123/conventional/Engine.hpp"
+#include "Random123/philox.h"
+#include "Random123/threefry.h"
+#endif
+
+namespace
+{
+
+/**
+ * Create one factory per engine type available in this build.
+ */
+std::vector< std::pair< std::string, std::shared_ptr< nest::BaseRandomGeneratorFactory > > >
+rng_factories()
+{
+  std::vector< std::pair< std::string, std::shared_ptr< nest::BaseRandomGeneratorFactory > > > factories;
+  factories.emplace_back( "mt19937", std::make_shared< nest::RandomGeneratorFactory< std::mt19937 > >() );
+  factories.emplace_back( "mt19937_64", std::make_shared< nest::RandomGeneratorFactory< std::mt19937_64 > >() );
+#ifdef HAVE_RANDOM123
+  factories.emplace_back(
+    "Philox_32", std::make_shared< nest::RandomGeneratorFactory< r123::Engine< r123::Philox4x32 > > >() );
+  factories.emplace_back(
+    "Threefry_32", std::make_shared< nest::RandomGeneratorFactory< r123::Engine< r123::Threefry4x32 > > >() );
+#endif
+  return factories;
+}
+
+/**
+ * Return samples per second for drawing n samples with the given function.
+ */
+template < typename DrawFunction >
+double
+samples_per_second( const size_t n, DrawFunction draw )
+{
+  const auto start = std::chrono::steady_clock::now();
+  draw();
+  const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+  return n / std::max( elapsed.count(), 1e-9 );
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE( test_random_generators )
+
+/**
+ * Filling a buffer must give exactly the numbers obtained from sequential draws.
+ */
+BOOST_AUTO_TEST_CASE( test_fill_matches_sequential_draws )
+{
+  const size_t n = 1001; // odd to check caching of normal deviates across calls
+
+  for ( const auto& factory : rng_factories() )
+  {
+    std::unique_ptr< nest::BaseRandomGenerator > rng_seq( factory.second->create( { 12345, 67 } ) );
+    std::unique_ptr< nest::BaseRandomGenerator > rng_fill( factory.second->create( { 12345, 67 } ) );
+
+    std::vector< double > dbl_fill( n );
+    rng_fill->fill_drand( dbl_fill.data(), n );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      BOOST_REQUIRE( rng_seq->drand() == dbl_fill[ i ] );
+    }
+
+    nest::normal_distribution normal_seq;
+    nest::normal_distribution normal_fill;
+    normal_fill.fill( rng_fill.get(), dbl_fill.data(), n );
+    normal_fill.fill( rng_fill.get(), dbl_fill.data(), n );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      normal_seq( rng_seq.get() );
+    }
+    for ( size_t i = 0; i < n; ++i )
+    {
+      BOOST_REQUIRE( normal_seq( rng_seq.get() ) == dbl_fill[ i ] );
+    }
+
+    std::vector< unsigned long > ul_fill( n );
+    nest::poisson_distribution poisson_seq;
+    nest::poisson_distribution poisson_fill;
+    poisson_seq.param( nest::poisson_distribution::param_type( 3.7 ) );
+    poisson_fill.param( nest::poisson_distribution::param_type( 3.7 ) );
+    poisson_fill.fill( rng_fill.get(), ul_fill.data(), n );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      BOOST_REQUIRE( poisson_seq( rng_seq.get() ) == ul_fill[ i ] );
+    }
+
+    nest::binomial_distribution binomial_seq;
+    nest::binomial_distribution binomial_fill;
+    binomial_seq.param( nest::binomial_distribution::param_type( 50, 0.3 ) );
+    binomial_fill.param( nest::binomial_distribution::param_type( 50, 0.3 ) );
+    binomial_fill.fill( rng_fill.get(), ul_fill.data(), n );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      BOOST_REQUIRE( binomial_seq( rng_seq.get() ) == ul_fill[ i ] );
+    }
+  }
+}
+
+/**
+ * Micro-benchmark reporting samples per second for per-call and bulk generation.
+ *
+ * Results are reported as test messages, visible with --log_level=message.
+ */
+BOOST_AUTO_TEST_CASE( test_bulk_generation_throughput )
+{
+  const size_t n = 1000000;
+  std::vector< double > dbl_buffer( n );
+  std::vector< unsigned long > ul_buffer( n );
+
+  for ( const auto& factory : rng_factories() )
+  {
+    std::unique_ptr< nest::BaseRandomGenerator > rng( factory.second->create( { 12345 } ) );
+
+    const double per_call = samples_per_second( n,
+      [ & ]()
+      {
+        for ( size_t i = 0; i < n; ++i )
+        {
+          dbl_buffer[ i ] = rng->drand();
+        }
+      } );
+    const double bulk_uniform = samples_per_second( n, [ & ]() { rng->fill_drand( dbl_buffer.data(), n ); } );
+
+    nest::normal_distribution normal;
+    const double bulk_normal = samples_per_second( n, [ & ]() { normal.fill( rng.get(), dbl_buffer.data(), n ); } );
+
+    nest::poisson_distribution poisson;
+    poisson.param( nest::poisson_distribution::param_type( 2.5 ) );
+    const double bulk_poisson = samples_per_second( n, [ & ]() { poisson.fill( rng.get(), ul_buffer.data(), n ); } );
+
+    nest::binomial_distribution binomial;
+    binomial.param( nest::binomial_distribution::param_type( 20, 0.1 ) );
+    const double bulk_binomial =
+      samples_per_second( n, [ & ]() { binomial.fill( rng.get(), ul_buffer.data(), n ); } );
+
+    BOOST_TEST_MESSAGE( factory.first << ": drand " << per_call << "/s, fill_drand " << bulk_uniform
+                                      << "/s, normal " << bulk_normal << "/s, poisson " << bulk_poisson
+                                      << "/s, binomial " << bulk_binomial << "/s" );
+
+    BOOST_REQUIRE( per_call > 0 and bulk_uniform > 0 and bulk_normal > 0 and bulk_poisson > 0 and bulk_binomial > 0 );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* TEST_RANDOM_GENERATORS_H */
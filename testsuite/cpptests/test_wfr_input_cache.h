@@ -0,0 +1,92 @@
+/*
+ *  test_wfr_input_cache.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_WFR_INPUT_CACHE_H
+#define TEST_WFR_INPUT_CACHE_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <vector>
+
+// Includes from nestkernel:
+#include "wfr_input_cache.h"
+
+/**
+ * Fixture storing an input with a summed weight of 2 and the coefficients sent for it.
+ */
+struct stored_wfr_input
+{
+  stored_wfr_input()
+    : input( { 1.0, -2.0, 0.5 } )
+    , coefficients( { -70.0, 0.1, 0.0, 0.0 } )
+  {
+    cache.store( input, 2.0, coefficients );
+  }
+
+  nest::WfrInputCache cache;
+  std::vector< double > input;
+  std::vector< double > coefficients;
+};
+
+BOOST_AUTO_TEST_SUITE( test_wfr_input_cache )
+
+/**
+ * Tests that a node without stored input is always updated.
+ */
+BOOST_AUTO_TEST_CASE( test_empty_cache_changed )
+{
+  nest::WfrInputCache cache;
+  BOOST_REQUIRE( not cache.unchanged( { 0.0, 0.0 }, 0.0, 1.0 ) );
+}
+
+/**
+ * Tests that changes up to the tolerance times the summed weight count as unchanged.
+ */
+BOOST_FIXTURE_TEST_CASE( test_change_within_tolerance, stored_wfr_input )
+{
+  BOOST_REQUIRE( cache.unchanged( input, 2.0, 0.0 ) );
+
+  input[ 1 ] += 1.5e-4;
+  BOOST_REQUIRE( cache.unchanged( input, 2.0, 1e-4 ) );
+  BOOST_REQUIRE( not cache.unchanged( input, 2.0, 0.5e-4 ) );
+  BOOST_REQUIRE( not cache.unchanged( input, 1.0, 1e-4 ) );
+
+  BOOST_REQUIRE( cache.get_coefficients() == coefficients );
+}
+
+/**
+ * Tests that inputs with other weights or lengths and cleared inputs count as changed.
+ */
+BOOST_FIXTURE_TEST_CASE( test_other_or_cleared_input_changed, stored_wfr_input )
+{
+  BOOST_REQUIRE( not cache.unchanged( input, 2.5, 1.0 ) );
+  BOOST_REQUIRE( not cache.unchanged( { 1.0, -2.0 }, 2.0, 1.0 ) );
+
+  cache.clear();
+  BOOST_REQUIRE( not cache.unchanged( input, 2.0, 1.0 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* TEST_WFR_INPUT_CACHE_H */
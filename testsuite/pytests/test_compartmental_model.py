@@ -1146,6 +1146,55 @@ class CompartmentsTestCase(unittest.TestCase):
                 {"comp_idx": 0, "receptor_type": "AMPA", "params_name": rp_real},
             ]
 
+    def test_rate_tables(self, dt=0.1, t_max=100.0):
+        sp = {"C_m": 1.00, "g_C": 0.00, "g_L": 0.100, "e_L": -70.0, "gbar_Na": 100.0, "gbar_K": 20.0}
+        dp = {"C_m": 0.10, "g_C": 0.10, "g_L": 0.050, "e_L": -70.0, "gbar_Na": 10.0, "gbar_K": 5.0}
+
+        def simulate(rate_table_tolerance):
+            nest.ResetKernel()
+            nest.SetKernelStatus({"resolution": dt})
+
+            cm = nest.Create("cm_default", params={"rate_table_tolerance": rate_table_tolerance})
+            cm.compartments = [
+                {"parent_idx": -1, "params": sp},
+                {"parent_idx": 0, "params": dp},
+            ]
+
+            dc = nest.Create("dc_generator", {"amplitude": 2.0})
+            nest.Connect(dc, cm, syn_spec={"receptor_type": 0})
+
+            mm = nest.Create("multimeter", 1, {"record_from": ["v_comp0", "v_comp1"], "interval": dt})
+            sr = nest.Create("spike_recorder")
+            nest.Connect(mm, cm)
+            nest.Connect(cm, sr)
+
+            nest.Simulate(t_max)
+
+            return mm.events, sr.events["times"]
+
+        events, spike_times = simulate(0.0)
+        events_tab, spike_times_tab = simulate(1e-8)
+
+        # the interpolation error of the rates causes small deviations of the voltages
+        self.assertTrue(len(spike_times) > 1)
+        self.assertTrue(np.allclose(spike_times_tab, spike_times))
+        self.assertTrue(np.allclose(events_tab["v_comp0"], events["v_comp0"], atol=1e-3))
+        self.assertTrue(np.allclose(events_tab["v_comp1"], events["v_comp1"], atol=1e-3))
+
+        # negative tolerance
+        cm = nest.Create("cm_default")
+        with self.assertRaises(nest.kernel.NESTError):
+            cm.rate_table_tolerance = -1.0
+
+        # tolerance that cannot be reached by refining the table
+        cm.rate_table_tolerance = 1e-15
+        cm.compartments = [{"parent_idx": -1, "params": sp}]
+        with self.assertRaisesRegex(nest.kernel.NESTError, "cannot be tabulated"):
+            nest.Simulate(dt)
+
+        # the kernel cannot simulate after the failed preparation
+        nest.ResetKernel()
+
 
 def suite():
     # makeSuite is sort of obsolete http://bugs.python.org/issue2721
@@ -0,0 +1,114 @@
+# -*- coding: utf-8 -*-
+#
+# test_compress_off_grid_spikes.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+
+"""
+Test that precise spike times transmitted as fixed-point offsets deviate at most by the quantization bound.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+RESOLUTION = 0.1
+DELAY = 1.0
+SIMTIME = 200.0
+
+# largest rounding error of a transmitted offset, plus the rounding
+# error of spike times in ms, which are computed from step and offset
+MAX_OFFSET_ERROR = 0.5 * RESOLUTION / (2**32 - 1) + 2 * np.spacing(SIMTIME)
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def _simulate(compress, num_threads):
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads, resolution=RESOLUTION, compress_off_grid_spikes=compress)
+
+    pg = nest.Create("poisson_generator_ps", params={"rate": 20000.0})
+    parrots = nest.Create("parrot_neuron_ps", 10)
+    relays = nest.Create("parrot_neuron_ps", 10)
+    neurons = nest.Create("iaf_psc_exp_ps", 10)
+    sr_parrots = nest.Create("spike_recorder")
+    sr_relays = nest.Create("spike_recorder")
+    sr_neurons = nest.Create("spike_recorder")
+
+    nest.Connect(pg, parrots)
+    nest.Connect(parrots, relays, "one_to_one", syn_spec={"delay": DELAY})
+    nest.Connect(parrots, neurons, syn_spec={"weight": 100.0})
+    nest.Connect(parrots, sr_parrots)
+    nest.Connect(relays, sr_relays)
+    nest.Connect(neurons, sr_neurons)
+
+    nest.Simulate(SIMTIME)
+
+    assert nest.off_grid_spiking
+    return [(sr.events["senders"], sr.events["times"]) for sr in (sr_parrots, sr_relays, sr_neurons)]
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_transmitted_spike_times_within_bound(num_threads):
+    """
+    Test that spike times relayed by parrots deviate from the sent spike times at most by the quantization bound.
+    """
+
+    (parrot_senders, parrot_times), (relay_senders, relay_times), _ = _simulate(True, num_threads)
+
+    parrot_order = np.lexsort((parrot_times, parrot_senders))
+    relay_order = np.lexsort((relay_times, relay_senders))
+    sent = parrot_times[parrot_order][parrot_times[parrot_order] < SIMTIME - DELAY] + DELAY
+    received = relay_times[relay_order]
+
+    assert len(received) > 0
+    assert len(received) == len(sent)
+    errors = np.abs(received - sent)
+    # the offsets have been rounded, but not by more than the bound
+    assert errors.max() > 0
+    assert errors.max() <= MAX_OFFSET_ERROR
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_neuron_spike_times_within_bound(num_threads):
+    """
+    Test that neurons receiving compressed spikes fire at the same times as with exact offsets up to the bound.
+    """
+
+    expected = _simulate(False, num_threads)
+    recorded = _simulate(True, num_threads)
+
+    for (expected_senders, expected_times), (senders, times) in zip(expected, recorded):
+        assert len(times) > 0
+        nptest.assert_array_equal(senders, expected_senders)
+        nptest.assert_allclose(times, expected_times, rtol=0, atol=MAX_OFFSET_ERROR)
+
+
+def test_compression_disabled_by_default():
+    """Test that offsets are transmitted exactly unless compression is switched on."""
+
+    assert not nest.compress_off_grid_spikes
+    nest.compress_off_grid_spikes = True
+    assert nest.compress_off_grid_spikes
+    nest.ResetKernel()
+    assert not nest.compress_off_grid_spikes
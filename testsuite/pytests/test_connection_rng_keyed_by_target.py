@@ -0,0 +1,75 @@
+# -*- coding: utf-8 -*-
+#
+# test_connection_rng_keyed_by_target.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that target-keyed connection RNGs create identical networks for different numbers of threads.
+"""
+
+import nest
+import pytest
+
+conn_specs = [
+    {"rule": "fixed_indegree", "indegree": 5},
+    {"rule": "pairwise_bernoulli", "p": 0.2},
+    {"rule": "pairwise_poisson", "pairwise_avg_num_conns": 0.2},
+]
+
+
+def build_network(num_threads, conn_spec, keyed):
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads, rng_seed=1234, connection_rng_keyed_by_target=keyed)
+    if "Philox_32" in nest.rng_types:
+        nest.rng_type = "Philox_32"
+
+    nrns = nest.Create("iaf_psc_alpha", 20)
+    nest.Connect(nrns, nrns, conn_spec, {"weight": nest.random.uniform(0.5, 1.5)})
+    nest.Connect(nrns, nrns, conn_spec)
+
+    conns = nest.GetConnections().get(["source", "target", "weight"])
+    return sorted(zip(conns["source"], conns["target"], conns["weight"]))
+
+
+def test_keyed_rng_default_off():
+    nest.ResetKernel()
+    assert not nest.connection_rng_keyed_by_target
+
+
+@pytest.mark.skipif_missing_threads
+@pytest.mark.parametrize("conn_spec", conn_specs)
+def test_connectivity_independent_of_threads(conn_spec):
+    """Connections and random weights must not depend on the number of threads."""
+
+    assert build_network(1, conn_spec, True) == build_network(3, conn_spec, True)
+
+
+@pytest.mark.parametrize("conn_spec", conn_specs)
+def test_subsequent_connect_calls_differ(conn_spec):
+    """Two Connect calls with the same specification must draw different connections."""
+
+    nest.ResetKernel()
+    nest.set(rng_seed=1234, connection_rng_keyed_by_target=True)
+    nrns = nest.Create("iaf_psc_alpha", 20)
+    nest.Connect(nrns, nrns, conn_spec, {"synapse_model": "static_synapse"})
+    nest.Connect(nrns, nrns, conn_spec, {"synapse_model": "stdp_synapse"})
+
+    first = nest.GetConnections(synapse_model="static_synapse").get(["source", "target"])
+    second = nest.GetConnections(synapse_model="stdp_synapse").get(["source", "target"])
+    assert sorted(zip(first["source"], first["target"])) != sorted(zip(second["source"], second["target"]))
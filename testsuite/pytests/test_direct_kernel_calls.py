@@ -0,0 +1,405 @@
+# -*- coding: utf-8 -*-
+#
+# test_direct_kernel_calls.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that API functions calling the kernel directly behave like the corresponding SLI commands.
+"""
+
+import timeit
+
+import nest
+import numpy as np
+import pytest
+from nest.ll_api import (
+    connect_nodes,
+    create_nodes,
+    get_connections,
+    get_node_collection_status,
+    sli_func,
+    spp,
+    sps,
+    sr,
+)
+
+
+@pytest.fixture(autouse=True)
+def reset_kernel():
+    nest.ResetKernel()
+
+
+def _raise_via_sli(cmd, *args):
+    """Execute an SLI command that is expected to fail and return the exception."""
+
+    with pytest.raises(nest.kernel.NESTError) as excinfo:
+        for arg in args:
+            sps(arg)
+        sr(cmd)
+    return excinfo.value
+
+
+def _assert_same_error(direct, via_sli):
+    assert type(direct) is type(via_sli)
+    assert direct.commandname == via_sli.commandname
+    assert direct.errormessage == via_sli.errormessage
+
+
+def _assert_same_value(direct, via_sli):
+    if isinstance(direct, dict):
+        assert direct.keys() == via_sli.keys()
+        for key in direct:
+            _assert_same_value(direct[key], via_sli[key])
+    else:
+        assert np.array_equal(direct, via_sli)
+
+
+def test_simulate_and_run():
+    """Test that Simulate and Run advance the kernel time."""
+
+    nest.Simulate(10.0)
+    assert nest.biological_time == 10.0
+
+    with nest.RunManager():
+        nest.Run(5)
+        nest.Run(5.0)
+    assert nest.biological_time == 20.0
+
+
+def test_simulate_error():
+    """Test that Simulate raises the same error as the SLI command."""
+
+    with pytest.raises(nest.kernel.NESTError) as excinfo:
+        nest.Simulate(-1.0)
+
+    # the failed simulation leaves the kernel prepared
+    nest.ResetKernel()
+    _assert_same_error(excinfo.value, _raise_via_sli("ms Simulate", -1.0))
+
+
+def test_run_without_prepare():
+    """Test that Run raises the same error as the SLI command if Prepare was not called."""
+
+    with pytest.raises(nest.kernel.NESTErrors.KernelException) as excinfo:
+        nest.Run(10.0)
+
+    _assert_same_error(excinfo.value, _raise_via_sli("ms Run", 10.0))
+
+
+def test_kernel_status():
+    """Test that kernel parameters set directly can be read back through SLI and vice versa."""
+
+    nest.SetKernelStatus({"resolution": 0.5, "rng_seed": 123})
+    sr("GetKernelStatus")
+    assert spp()["resolution"] == 0.5
+
+    sps({"rng_seed": 321})
+    sr("SetKernelStatus")
+    assert nest.GetKernelStatus("rng_seed") == 321
+    assert nest.rng_seed == 321
+
+    nest.rng_seed = 42
+    _assert_same_value(nest.GetKernelStatus(), sli_func("GetKernelStatus"))
+
+
+def test_set_kernel_status_error():
+    """Test that SetKernelStatus raises the same error as the SLI command."""
+
+    with pytest.raises(nest.kernel.NESTError) as excinfo:
+        nest.SetKernelStatus({"resolution": -1.0})
+
+    _assert_same_error(excinfo.value, _raise_via_sli("SetKernelStatus", {"resolution": -1.0}))
+
+
+def test_set_node_collection():
+    """Test that NodeCollection.set applies single dicts and lists of dicts."""
+
+    nodes = nest.Create("iaf_psc_alpha", 3)
+
+    nodes.set({"V_m": -60.0, "I_e": 10.0})
+    assert nodes.get("V_m") == (-60.0, -60.0, -60.0)
+    assert nodes.get("I_e") == (10.0, 10.0, 10.0)
+
+    nodes.set([{"V_m": -61.0}, {"V_m": -62.0}, {"V_m": -63.0}])
+    assert nodes.get("V_m") == (-61.0, -62.0, -63.0)
+
+    nodes[1:].set(V_m=[-55.0, -56.0])
+    assert nodes.get("V_m") == (-61.0, -55.0, -56.0)
+
+
+@pytest.mark.parametrize("params", [{"V_m": "foo"}, {"no_such_parameter": 1.0}])
+def test_set_node_collection_error(params):
+    """Test that NodeCollection.set raises the same error as the SLI command."""
+
+    nodes = nest.Create("iaf_psc_alpha", 2)
+
+    with pytest.raises(nest.kernel.NESTError) as excinfo:
+        nodes.set(params)
+
+    _assert_same_error(excinfo.value, _raise_via_sli("SetStatus", nodes._datum, params))
+
+
+def _create_via_sli(model, n, params):
+    sps(n)
+    sps(params)
+    sr("/{} 3 1 roll Create".format(model))
+    return spp()
+
+
+def _connect_via_sli(pre, post, *specs):
+    for arg in (pre._datum, post._datum) + specs:
+        sps(arg)
+    sr("Connect")
+
+
+def _connections():
+    conns = nest.GetConnections()
+    return sorted(zip(conns.source, conns.target, conns.synapse_model, conns.weight))
+
+
+@pytest.mark.parametrize(
+    "model, params",
+    [("iaf_psc_alpha", {"V_m": -60.0, "I_e": 5.0}), ("spike_recorder", {"start": 5.0, "record_to": "memory"})],
+)
+def test_create(model, params):
+    """Test that Create sets the parameters like the SLI command and keeps the model defaults."""
+
+    defaults = {key: value for key, value in nest.GetDefaults(model).items() if key in params}
+
+    nodes = nest.Create(model, 3, params)
+    assert {key: nest.GetDefaults(model)[key] for key in params} == defaults
+
+    via_sli = _create_via_sli(model, 3, params)
+    _assert_same_value(nodes.get(list(params)), via_sli.get(list(params)))
+
+
+@pytest.mark.parametrize(
+    "model, n, params",
+    [
+        ("no_such_model", 2, {"V_m": -60.0}),
+        ("iaf_psc_alpha", 0, {"V_m": -60.0}),
+        ("iaf_psc_alpha", 2, {"no_such_parameter": 1.0}),
+        ("iaf_psc_alpha", 2, {"V_m": -60.0, "C_m": -1.0}),
+        ("spike_recorder", 2, {"no_such_parameter": 1.0}),
+    ],
+)
+def test_create_error(model, n, params):
+    """Test that Create raises the same errors as the SLI command and leaves the model defaults unchanged."""
+
+    defaults = nest.GetDefaults("iaf_psc_alpha")["V_m"]
+
+    with pytest.raises(nest.kernel.NESTError) as excinfo:
+        nest.Create(model, n, params)
+    assert nest.GetDefaults("iaf_psc_alpha")["V_m"] == defaults
+
+    # the SLI command raises the errors in the different commands it calls
+    via_sli = _raise_via_sli("/{} 3 1 roll Create".format(model), n, params)
+    assert type(excinfo.value) is type(via_sli)
+    assert excinfo.value.errormessage == via_sli.errormessage
+
+
+@pytest.mark.parametrize(
+    "conn_spec, syn_spec",
+    [
+        (None, None),
+        ({"rule": "one_to_one"}, None),
+        ({"rule": "fixed_indegree", "indegree": 2}, {"synapse_model": "stdp_synapse", "weight": 2.0}),
+        ({"rule": "pairwise_bernoulli", "p": 0.5}, {"weight": 3.0}),
+        (
+            {"rule": "all_to_all"},
+            nest.CollocatedSynapses({"weight": -1.0}, {"synapse_model": "stdp_synapse", "weight": 3.0}),
+        ),
+    ],
+)
+def test_connect(conn_spec, syn_spec):
+    """Test that Connect creates the same connections as the SLI command."""
+
+    nodes = nest.Create("iaf_psc_alpha", 4)
+    nest.Connect(nodes, nodes, conn_spec, syn_spec)
+    connections = _connections()
+
+    # the random connection rules draw the same numbers after a reset
+    nest.ResetKernel()
+    nodes = nest.Create("iaf_psc_alpha", 4)
+    specs = (conn_spec,) if syn_spec is None else (conn_spec, syn_spec)
+    _connect_via_sli(nodes, nodes, *(specs if conn_spec is not None else ()))
+
+    assert len(connections) > 0
+    assert connections == _connections()
+
+
+@pytest.mark.parametrize(
+    "conn_spec, syn_spec",
+    [
+        ({"rule": "no_such_rule"}, None),
+        ({"rule": "all_to_all"}, {"synapse_model": "no_such_synapse"}),
+        ({"rule": "all_to_all", "no_such_parameter": 1.0}, None),
+        ({"rule": "all_to_all"}, {"no_such_parameter": 1.0}),
+        ({"rule": "fixed_indegree"}, None),
+    ],
+)
+def test_connect_error(conn_spec, syn_spec):
+    """Test that Connect raises the same errors as the SLI command."""
+
+    nodes = nest.Create("iaf_psc_alpha", 2)
+
+    with pytest.raises(nest.kernel.NESTError) as excinfo:
+        nest.Connect(nodes, nodes, conn_spec, syn_spec)
+
+    specs = (conn_spec,) if syn_spec is None else (conn_spec, syn_spec)
+    _assert_same_error(excinfo.value, _raise_via_sli("Connect", nodes._datum, nodes._datum, *specs))
+
+
+def test_get_connections():
+    """Test that GetConnections returns the same connections as the SLI command."""
+
+    nodes = nest.Create("iaf_psc_alpha", 3)
+    nest.Connect(nodes, nodes)
+    nest.Connect(nodes[:2], nodes, syn_spec="stdp_synapse")
+
+    conns = nest.GetConnections(source=nodes[1:], synapse_model="stdp_synapse")
+    via_sli = sli_func("GetConnections", {"source": nodes[1:], "synapse_model": nest.kernel.SLILiteral("stdp_synapse")})
+    assert len(conns) == 3
+    _assert_same_value(conns.get(), via_sli.get())
+
+    assert len(nest.GetConnections(target=nodes[0], synapse_label=1)) == 0
+
+    with pytest.raises(nest.kernel.NESTError) as excinfo:
+        nest.GetConnections(synapse_model="no_such_synapse")
+    params = {"synapse_model": nest.kernel.SLILiteral("no_such_synapse")}
+    _assert_same_error(excinfo.value, _raise_via_sli("GetConnections", params))
+
+
+def test_get_node_status():
+    """Test that getting node parameters returns the same values as the SLI commands."""
+
+    nodes = nest.Create("iaf_psc_alpha", 3, {"V_m": -60.0})
+
+    for direct, via_sli in zip(nest.GetStatus(nodes), sli_func("GetStatus", nodes._datum)):
+        _assert_same_value(direct, via_sli)
+    assert nest.GetStatus(nodes, "V_m") == sli_func("GetStatus { /V_m get } Map", nodes._datum)
+    assert nest.GetStatus(nodes, ["V_m", "C_m"]) == sli_func("GetStatus { [ [ /V_m /C_m ] ] get } Map", nodes._datum)
+
+    _assert_same_value(nodes.get(), sli_func("get", nodes._datum))
+    _assert_same_value(nodes[1].get(), sli_func("get", nodes[1]._datum))
+    assert nodes.get("V_m") == (-60.0, -60.0, -60.0)
+    assert nodes[0].get("V_m") == -60.0
+
+
+def test_get_composite_node_status():
+    """Test that nodes of a composite NodeCollection without a parameter get None as in SLI."""
+
+    nodes = nest.Create("iaf_psc_alpha", 2) + nest.Create("parrot_neuron")
+
+    status = nodes.get()
+    via_sli = sli_func("get", nodes._datum)
+    assert status.keys() == via_sli.keys()
+    assert status["V_m"] == via_sli["V_m"] == (-70.0, -70.0, None)
+    assert status["global_id"] == via_sli["global_id"] == (1, 2, 3)
+    assert nodes.get("V_m") == (-70.0, -70.0, None)
+
+    with pytest.raises(KeyError):
+        nodes.get("no_such_parameter")
+
+
+def test_get_connection_status():
+    """Test that getting connection parameters returns the same values as the SLI commands."""
+
+    nodes = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(nodes, nodes, syn_spec={"weight": 2.0})
+    conns = nest.GetConnections()
+
+    for direct, via_sli in zip(nest.GetStatus(conns), sli_func("GetStatus", conns._datum)):
+        _assert_same_value(direct, via_sli)
+    assert nest.GetStatus(conns, ["source", "weight"]) == sli_func(
+        "GetStatus { [ [ /source /weight ] ] get } Map", conns._datum
+    )
+    assert conns.get("weight") == [2.0, 2.0, 2.0, 2.0]
+    assert conns.get(["source", "target"]) == {"source": [1, 1, 2, 2], "target": [1, 2, 1, 2]}
+    assert conns[0].get() == sli_func("GetStatus", conns[0]._datum)[0]
+
+
+@pytest.mark.parametrize("collection", ["nodes", "conns"])
+def test_get_status_error(collection):
+    """Test that getting a parameter that does not exist raises the same error as the SLI commands."""
+
+    nodes = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(nodes, nodes)
+    elements = nodes if collection == "nodes" else nest.GetConnections()
+    via_sli = _raise_via_sli("GetStatus { /no_such_parameter get } Map", elements._datum)
+
+    for keys in ["no_such_parameter", ["no_such_parameter"]]:
+        with pytest.raises(nest.kernel.NESTError) as excinfo:
+            nest.GetStatus(elements, keys)
+        _assert_same_error(excinfo.value, via_sli)
+
+
+def test_get_status_invalid_node_collection():
+    """Test that getting the status of nodes after ResetKernel raises the same error as the SLI command."""
+
+    nodes = nest.Create("iaf_psc_alpha", 2)
+    nest.ResetKernel()
+
+    with pytest.raises(nest.kernel.NESTError) as excinfo:
+        nest.GetStatus(nodes)
+    _assert_same_error(excinfo.value, _raise_via_sli("GetStatus", nodes._datum))
+
+
+def test_direct_calls_faster_than_sli():
+    """Test that calling the kernel directly has less latency than executing the SLI commands."""
+
+    nodes = nest.Create("iaf_psc_alpha", 10)
+    nest.Connect(nodes, nodes, "one_to_one")
+    node = nodes[0]
+    sources = nodes[:2]
+    conn_spec = {"rule": "one_to_one"}
+    syn_spec = {"synapse_model": "static_synapse", "weight": 2.0}
+
+    # the SLI commands are executed as in the previous implementation of the API functions
+    def via_sli(cmd, *args, result=True):
+        for arg in args:
+            sps(arg)
+        sr(cmd)
+        return spp() if result else None
+
+    calls = {
+        "Create": (
+            lambda: create_nodes("iaf_psc_alpha", 1, {"V_m": -60.0}),
+            lambda: via_sli("/iaf_psc_alpha 3 1 roll exch Create", {"V_m": -60.0}, 1),
+        ),
+        "GetConnections": (
+            lambda: get_connections({"source": sources}),
+            lambda: via_sli("GetConnections", {"source": sources}),
+        ),
+        "GetStatus": (
+            lambda: get_node_collection_status(node._datum),
+            lambda: via_sli("GetStatus", node._datum),
+        ),
+        # connecting last keeps the network small for GetConnections
+        "Connect": (
+            lambda: connect_nodes(nodes._datum, nodes._datum, conn_spec, syn_spec),
+            lambda: via_sli("Connect", nodes._datum, nodes._datum, conn_spec, syn_spec, result=False),
+        ),
+    }
+
+    for name, (direct, sli) in calls.items():
+        # the fastest of several repetitions is least affected by other load
+        direct_time = min(timeit.repeat(direct, number=20, repeat=5))
+        sli_time = min(timeit.repeat(sli, number=20, repeat=5))
+        assert direct_time < sli_time, name
@@ -0,0 +1,129 @@
+# -*- coding: utf-8 -*-
+#
+# test_get_events_since.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that ``GetEventsSince`` returns the events recorded since the last call.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def _build(num_threads):
+    nest.local_num_threads = num_threads
+
+    neurons = nest.Create("iaf_psc_alpha", 4, params={"I_e": 500.0})
+    sr = nest.Create("spike_recorder")
+    mm = nest.Create("multimeter", params={"interval": 1.0, "record_from": ["V_m"]})
+    nest.Connect(neurons, sr)
+    nest.Connect(mm, neurons)
+
+    return sr, mm
+
+
+def _concatenate(chunks):
+    return {name: np.concatenate([chunk[name] for chunk in chunks]) for name in chunks[0]}
+
+
+def _sorted(events):
+    order = np.lexsort((events["senders"], events["times"]))
+    return {name: np.asarray(values)[order] for name, values in events.items()}
+
+
+def _assert_events_equal(actual, expected):
+    actual, expected = _sorted(actual), _sorted(expected)
+    assert actual.keys() == expected.keys()
+    for name in expected:
+        nptest.assert_allclose(actual[name], expected[name])
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_incremental_reads_equal_all_events(num_threads):
+    """Test that the events read in chunks add up to all recorded events."""
+
+    devices = _build(num_threads)
+    cursors = [None] * len(devices)
+    chunks = [[] for _ in devices]
+
+    with nest.RunManager():
+        for _ in range(5):
+            nest.Run(20.0)
+            for i, device in enumerate(devices):
+                events, cursors[i] = nest.GetEventsSince(device, cursors[i])
+                chunks[i].append(events)
+
+    for device, cursor, device_chunks in zip(devices, cursors, chunks):
+        assert len(cursor) == num_threads
+        assert sum(len(chunk["times"]) for chunk in device_chunks) == device.n_events
+        assert all(len(chunk["times"]) > 0 for chunk in device_chunks)
+        _assert_events_equal(_concatenate(device_chunks), device.events)
+
+    # nothing new without simulation
+    events, _ = nest.GetEventsSince(devices[0], cursors[0])
+    assert len(events["times"]) == 0
+
+
+def test_events_removed_from_memory():
+    """Test that the cursor stays valid if events are removed from memory."""
+
+    sr, _ = _build(1)
+    nest.Simulate(50.0)
+    _, cursor = nest.GetEventsSince(sr)
+
+    # events removed after they were read are not returned again
+    sr.n_events = 0
+    nest.Simulate(50.0)
+    events, cursor = nest.GetEventsSince(sr, cursor)
+    assert len(events["times"]) > 0
+    nptest.assert_allclose(events["times"], sr.events["times"])
+
+    # events removed before they were read are lost
+    nest.Simulate(50.0)
+    sr.n_events = 0
+    nest.Simulate(50.0)
+    events, _ = nest.GetEventsSince(sr, cursor)
+    assert len(events["times"]) > 0
+    nptest.assert_allclose(events["times"], sr.events["times"])
+    assert np.all(events["times"] > 150.0)
+
+
+def test_errors():
+    """Test that invalid recorders and cursors are rejected."""
+
+    sr, _ = _build(1)
+    neuron = nest.Create("iaf_psc_alpha")
+    sr_ascii = nest.Create("spike_recorder", params={"record_to": "ascii"})
+
+    with pytest.raises(nest.kernel.NESTError):
+        nest.GetEventsSince(neuron)
+    with pytest.raises(nest.kernel.NESTError):
+        nest.GetEventsSince(sr_ascii)
+    with pytest.raises(nest.kernel.NESTError):
+        nest.GetEventsSince(sr, (0, 0, 0))
+    with pytest.raises(TypeError):
+        nest.GetEventsSince(sr + sr_ascii)
@@ -20,6 +20,7 @@
 # along with NEST.  If not, see <http://www.gnu.org/licenses/>.
 
 import nest
+import numpy as np
 import numpy.testing as nptest
 import pytest
 
@@ -126,3 +127,198 @@ def test_identical_recording_from_multiple_multimeters(model):
 
     for recordable in recordables:
         nptest.assert_array_equal(mm1.events[recordable], mm2.events[recordable])
+
+
+def _sorted_events(mm):
+    events = mm.events
+    order = np.lexsort((events["senders"], events["times"]))
+    return {key: np.asarray(value)[order] for key, value in events.items()}
+
+
+def _assert_pushed_equal_pulled(pushed, pulled, keys, simtime, interval):
+    """
+    Compare pushed with requested samples, which lack the samples of the last time slice.
+    """
+
+    last = pulled["times"].max()
+    earlier = pushed["times"] <= last
+    for key in keys:
+        nptest.assert_array_equal(pushed[key][earlier], pulled[key])
+
+    assert simtime - interval < pushed["times"].max() <= simtime
+    final = pushed["times"] == pushed["times"].max()
+    nptest.assert_array_equal(pushed["senders"][final], pulled["senders"][pulled["times"] == last])
+
+
+@pytest.mark.parametrize("model", all_models_with_rec)
+def test_pushed_samples_equal_requested_samples(model):
+    """
+    Test that a multimeter that has samples pushed records the same data as one requesting them.
+    """
+
+    nrn = nest.Create(model)
+    if "compartments" in nest.GetDefaults(model):
+        nrn.compartments = {"parent_idx": -1}
+
+    recordables = nrn.recordables
+    mm_pull = nest.Create("multimeter", {"record_from": recordables})
+    mm_push = nest.Create("multimeter", {"record_from": recordables, "push_samples": True})
+
+    nest.Connect(mm_pull, nrn)
+    nest.Connect(mm_push, nrn)
+
+    nest.Simulate(10.0)
+
+    pulled = _sorted_events(mm_pull)
+    pushed = _sorted_events(mm_push)
+    _assert_pushed_equal_pulled(pushed, pulled, ["senders", "times"] + list(recordables), 10.0, 1.0)
+    assert mm_push.n_events == len(pushed["times"])
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+@pytest.mark.parametrize("record_to", ["memory", "ascii"])
+@pytest.mark.parametrize("interval", [0.3, 1.0, 2.5])
+def test_pushed_samples_of_many_nodes(tmp_path, num_threads, record_to, interval):
+    """
+    Test pushed samples for several nodes, threads, intervals and repeated simulations, including frozen nodes.
+    """
+
+    # files are opened anew for each simulation
+    nest.set(local_num_threads=num_threads, data_path=str(tmp_path), overwrite_files=True)
+
+    nrns = nest.Create("iaf_psc_alpha", 7, params={"I_e": np.linspace(300.0, 500.0, 7)})
+    nrns[2].frozen = True
+    params = {"record_from": ["V_m", "I_syn_ex"], "interval": interval}
+    mm_pull = nest.Create("multimeter", params)
+    mm_push = nest.Create("multimeter", dict(params, push_samples=True, record_to=record_to))
+
+    nest.Connect(mm_pull, nrns)
+    nest.Connect(mm_push, nrns)
+
+    nest.Simulate(12.3)
+    nest.Simulate(7.7)
+
+    pulled = _sorted_events(mm_pull)
+    assert 2 not in set(pulled["senders"] - nrns[0].global_id)
+
+    if record_to == "memory":
+        pushed = _sorted_events(mm_push)
+        _assert_pushed_equal_pulled(pushed, pulled, ["senders", "times", "V_m", "I_syn_ex"], 20.0, interval)
+    else:
+        # pushed samples include those of the last time slice
+        num_times = int(np.floor(20.0 / interval + 1e-9))
+        missing = num_times - len(np.unique(pulled["times"]))
+        assert mm_push.n_events == len(pulled["senders"]) + missing * (len(nrns) - 1)
+
+
+def test_push_samples_fixed_after_connect():
+    """
+    Ensure that push_samples cannot be changed once the multimeter is connected.
+    """
+
+    mm = nest.Create("multimeter", {"record_from": ["V_m"]})
+    assert not mm.push_samples
+    nest.Connect(mm, nest.Create("iaf_psc_alpha"))
+
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        mm.push_samples = True
+
+
+def _record_population(num_threads, processing_params):
+    """
+    Return all pushed samples and processed samples of a population.
+    """
+
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads)
+
+    nrns = nest.Create("iaf_psc_alpha", 20, params={"I_e": np.linspace(200.0, 600.0, 20)})
+    params = {"record_from": ["V_m", "I_syn_ex"], "interval": 0.5, "push_samples": True}
+    mm_all = nest.Create("multimeter", params)
+    mm_processed = nest.Create("multimeter", dict(params, **processing_params))
+
+    nest.Connect(mm_all, nrns)
+    nest.Connect(mm_processed, nrns)
+
+    nest.Simulate(30.0)
+    nest.Simulate(20.0)
+
+    return _sorted_events(mm_all), _sorted_events(mm_processed), mm_processed.global_id
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_reductions_across_targets(num_threads):
+    """
+    Test that reductions equal the statistics of the samples of all targets.
+    """
+
+    reductions = ["mean", "variance", "min", "max"]
+    samples, reduced, mm_id = _record_population(num_threads, {"reductions": reductions})
+
+    assert set(reduced["senders"]) == {mm_id}
+    nptest.assert_allclose(reduced["times"], np.arange(0.5, 50.1, 0.5))
+    nptest.assert_array_equal(reduced["times"], np.unique(samples["times"]))
+
+    for recordable in ["V_m", "I_syn_ex"]:
+        for reduction, func in zip(reductions, [np.mean, np.var, np.min, np.max]):
+            expected = [func(samples[recordable][samples["times"] == t]) for t in reduced["times"]]
+            nptest.assert_allclose(reduced[f"{recordable}_{reduction}"], expected, atol=1e-9)
+
+
+def test_decimation_and_filter():
+    """
+    Test that decimated samples are taken from the low-pass filtered samples of each target.
+    """
+
+    tau, decimation = 2.0, 4
+    samples, pushed, _ = _record_population(1, {"decimation": decimation, "filter_tau": tau})
+
+    decay = np.exp(-0.5 / tau)
+    for sender in np.unique(samples["senders"]):
+        samples_of_sender = samples["senders"] == sender
+        times = samples["times"][samples_of_sender]
+        keep = np.isclose(np.round(times / 0.5) % decimation, 0)
+        for recordable in ["V_m", "I_syn_ex"]:
+            filtered = np.empty(samples_of_sender.sum())
+            filtered[0] = samples[recordable][samples_of_sender][0]
+            for i, x in enumerate(samples[recordable][samples_of_sender][1:], start=1):
+                filtered[i] = decay * filtered[i - 1] + (1 - decay) * x
+            nptest.assert_allclose(pushed[recordable][pushed["senders"] == sender], filtered[keep])
+
+
+def test_subset_is_deterministic(have_threads):
+    """
+    Test that the recorded subset of targets depends only on fraction and seed.
+    """
+
+    params = {"subset_fraction": 0.5, "subset_seed": 7}
+    samples, pushed, _ = _record_population(1, params)
+    senders = set(pushed["senders"])
+    assert 0 < len(senders) < 20
+
+    for sender in senders:
+        nptest.assert_array_equal(
+            pushed["V_m"][pushed["senders"] == sender], samples["V_m"][samples["senders"] == sender]
+        )
+
+    if have_threads:
+        _, pushed_threaded, _ = _record_population(2, params)
+        assert set(pushed_threaded["senders"]) == senders
+
+    _, pushed_other_seed, _ = _record_population(1, dict(params, subset_seed=8))
+    assert set(pushed_other_seed["senders"]) != senders
+
+
+def test_reductions_require_push_samples():
+    """
+    Ensure that reductions and related options are only accepted together with push_samples.
+    """
+
+    mm = nest.Create("multimeter")
+
+    for params in [{"reductions": ["mean"]}, {"decimation": 2}, {"filter_tau": 1.0}, {"subset_fraction": 0.5}]:
+        with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+            mm.set(params)
+
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        mm.set(push_samples=True, reductions=["median"])
@@ -0,0 +1,143 @@
+# -*- coding: utf-8 -*-
+#
+# test_node_collection_get_set_array.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test bulk access to node parameters with ``NodeCollection.get_array`` and ``NodeCollection.set_array``.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def reset_kernel():
+    nest.ResetKernel()
+
+
+def test_get_array_matches_get():
+    """Test that get_array returns the same values as get."""
+
+    nodes = nest.Create("iaf_psc_alpha", 5, params={"V_m": nest.random.uniform(-75.0, -60.0)})
+
+    nptest.assert_array_equal(nodes.get_array("V_m"), nodes.get("V_m"))
+    nptest.assert_array_equal(nodes.get_array("global_id", dtype=int), nodes.get("global_id"))
+
+
+def test_get_array_of_composite_collection():
+    """Test that get_array handles collections of different models."""
+
+    nodes = nest.Create("iaf_psc_alpha", 3) + nest.Create("iaf_psc_exp", 2)
+    nodes[3:].set(C_m=100.0)
+
+    nptest.assert_array_equal(nodes.get_array("C_m"), [250.0, 250.0, 250.0, 100.0, 100.0])
+
+
+def test_set_array():
+    """Test that set_array sets one value per node."""
+
+    nodes = nest.Create("iaf_psc_alpha", 4)
+    values = np.array([-70.0, -65.0, -60.0, -58.0])
+    nodes.set_array("V_m", values)
+
+    nptest.assert_array_equal(nodes.get("V_m"), values)
+
+
+def test_get_array_node_properties():
+    """Test that get_array reads properties common to all nodes."""
+
+    nodes = nest.Create("iaf_psc_alpha", 3) + nest.Create("spike_recorder")
+    nodes[1].frozen = True
+
+    nptest.assert_array_equal(nodes.get_array("global_id", dtype=int), [1, 2, 3, 4])
+    nptest.assert_array_equal(nodes.get_array("frozen", dtype=int), [0, 1, 0, 0])
+
+
+def test_get_array_dtype():
+    """Test that get_array returns an array of the requested type that owns its data."""
+
+    nodes = nest.Create("iaf_psc_alpha", 3)
+
+    values = nodes.get_array("global_id", dtype=int)
+    assert values.dtype == np.dtype(int)
+    assert values.flags.owndata
+
+    with pytest.raises(TypeError):
+        nodes.get_array("V_m", dtype=np.float32)
+
+
+@pytest.mark.parametrize("model", ["iaf_psc_alpha", "iaf_psc_exp", "iaf_psc_delta", "iaf_psc_alpha_ps"])
+def test_set_array_membrane_potential(model):
+    """Test that set_array sets the membrane potential relative to the resting potential of each node."""
+
+    nodes = nest.Create(model, 3, params={"E_L": -65.0})
+    nodes[2].E_L = -60.0
+    values = np.array([-70.0, -64.0, -55.5])
+    nodes.set_array("V_m", values)
+
+    nptest.assert_array_equal(nodes.get_array("V_m"), values)
+    nptest.assert_array_equal(nodes.get("V_m"), values)
+
+
+def test_get_set_array_several_keys():
+    """Test that get_array and set_array handle a list of keys with one row per key."""
+
+    nodes = nest.Create("iaf_psc_alpha", 3) + nest.Create("iaf_psc_exp", 2)
+    values = np.array([[-70.0, -69.0, -68.0, -67.0, -66.0], [1.0, 2.0, 3.0, 4.0, 5.0]])
+    nodes.set_array(["V_m", "I_e"], values)
+
+    result = nodes.get_array(["V_m", "I_e", "global_id"])
+    assert result.shape == (3, 5)
+    assert result.flags.owndata
+    nptest.assert_array_equal(result[:2], values)
+    nptest.assert_array_equal(result[2], [1, 2, 3, 4, 5])
+    nptest.assert_array_equal(nodes.get("I_e"), values[1])
+
+
+def test_set_array_wrong_length():
+    """Test that set_array requires one value per node."""
+
+    nodes = nest.Create("iaf_psc_alpha", 4)
+
+    with pytest.raises(ValueError):
+        nodes.set_array("V_m", np.zeros(3))
+
+    with pytest.raises(ValueError):
+        nodes.set_array(["V_m", "I_e"], np.zeros(4))
+
+
+def test_get_array_unknown_key():
+    """Test that get_array fails for unknown parameters."""
+
+    nodes = nest.Create("iaf_psc_alpha", 2)
+
+    with pytest.raises(nest.kernel.NESTError):
+        nodes.get_array("no_such_parameter")
+
+
+def test_get_array_non_numeric():
+    """Test that get_array fails for non-numeric parameters."""
+
+    nodes = nest.Create("iaf_psc_alpha", 2)
+
+    with pytest.raises(nest.kernel.NESTError):
+        nodes.get_array("recordables")
@@ -0,0 +1,69 @@
+# -*- coding: utf-8 -*-
+#
+# test_poisson_generator_bulk_draws.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test spike count statistics of poisson_generator with bulk_draws.
+
+Spike counts per target are Poisson distributed, so mean and variance must both match
+rate * simulation time. Low rates exercise drawing the total count per slice and
+distributing it, high rates drawing counts for each target and step in bulk.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+
+@pytest.mark.parametrize("rate", [50.0, 30000.0])
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_bulk_draws_spike_count_statistics(rate, num_threads, have_threads):
+    if num_threads > 1 and not have_threads:
+        pytest.skip("skipped because missing multithreading support.")
+
+    n_parrots = 400
+    sim_time = 1000.0
+
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads, resolution=0.1)
+    pg = nest.Create("poisson_generator", params={"rate": rate, "bulk_draws": True})
+    parrots = nest.Create("parrot_neuron", n_parrots)
+    sr = nest.Create("spike_recorder")
+    nest.Connect(pg, parrots)
+    nest.Connect(parrots, sr)
+
+    nest.Simulate(sim_time + 2.0)
+
+    senders = sr.events["senders"]
+    counts = np.bincount(senders - parrots[0].global_id, minlength=n_parrots)
+    expected = rate * sim_time * 1e-3
+
+    # mean over targets within five standard errors, Fano factor close to one
+    assert np.mean(counts) == pytest.approx(expected, abs=5 * np.sqrt(expected / n_parrots))
+    assert np.var(counts) / np.mean(counts) == pytest.approx(1.0, abs=0.25)
+
+    # targets receive different spike trains
+    assert len(np.unique(counts)) > 1
+
+
+def test_bulk_draws_default_off():
+    nest.ResetKernel()
+    pg = nest.Create("poisson_generator")
+    assert not pg.bulk_draws
@@ -0,0 +1,85 @@
+# -*- coding: utf-8 -*-
+#
+# test_rate_matrix.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that delivering instantaneous rate connections by rate matrices gives the same rates as delivering events.
+"""
+
+import nest
+import numpy.testing as nptest
+import pytest
+
+
+def _simulate(use_rate_matrix, num_threads, model, linear_summation=True):
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads, resolution=0.1, use_wfr=True, rng_seed=123)
+    nest.use_rate_matrix = use_rate_matrix
+
+    nest.CopyModel("rate_connection_instantaneous", "rate_copy")
+
+    neurons = nest.Create(model, 12, params={"linear_summation": linear_summation})
+    drive = nest.Create("lin_rate_ipn", 3, params={"mu": 1.0, "sigma": 0.5})
+    transformers = nest.Create("rate_transformer_tanh", 4, params={"linear_summation": linear_summation})
+    mm = nest.Create("multimeter", params={"record_from": ["rate"], "interval": 0.1})
+
+    conn_spec = {"rule": "fixed_indegree", "indegree": 4}
+    nest.Connect(drive, neurons, conn_spec, {"synapse_model": "rate_connection_instantaneous", "weight": 0.4})
+    nest.Connect(
+        neurons,
+        neurons,
+        conn_spec,
+        {"synapse_model": "rate_connection_instantaneous", "weight": nest.random.uniform(-0.3, 0.3)},
+    )
+    nest.Connect(neurons, transformers, conn_spec, {"synapse_model": "rate_copy", "weight": -0.2})
+    nest.Connect(transformers, neurons, "all_to_all", {"synapse_model": "rate_copy", "weight": 0.1})
+    nest.Connect(mm, neurons + transformers)
+
+    nest.Simulate(20.0)
+    # weights changed between runs are taken into account
+    conns = nest.GetConnections(synapse_model="rate_copy")
+    conns.weight = 0.05
+    nest.Simulate(20.0)
+
+    return mm.events
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+@pytest.mark.parametrize("model", ["tanh_rate_ipn", "tanh_rate_opn", "lin_rate_ipn"])
+@pytest.mark.parametrize("linear_summation", [True, False])
+def test_same_rates_as_events(num_threads, model, linear_summation):
+    """Test that rates are identical with and without rate matrices."""
+
+    expected = _simulate(False, num_threads, model, linear_summation)
+    actual = _simulate(True, num_threads, model, linear_summation)
+
+    for name in ["senders", "times", "rate"]:
+        nptest.assert_array_equal(actual[name], expected[name])
+
+
+def test_default():
+    """Test that rate matrices are disabled by default and reset with the kernel."""
+
+    nest.ResetKernel()
+    assert not nest.use_rate_matrix
+    nest.use_rate_matrix = True
+    assert nest.use_rate_matrix
+    nest.ResetKernel()
+    assert not nest.use_rate_matrix
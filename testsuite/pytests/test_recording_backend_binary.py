@@ -0,0 +1,130 @@
+# -*- coding: utf-8 -*-
+#
+# test_recording_backend_binary.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the binary recording backend records the same data as the memory backend.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def prepare_kernel():
+    nest.ResetKernel()
+
+
+def _record(data_path, recorder_model, record_to, params, num_threads):
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads, data_path=str(data_path), overwrite_files=True)
+
+    neurons = nest.Create("iaf_psc_alpha", 4, params={"I_e": 500.0})
+    pg = nest.Create("poisson_generator", params={"rate": 20000.0})
+    recorder = nest.Create(recorder_model, params=dict(params, record_to=record_to))
+
+    nest.Connect(pg, neurons, syn_spec={"weight": 50.0})
+    if recorder_model == "spike_recorder":
+        nest.Connect(neurons, recorder)
+    else:
+        nest.Connect(recorder, neurons)
+
+    # the second simulation appends to the files of the first
+    nest.Simulate(50.0)
+    nest.Simulate(50.0)
+
+    return recorder
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+@pytest.mark.parametrize(
+    "recorder_model, params",
+    [
+        ("spike_recorder", {}),
+        ("multimeter", {"record_from": ["V_m", "I_syn_ex"], "interval": 0.5}),
+    ],
+)
+@pytest.mark.parametrize("buffer_size", [3, 16384])
+def test_binary_matches_memory(tmp_path, num_threads, recorder_model, params, buffer_size):
+    """Test that data read back from binary files equals the data of the memory backend."""
+
+    expected = _record(tmp_path, recorder_model, "memory", params, num_threads).get("events")
+
+    recorder = _record(tmp_path, recorder_model, "binary", dict(params, buffer_size=buffer_size), num_threads)
+
+    filenames = recorder.get("filenames")
+
+    events = nest.ReadBinaryRecording(filenames)
+    order = np.lexsort((events["senders"], events["times"]))
+    expected_order = np.lexsort((expected["senders"], expected["times"]))
+
+    assert events["senders"].size > 0
+    for key in expected:
+        np.testing.assert_allclose(events[key][order], expected[key][expected_order])
+
+
+def test_files_are_kept_across_simulations(tmp_path):
+    """Test that files are appended to by later simulations, but not overwritten after ResetKernel."""
+
+    def simulate():
+        nest.set(data_path=str(tmp_path), overwrite_files=False)
+        sg = nest.Create("spike_generator", params={"spike_times": [10.0, 60.0]})
+        sr = nest.Create("spike_recorder", params={"record_to": "binary"})
+        nest.Connect(sg, sr)
+        nest.Simulate(50.0)
+        return sr
+
+    sr = simulate()
+    nest.Simulate(50.0)
+    np.testing.assert_allclose(nest.ReadBinaryRecording(sr.get("filenames"))["times"], [10.0, 60.0])
+
+    nest.ResetKernel()
+    with pytest.raises(nest.kernel.NESTErrors.IOError):
+        simulate()
+
+
+def test_binary_device_defaults():
+    """Test the device properties of the binary backend."""
+
+    sr = nest.Create("spike_recorder", params={"record_to": "binary"})
+
+    assert sr.get("buffer_size") == 16384
+    assert sr.get("file_extension") == "bin"
+
+    sr.set(buffer_size=10)
+    assert sr.get("buffer_size") == 10
+
+    with pytest.raises(nest.kernel.NESTError):
+        sr.set(buffer_size=0)
+
+
+def test_io_statistics(tmp_path):
+    """Test that data written through the I/O thread is reported in the kernel status."""
+
+    assert nest.io_bytes_written == 0
+
+    _record(tmp_path, "spike_recorder", "binary", {"buffer_size": 10}, 1)
+
+    assert nest.io_bytes_written > 0
+    assert nest.time_io_blocked >= 0.0
+
+    nest.io_buffer_size = 1024
+    assert nest.io_buffer_size == 1024
@@ -122,6 +122,55 @@ class TestRecordingBackendMemory(unittest.TestCase):
         with self.assertRaises(nest.kernel.NESTErrors.BadProperty):
             mm.time_in_steps = False
 
+    def testClearOnRead(self):
+        """Test that clear_on_read hands over each event exactly once."""
+
+        for num_threads in [1, 2]:
+            nest.ResetKernel()
+            nest.local_num_threads = num_threads
+
+            mm = nest.Create("multimeter", params={"record_to": "memory", "clear_on_read": True})
+            mm.set({"interval": 0.1, "record_from": ["V_m"]})
+            nest.Connect(mm, nest.Create("iaf_psc_alpha", 2))
+            self.assertTrue(mm.get("clear_on_read"))
+
+            nest.Simulate(15)
+            times = mm.get("events")["times"]
+            self.assertEqual(times.size, 280)
+            self.assertEqual(mm.get("events")["times"].size, 0)
+
+            nest.Simulate(1)
+            events = mm.get("events")
+            self.assertEqual(events["times"].size, 20)
+            self.assertEqual(events["V_m"].size, 20)
+            self.assertTrue(min(events["times"]) > max(times))
+
+            # n_events still counts all events recorded
+            self.assertEqual(mm.get("n_events"), 300)
+
+    def testEventsAreIndependent(self):
+        """Test that arrays obtained from events do not change when recording continues."""
+
+        nest.ResetKernel()
+
+        pg = nest.Create("poisson_generator", params={"rate": 10000.0})
+        parrot = nest.Create("parrot_neuron")
+        sr = nest.Create("spike_recorder")
+        nest.Connect(pg, parrot)
+        nest.Connect(parrot, sr)
+
+        nest.Simulate(10)
+        senders = sr.get("events")["senders"]
+        senders[:] = 0
+        self.assertTrue(all(sr.get("events")["senders"] == parrot.global_id))
+
+        times = sr.get("events")["times"].copy()
+        times_view = sr.get("events")["times"]
+        nest.Simulate(10)
+        self.assertEqual(list(times_view), list(times))
+        self.assertTrue(sr.get("events")["times"].size > times.size)
+        self.assertEqual(senders.size, times.size)
+
 
 def suite():
     suite = unittest.TestLoader()
@@ -0,0 +1,199 @@
+# -*- coding: utf-8 -*-
+#
+# test_recording_backend_shm.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the shm recording backend streams the same data as the memory backend records.
+"""
+
+import os
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+pytestmark = pytest.mark.skipif("shm" not in nest.recording_backends, reason="shm backend not available")
+
+SEGMENT_NAME = f"/nest_test_shm_{os.getpid()}"
+
+
+@pytest.fixture(autouse=True)
+def prepare_kernel():
+    nest.ResetKernel()
+    nest.SetDefaults("shm", {"segment_name": SEGMENT_NAME})
+    yield
+    # removes the segment
+    nest.ResetKernel()
+
+
+def _sorted_events(events):
+    order = np.lexsort((events["senders"], events["times"]))
+    return {name: np.asarray(values)[order] for name, values in events.items()}
+
+
+def _build(num_threads, record_to, mm_params):
+    nest.set(local_num_threads=num_threads)
+
+    neurons = nest.Create("iaf_psc_alpha", 6, params={"I_e": 500.0})
+    pg = nest.Create("poisson_generator", params={"rate": 20000.0})
+    sr = nest.Create("spike_recorder", params={"record_to": record_to})
+    mm = nest.Create("multimeter", params=dict(mm_params, record_from=["V_m", "I_syn_ex"], record_to=record_to))
+
+    nest.Connect(pg, neurons, syn_spec={"weight": 50.0})
+    nest.Connect(neurons, sr)
+    nest.Connect(mm, neurons)
+
+    return sr, mm
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+@pytest.mark.parametrize("overflow", ["drop", "block"])
+@pytest.mark.parametrize("push_samples", [False, True])
+def test_same_data_as_memory_backend(num_threads, overflow, push_samples):
+    """Test that spikes and samples read from the segment equal those recorded in memory."""
+
+    mm_params = {"interval": 0.5, "push_samples": push_samples}
+
+    sr_mem, mm_mem = _build(num_threads, "memory", mm_params)
+    nest.Simulate(50.0)
+    nest.Simulate(50.0)
+    expected_spikes, expected_samples = sr_mem.events, mm_mem.events
+
+    nest.ResetKernel()
+    nest.SetDefaults("shm", {"segment_name": SEGMENT_NAME, "overflow": overflow})
+    sr, mm = _build(num_threads, "shm", mm_params)
+
+    nest.Simulate(50.0)
+    with nest.ShmStreamReader() as reader:
+        assert not reader.running
+        first = reader.read()
+        assert reader.devices == {sr.global_id: "spike_recorder", mm.global_id: "multimeter"}
+
+        nest.Simulate(50.0)
+        second = reader.read()
+        assert reader.dropped == 0
+
+    spikes, samples = (
+        {name: np.concatenate([first[device][name], second[device][name]]) for name in first[device]}
+        for device in [sr.global_id, mm.global_id]
+    )
+
+    for actual, expected in [(spikes, expected_spikes), (samples, expected_samples)]:
+        actual, expected = _sorted_events(actual), _sorted_events(expected)
+        assert actual.keys() == expected.keys()
+        for name in expected:
+            nptest.assert_allclose(actual[name], expected[name])
+
+    assert nest.GetDefaults("shm", "dropped") == 0
+
+
+def test_drop_when_ring_is_full():
+    """Test that records are dropped and counted if no reader empties the ring."""
+
+    sr_mem, _ = _build(1, "memory", {})
+    nest.Simulate(200.0)
+    expected = sr_mem.events
+
+    nest.ResetKernel()
+    nest.SetDefaults("shm", {"segment_name": SEGMENT_NAME, "ring_size": 4096})
+    sr, mm = _build(1, "shm", {})
+    nest.Simulate(200.0)
+
+    dropped = nest.GetDefaults("shm", "dropped")
+    assert dropped > 0
+
+    with nest.ShmStreamReader() as reader:
+        assert reader.dropped == dropped
+        events = reader.read()
+
+    # the spikes in the segment are the first spikes recorded
+    spikes = events[sr.global_id]
+    n_spikes = len(spikes["times"])
+    assert 0 < n_spikes < len(expected["times"])
+    nptest.assert_array_equal(spikes["senders"], expected["senders"][:n_spikes])
+    nptest.assert_allclose(spikes["times"], expected["times"][:n_spikes])
+
+
+def _record_weights(record_to):
+    neurons = nest.Create("parrot_neuron", 4)
+    sg = nest.Create("spike_generator", params={"spike_times": np.arange(1.0, 80.0, 0.7)})
+    wr = nest.Create("weight_recorder", params={"record_to": record_to})
+    nest.CopyModel("static_synapse", "static_synapse_wr", {"weight_recorder": wr})
+
+    nest.Connect(sg, neurons[:2])
+    nest.Connect(neurons[:2], neurons[2:], syn_spec={"synapse_model": "static_synapse_wr", "weight": 2.5})
+    nest.Simulate(100.0)
+    return wr
+
+
+def test_events_with_integer_values():
+    """Test that events with floating point and integer values are read back in bulk."""
+
+    expected = _record_weights("memory").events
+
+    nest.ResetKernel()
+    nest.SetDefaults("shm", {"segment_name": SEGMENT_NAME})
+    wr = _record_weights("shm")
+    with nest.ShmStreamReader() as reader:
+        events = reader.read()[wr.global_id]
+
+    assert events.keys() == expected.keys()
+    assert len(events["times"]) > 100
+    for name in expected:
+        nptest.assert_allclose(events[name], expected[name])
+    assert events["targets"].dtype == np.int64
+
+
+@pytest.mark.parametrize("overflow", ["drop", "block"])
+def test_records_larger_than_half_ring(overflow):
+    """Test that records that never fit are dropped or raise an error instead of blocking forever."""
+
+    nest.SetDefaults("shm", {"segment_name": SEGMENT_NAME, "ring_size": 4096, "overflow": overflow})
+    nest.Create("spike_recorder", params={"record_to": "shm", "label": 3000 * "x"})
+
+    if overflow == "drop":
+        nest.Simulate(10.0)
+        assert nest.GetDefaults("shm", "dropped") == 1
+    else:
+        with pytest.raises(nest.kernel.NESTError):
+            nest.Simulate(10.0)
+
+
+def test_properties():
+    """Test that invalid backend properties are rejected."""
+
+    defaults = nest.GetDefaults("shm")
+    assert defaults["ring_size"] == 4194304
+    assert defaults["overflow"] == "drop"
+    assert defaults["dropped"] == 0
+
+    for params in [
+        {"ring_size": 5000},
+        {"ring_size": 1024},
+        {"overflow": "wait"},
+        {"segment_name": "nest_stream"},
+        {"segment_name": "/nest/stream"},
+    ]:
+        with pytest.raises(nest.kernel.NESTError):
+            nest.SetDefaults("shm", params)
+
+    with pytest.raises(FileNotFoundError):
+        nest.ShmStreamReader()
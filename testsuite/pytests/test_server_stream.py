@@ -0,0 +1,188 @@
+# -*- coding: utf-8 -*-
+#
+# test_server_stream.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test the ``/stream`` route of NEST Server and the binary frames it sends.
+"""
+
+import struct
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+pytest.importorskip("flask")
+pytest.importorskip("flask_cors")
+pytest.importorskip("RestrictedPython")
+
+ACCESS_TOKEN = "test-stream-token"
+HEADERS = {"NESTServerAuth": ACCESS_TOKEN}
+
+
+@pytest.fixture(scope="module")
+def server():
+    with pytest.MonkeyPatch.context() as mp:
+        mp.setenv("NEST_SERVER_ACCESS_TOKEN", ACCESS_TOKEN)
+        from nest.server import hl_api_server
+
+    # the server removes its reference to the app with the first request
+    return hl_api_server, hl_api_server.app.test_client()
+
+
+@pytest.fixture(autouse=True)
+def reset_kernel():
+    nest.ResetKernel()
+
+
+def _decode_frames(data):
+    """Decode a stream of frames into a list of (recorder, time, events) tuples."""
+
+    frames = []
+    position = 0
+    while position < len(data):
+        (length,) = struct.unpack_from("<I", data, position)
+        position += 4
+        end = position + length
+
+        recorder, time_, n_events, n_columns = struct.unpack_from("<qdII", data, position)
+        position += struct.calcsize("<qdII")
+        events = {}
+        for _ in range(n_columns):
+            (name_length,) = struct.unpack_from("<B", data, position)
+            name = data[position + 1 : position + 1 + name_length].decode()
+            code = data[position + 1 + name_length : position + 2 + name_length].decode()
+            position += 2 + name_length
+            events[name] = np.frombuffer(data, dtype="<" + code, count=n_events, offset=position)
+            position += 8 * n_events
+
+        assert position == end
+        frames.append((recorder, time_, events))
+
+    return frames
+
+
+def _spiking_network():
+    sg = nest.Create("spike_generator", params={"spike_times": np.arange(1.0, 60.0, 3.0)})
+    parrots = nest.Create("parrot_neuron", 2)
+    sr = nest.Create("spike_recorder")
+    nest.Connect(sg, parrots)
+    nest.Connect(parrots, sr)
+    return parrots, sr
+
+
+def test_encode_events_frame_format(server):
+    """Test the layout of a single frame."""
+
+    hl_api_server, _ = server
+    events = {"senders": np.array([3, 4]), "times": np.array([1.5, 2.5]), "V_m": np.array([-70.0, -65.0])}
+    frame = hl_api_server.encode_events(7, 12.5, events)
+
+    (length,) = struct.unpack_from("<I", frame)
+    assert length == len(frame) - 4
+    assert struct.unpack_from("<qdII", frame, 4) == (7, 12.5, 2, 3)
+
+    column = frame[4 + struct.calcsize("<qdII") :]
+    assert column[:9] == b"\x07sendersq"
+    nptest.assert_array_equal(np.frombuffer(column, dtype="<i8", count=2, offset=9), [3, 4])
+
+    [(recorder, time_, decoded)] = _decode_frames(frame)
+    assert (recorder, time_) == (7, 12.5)
+    assert list(decoded) == ["senders", "times", "V_m"]
+    assert decoded["senders"].dtype == np.dtype("<i8")
+    assert decoded["times"].dtype == np.dtype("<f8")
+    for name, values in events.items():
+        nptest.assert_array_equal(decoded[name], values)
+
+
+def test_encode_events_without_events(server):
+    """Test that a frame without events has empty columns."""
+
+    hl_api_server, _ = server
+    [(recorder, time_, decoded)] = _decode_frames(hl_api_server.encode_events(3, 5.0, {"senders": [], "times": []}))
+
+    assert (recorder, time_) == (3, 5.0)
+    assert all(len(values) == 0 for values in decoded.values())
+
+
+def test_stream_sends_new_events_per_interval(server):
+    """Test that each frame holds the events recorded in its interval, but no events from before the request."""
+
+    _, client = server
+    parrots, sr = _spiking_network()
+    nest.Simulate(10.0)
+    n_before = sr.n_events
+
+    response = client.post("/stream", json={"t": 20.0, "interval": 5.0, "recorders": [sr.global_id]}, headers=HEADERS)
+    assert response.status_code == 200
+    assert response.mimetype == "application/octet-stream"
+    frames = _decode_frames(response.get_data())
+
+    assert [recorder for recorder, _, _ in frames] == [sr.global_id] * 4
+    nptest.assert_allclose([time_ for _, time_, _ in frames], [15.0, 20.0, 25.0, 30.0])
+    for _, time_, events in frames:
+        assert np.all((events["times"] > time_ - 5.0) & (events["times"] <= time_))
+
+    expected = sr.events
+    streamed = {name: np.concatenate([events[name] for _, _, events in frames]) for name in expected}
+    assert len(streamed["times"]) == sr.n_events - n_before > 0
+    for name, values in expected.items():
+        nptest.assert_array_equal(streamed[name], values[n_before:])
+
+
+def test_stream_cursors_of_several_recorders(server):
+    """Test that repeated requests continue where the previous request ended, separately for each recorder."""
+
+    _, client = server
+    parrots, sr = _spiking_network()
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 2.0})
+    nest.Connect(mm, nest.Create("iaf_psc_alpha", params={"I_e": 400.0}))
+
+    streamed = {sr.global_id: [], mm.global_id: []}
+    for t in [7.0, 13.0]:
+        query = {"t": t, "interval": 10.0, "recorders": f"{sr.global_id},{mm.global_id}"}
+        response = client.get("/stream", query_string=query, headers=HEADERS)
+        assert response.status_code == 200
+        for recorder, _, events in _decode_frames(response.get_data()):
+            streamed[recorder].append(events)
+
+    # the first request ends after a partial interval of 7 ms
+    assert len(streamed[sr.global_id]) == len(streamed[mm.global_id]) == 3
+
+    for recorder in [sr, mm]:
+        expected = recorder.events
+        for name, values in expected.items():
+            streamed_values = np.concatenate([events[name] for events in streamed[recorder.global_id]])
+            nptest.assert_array_equal(streamed_values, values)
+
+
+def test_stream_rejects_invalid_requests(server):
+    """Test that missing parameters and recorders that do not keep events are rejected before simulating."""
+
+    _, client = server
+    sr = nest.Create("spike_recorder", params={"record_to": "ascii"})
+
+    assert client.post("/stream", json={"t": 10.0}, headers=HEADERS).status_code == 400
+    assert client.post("/stream", json={"t": -1.0, "recorders": [sr.global_id]}, headers=HEADERS).status_code == 400
+    assert client.post("/stream", json={"t": 10.0, "recorders": [sr.global_id]}, headers=HEADERS).status_code == 400
+    assert nest.biological_time == 0.0
+
+    assert client.post("/stream", json={"t": 10.0, "recorders": [sr.global_id]}).status_code == 403
@@ -25,10 +25,10 @@ import nest
 
 __author__ = "sdiaz"
 
-# Structural plasticity currently does not work with multiple threads.
-# An exception should be rised if structural plasticity is enabled
-# and multiple threads are set, or if multiple threads are set and
-# the enable_structural_plasticity function is called.
+# Structural plasticity works with multiple threads, but the number of
+# threads has to be set before structural plasticity is configured. An
+# exception should be raised if the number of threads is changed after
+# structural plasticity has been enabled or its synapses have been set.
 
 HAVE_OPENMP = nest.ll_api.sli_func("is_threaded")
 
@@ -47,13 +47,21 @@ class TestEnableMultithread(unittest.TestCase):
         with self.assertRaises(nest.kernel.NESTError):
             nest.local_num_threads = 2
 
+    def test_sp_synapses_multithread(self):
+        nest.ResetKernel()
+        nest.structural_plasticity_synapses = {
+            "syn": {"synapse_model": "static_synapse", "pre_synaptic_element": "Axon", "post_synaptic_element": "Den"}
+        }
+        # Setting multiple threads when structural plasticity synapses have
+        # been set should throw an exception
+        with self.assertRaises(nest.kernel.NESTError):
+            nest.local_num_threads = 2
+
     def test_multithread_enable(self):
         nest.ResetKernel()
         nest.local_num_threads = 2
-        # Setting multiple threads when structural plasticity is enabled should
-        # throw an exception
-        with self.assertRaises(nest.kernel.NESTError):
-            nest.EnableStructuralPlasticity()
+        # Enabling structural plasticity with multiple threads is possible
+        nest.EnableStructuralPlasticity()
 
 
 def suite():
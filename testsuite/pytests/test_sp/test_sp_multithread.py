@@ -0,0 +1,68 @@
+# -*- coding: utf-8 -*-
+#
+# test_sp_multithread.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that structural plasticity creates and deletes the same synapses for any number of threads.
+"""
+
+import nest
+import pytest
+
+
+def _grow_network(num_threads):
+    """Let synapses grow in a network in which driven neurons lose synaptic elements again."""
+
+    nest.ResetKernel()
+    nest.set_verbosity("M_ERROR")
+    nest.local_num_threads = num_threads
+    nest.structural_plasticity_update_interval = 50.0
+
+    nest.CopyModel("static_synapse", "synapse_ex", {"weight": 1.0, "delay": 1.0})
+    nest.structural_plasticity_synapses = {
+        "synapse_ex": {"synapse_model": "synapse_ex", "pre_synaptic_element": "Axon", "post_synaptic_element": "Den"}
+    }
+
+    growth_curve = {"growth_curve": "linear", "growth_rate": 0.01, "eps": 0.05, "continuous": False}
+    neurons = nest.Create("iaf_psc_alpha", 30, params={"synaptic_elements": {"Axon": growth_curve, "Den": growth_curve}})
+    neurons[::3].I_e = 600.0
+
+    nest.EnableStructuralPlasticity()
+    nest.Simulate(2000.0)
+
+    conns = nest.GetConnections(synapse_model="synapse_ex")
+    connected = [(se["Axon"]["z_connected"], se["Den"]["z_connected"]) for se in neurons.synaptic_elements]
+    return sorted(zip(conns.source, conns.target)), connected
+
+
+@pytest.mark.skipif_missing_threads
+@pytest.mark.parametrize("num_threads", [2, 3])
+def test_sp_independent_of_threads(num_threads):
+    """Test that the synapses and connected synaptic elements agree with a single-threaded simulation."""
+
+    conns_single, connected_single = _grow_network(1)
+    conns, connected = _grow_network(num_threads)
+
+    assert len(conns_single) > 0
+    assert conns == conns_single
+    assert connected == connected_single
+
+    # each synapse occupies one element on either side
+    assert sum(axons for axons, _ in connected) == sum(dendrites for _, dendrites in connected) == len(conns)
@@ -0,0 +1,178 @@
+# -*- coding: utf-8 -*-
+#
+# test_spike_statistics_recorder.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the ``spike_statistics_recorder`` computes the same statistics as an offline analysis of recorded spikes.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def reset_kernel():
+    nest.ResetKernel()
+
+
+def _window_statistics(counts, isis, k, window_size, interval):
+    """Return rate, CV and Fano factor in the window ending with interval k."""
+
+    first = max(0, k - window_size + 1)
+    window_counts = counts[first : k + 1]
+    window_isis = np.concatenate(isis[first : k + 1])
+
+    rate = 1000.0 * window_counts.sum() / (len(window_counts) * interval)
+    mean = window_counts.mean()
+    fano = window_counts.var() / mean if mean > 0 else np.nan
+    cv = window_isis.std() / window_isis.mean() if len(window_isis) >= 2 else np.nan
+
+    return rate, cv, fano
+
+
+def _expected_statistics(events, senders, n_intervals, window_size, interval, resolution):
+    """Compute the statistics of recorded spikes for all sources and for the population."""
+
+    interval_steps = int(round(interval / resolution))
+    steps = np.round(events["times"] / resolution).astype(int)
+
+    per_source = {}
+    population_counts = np.zeros(n_intervals, dtype=int)
+    population_cvs = [[] for _ in range(n_intervals)]
+    for sender in senders:
+        source_steps = np.sort(steps[events["senders"] == sender])
+        source_bins = (source_steps - 1) // interval_steps
+        counts = np.bincount(source_bins, minlength=n_intervals)[:n_intervals]
+        population_counts += counts
+
+        isi = np.diff(source_steps) * resolution
+        isis = [isi[source_bins[1:] == k] for k in range(n_intervals)]
+
+        rows = []
+        for k in range(n_intervals):
+            rate, cv, fano = _window_statistics(counts, isis, k, window_size, interval)
+            rows.append((k, counts[k], rate, cv, fano))
+            if not np.isnan(cv):
+                population_cvs[k].append(cv)
+        per_source[sender] = rows
+
+    population = []
+    for k in range(n_intervals):
+        first = max(0, k - window_size + 1)
+        window_counts = population_counts[first : k + 1]
+        mean = window_counts.mean()
+        population.append(
+            (
+                k,
+                population_counts[k],
+                1000.0 * window_counts.sum() / (len(window_counts) * interval),
+                np.mean(population_cvs[k]) if population_cvs[k] else np.nan,
+                window_counts.var() / mean if mean > 0 else np.nan,
+            )
+        )
+
+    return per_source, population
+
+
+def _assert_rows(events, sender, expected, interval):
+    mask = events["senders"] == sender
+    order = np.argsort(events["times"][mask])
+    columns = ["times", "n_spikes", "rate", "cv_isi", "fano_factor"]
+    actual = {column: events[column][mask][order] for column in columns}
+    expected = dict(zip(columns, np.array(expected, dtype=float).T))
+    expected["times"] = (expected["times"] + 1) * interval
+
+    for column in columns:
+        nptest.assert_allclose(actual[column], expected[column], atol=1e-10)
+
+
+def test_regular_spike_train():
+    """Test the statistics of a single regular spike train."""
+
+    sg = nest.Create("spike_generator", params={"spike_times": np.arange(5.0, 1000.0, 10.0)})
+    parrot = nest.Create("parrot_neuron")
+    ssr = nest.Create("spike_statistics_recorder", params={"interval": 100.0, "window": 200.0})
+    nest.Connect(sg, parrot)
+    nest.Connect(parrot, ssr)
+
+    nest.Simulate(1000.0)
+
+    events = ssr.events
+    assert set(events["senders"]) == {ssr.global_id}
+    nptest.assert_allclose(events["times"], np.arange(100.0, 1001.0, 100.0))
+    nptest.assert_array_equal(events["n_spikes"], 10)
+    nptest.assert_allclose(events["rate"], 100.0)
+    nptest.assert_allclose(events["cv_isi"], 0.0, atol=1e-10)
+    nptest.assert_allclose(events["fano_factor"], 0.0, atol=1e-10)
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_matches_recorded_spikes(num_threads):
+    """Test that per-source and population statistics equal those of recorded spikes."""
+
+    nest.set(local_num_threads=num_threads, resolution=0.1)
+    interval, window = 50.0, 200.0
+
+    pg = nest.Create("poisson_generator", params={"rate": 30.0})
+    parrots = nest.Create("parrot_neuron", 6)
+    sr = nest.Create("spike_recorder")
+    ssr = nest.Create(
+        "spike_statistics_recorder", params={"interval": interval, "window": window, "per_source": True}
+    )
+    nest.Connect(pg, parrots)
+    nest.Connect(parrots, sr)
+    nest.Connect(parrots, ssr)
+
+    nest.Simulate(600.0)
+    assert ssr.events["times"].max() == 600.0
+    nest.Simulate(400.0)
+
+    n_intervals = 20
+    per_source, population = _expected_statistics(
+        sr.events, parrots.tolist(), n_intervals, int(window / interval), interval, nest.resolution
+    )
+
+    events = ssr.events
+    _assert_rows(events, ssr.global_id, population, interval)
+    for sender, expected in per_source.items():
+        # rows are only written for windows with spikes
+        _assert_rows(events, sender, [row for row in expected if not np.isnan(row[4])], interval)
+
+
+def test_interval_and_window_validation():
+    """Test that interval and window must be consistent and fixed after the simulation started."""
+
+    ssr = nest.Create("spike_statistics_recorder")
+
+    with pytest.raises(nest.kernel.NESTError):
+        ssr.set(window=150.0)
+
+    with pytest.raises(nest.kernel.NESTError):
+        ssr.set(interval=0.05)
+
+    ssr.set(interval=50.0, window=150.0)
+    assert ssr.get(["interval", "window", "per_source"]) == {"interval": 50.0, "window": 150.0, "per_source": False}
+
+    nest.Simulate(10.0)
+
+    with pytest.raises(nest.kernel.NESTError):
+        ssr.set(interval=10.0)
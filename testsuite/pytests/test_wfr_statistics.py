@@ -0,0 +1,170 @@
+# -*- coding: utf-8 -*-
+#
+# test_wfr_statistics.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test the iteration statistics of waveform relaxation.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+
+def _simulate_gap_network(num_threads, simtime):
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads, resolution=0.1, wfr_max_iterations=10)
+
+    neurons = nest.Create("hh_psc_alpha_gap", 4, params={"I_e": [200.0, 0.0, 100.0, 0.0]})
+    sr = nest.Create("spike_recorder")
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "pairwise_bernoulli", "p": 1.0, "allow_autapses": False, "make_symmetric": True},
+        {"synapse_model": "gap_junction", "weight": 5.0},
+    )
+    nest.Connect(neurons, sr)
+
+    nest.Simulate(simtime)
+    return sr.events["times"]
+
+
+@pytest.mark.skipif_missing_gsl
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_wfr_statistics(num_threads):
+    """Test that iterations and intervals of the last simulation are counted."""
+
+    simtime = 50.0
+    _simulate_gap_network(num_threads, simtime)
+
+    intervals = nest.wfr_intervals
+    assert intervals == round(simtime / nest.min_delay)
+    assert intervals <= nest.wfr_iterations <= nest.wfr_max_iterations * intervals
+    assert 0.0 < nest.time_wfr <= nest.GetKernelStatus("time_simulate")
+
+    # counters refer to the last simulation only
+    nest.Simulate(simtime)
+    assert nest.wfr_intervals == intervals
+
+
+@pytest.mark.skipif_missing_gsl
+@pytest.mark.skipif_missing_threads
+def test_results_independent_of_threads():
+    """Test that the convergence check gives the same results with several threads."""
+
+    times_single = _simulate_gap_network(1, 50.0)
+    iterations_single = nest.wfr_iterations
+
+    times_multi = _simulate_gap_network(4, 50.0)
+
+    assert nest.wfr_iterations == iterations_single
+    nptest.assert_allclose(sorted(times_multi), sorted(times_single))
+
+
+def test_skip_unchanged_is_opt_in():
+    """Test that nodes with unchanged input are only skipped if requested."""
+
+    nest.ResetKernel()
+    assert not nest.wfr_skip_unchanged
+
+    nest.wfr_skip_unchanged = True
+    assert nest.wfr_skip_unchanged
+
+    nest.ResetKernel()
+    assert not nest.wfr_skip_unchanged
+
+
+def _simulate_two_pairs(skip_unchanged):
+    """Simulate a driven and a resting pair of neurons coupled by gap junctions and return V_m of all neurons."""
+
+    nest.ResetKernel()
+    nest.set(resolution=0.1, wfr_skip_unchanged=skip_unchanged)
+
+    neurons = nest.Create("hh_psc_alpha_gap", 4, params={"I_e": [200.0, 0.0, 0.0, 0.0]})
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 0.1})
+    for pair in [neurons[:2], neurons[2:]]:
+        nest.Connect(
+            pair,
+            pair,
+            {"rule": "pairwise_bernoulli", "p": 1.0, "allow_autapses": False, "make_symmetric": True},
+            {"synapse_model": "gap_junction", "weight": 5.0},
+        )
+    nest.Connect(mm, neurons)
+
+    nest.Simulate(50.0)
+    events = mm.events
+    order = np.lexsort((events["senders"], events["times"]))
+    return events["V_m"][order]
+
+
+@pytest.mark.skipif_missing_gsl
+def test_skip_unchanged_input():
+    """Test that skipping nodes with unchanged input keeps the results and needs no more iterations."""
+
+    v_m_all = _simulate_two_pairs(False)
+    iterations_all = nest.wfr_iterations
+    assert nest.wfr_skipped_updates == 0
+    assert nest.wfr_updates == 4 * iterations_all
+
+    v_m_skip = _simulate_two_pairs(True)
+    assert nest.wfr_iterations <= iterations_all
+    assert nest.wfr_updates == 4 * nest.wfr_iterations
+
+    # the resting pair has converged while the driven pair still iterates
+    assert 0 < nest.wfr_skipped_updates < nest.wfr_updates
+
+    nptest.assert_allclose(v_m_skip, v_m_all, rtol=0.0, atol=1e-3)
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_wfr_statistics_rate_network(num_threads):
+    """Test that iterations are counted for instantaneous rate connections as well."""
+
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads, resolution=0.1)
+
+    neurons = nest.Create("lin_rate_ipn", 4, params={"mu": 1.0, "sigma": 0.0})
+    nest.Connect(neurons, neurons, syn_spec={"synapse_model": "rate_connection_instantaneous", "weight": 0.1})
+
+    simtime = 20.0
+    nest.Simulate(simtime)
+
+    intervals = nest.wfr_intervals
+    assert intervals == round(simtime / nest.min_delay)
+    assert intervals < nest.wfr_iterations <= nest.wfr_max_iterations * intervals
+    assert 0.0 < nest.time_wfr <= nest.GetKernelStatus("time_simulate")
+
+    # rate neurons are updated in every iteration
+    assert nest.wfr_updates == 4 * nest.wfr_iterations
+    assert nest.wfr_skipped_updates == 0
+
+
+def test_no_wfr_without_gap_junctions():
+    """Test that no iterations are counted if waveform relaxation is not needed."""
+
+    nest.ResetKernel()
+    nest.Create("iaf_psc_alpha", params={"I_e": 500.0})
+    nest.Simulate(20.0)
+
+    assert nest.wfr_iterations == 0
+    assert nest.wfr_intervals == 0
+    assert nest.wfr_updates == 0
+    assert nest.time_wfr == 0.0